@@ -0,0 +1,173 @@
+// Copyright 2019 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "common/assert.h"
+#include "common/bit_util.h"
+#include "common/common_types.h"
+
+namespace Common {
+
+template <typename T>
+class IntrusivePriorityQueueNode;
+
+template <typename T, IntrusivePriorityQueueNode<T> T::*Member, std::size_t Depth>
+class IntrusivePriorityQueue;
+
+/**
+ * Links embedded in an object so it can be stored in an IntrusivePriorityQueue. The links are only
+ * touched by the queue the object is currently in.
+ */
+template <typename T>
+class IntrusivePriorityQueueNode {
+public:
+    /// Whether the owning object is currently in a queue.
+    bool IsLinked() const {
+        return linked;
+    }
+
+private:
+    template <typename U, IntrusivePriorityQueueNode<U> U::*Member, std::size_t Depth>
+    friend class IntrusivePriorityQueue;
+
+    T* prev = nullptr;
+    T* next = nullptr;
+    u32 priority = 0;
+    bool linked = false;
+};
+
+/**
+ * An IntrusivePriorityQueue is a type of priority queue which has the following characteristics:
+ * - elements are linked through an IntrusivePriorityQueueNode member, so it never allocates.
+ * - O(1) add, remove (of any element) and front.
+ * - lower values have higher priority, elements of equal priority are kept in insertion order.
+ * - discrete priorities and a max of 64 priorities (limited domain)
+ * This type of priority queue is normally used for threads waiting on a synchronization primitive.
+ */
+template <typename T, IntrusivePriorityQueueNode<T> T::*Member, std::size_t Depth = 64>
+class IntrusivePriorityQueue {
+    static_assert(Depth <= 64, "Depth must fit in the priority bitmask");
+
+public:
+    IntrusivePriorityQueue() = default;
+
+    ~IntrusivePriorityQueue() {
+        clear();
+    }
+
+    IntrusivePriorityQueue(const IntrusivePriorityQueue&) = delete;
+    IntrusivePriorityQueue& operator=(const IntrusivePriorityQueue&) = delete;
+
+    bool empty() const {
+        return head == nullptr;
+    }
+
+    std::size_t size() const {
+        return count;
+    }
+
+    /// Returns the highest priority element, or nullptr if the queue is empty.
+    T* front() const {
+        return head;
+    }
+
+    /**
+     * Adds an element that is not in any queue. When send_back is false, the element is placed
+     * before all other elements of the same priority instead of after them.
+     */
+    void add(T& value, u32 priority, bool send_back = true) {
+        ASSERT(priority < Depth);
+        auto& node = value.*Member;
+        ASSERT(!node.linked);
+
+        const u64 priority_bit = 1ULL << priority;
+        const bool has_priority = (used_priorities & priority_bit) != 0;
+        T* const prev = send_back && has_priority ? tails[priority] : GetPrecedingTail(priority);
+        T* const next = prev != nullptr ? (prev->*Member).next : head;
+
+        node.prev = prev;
+        node.next = next;
+        node.priority = priority;
+        node.linked = true;
+        if (prev != nullptr) {
+            (prev->*Member).next = &value;
+        } else {
+            head = &value;
+        }
+        if (next != nullptr) {
+            (next->*Member).prev = &value;
+        }
+
+        if (send_back || !has_priority) {
+            tails[priority] = &value;
+        }
+        used_priorities |= priority_bit;
+        ++count;
+    }
+
+    /// Removes an element from anywhere in this queue.
+    void remove(T& value) {
+        auto& node = value.*Member;
+        ASSERT(node.linked);
+
+        const u32 priority = node.priority;
+        if (tails[priority] == &value) {
+            if (node.prev != nullptr && (node.prev->*Member).priority == priority) {
+                tails[priority] = node.prev;
+            } else {
+                tails[priority] = nullptr;
+                used_priorities &= ~(1ULL << priority);
+            }
+        }
+
+        if (node.prev != nullptr) {
+            (node.prev->*Member).next = node.next;
+        } else {
+            head = node.next;
+        }
+        if (node.next != nullptr) {
+            (node.next->*Member).prev = node.prev;
+        }
+
+        node.prev = nullptr;
+        node.next = nullptr;
+        node.linked = false;
+        --count;
+    }
+
+    /// Removes and returns the highest priority element, or nullptr if the queue is empty.
+    T* pop_front() {
+        T* const value = head;
+        if (value != nullptr) {
+            remove(*value);
+        }
+        return value;
+    }
+
+    void clear() {
+        while (pop_front() != nullptr) {
+        }
+    }
+
+private:
+    /// Gets the last element with a higher priority than the given one, if any.
+    T* GetPrecedingTail(u32 priority) const {
+        const u64 higher_priorities = used_priorities & ((1ULL << priority) - 1);
+        if (higher_priorities == 0) {
+            return nullptr;
+        }
+        return tails[63 - CountLeadingZeroes64(higher_priorities)];
+    }
+
+    T* head = nullptr;
+    std::array<T*, Depth> tails{};
+    u64 used_priorities = 0;
+    std::size_t count = 0;
+};
+
+} // namespace Common
@@ -0,0 +1,74 @@
+// Copyright 2019 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <atomic>
+#include <utility>
+
+namespace Common {
+
+/**
+ * Lock-free multiple producer, single consumer mailbox. Producers push messages without ever
+ * blocking each other, the consumer takes all the pending messages at once in the order they were
+ * pushed. Only one thread may drain the mailbox at a time.
+ */
+template <typename T>
+class Mailbox {
+public:
+    Mailbox() = default;
+    ~Mailbox() {
+        Drain([](T&&) {});
+    }
+
+    Mailbox(const Mailbox&) = delete;
+    Mailbox& operator=(const Mailbox&) = delete;
+
+    template <typename... Args>
+    void Push(Args&&... args) {
+        Node* const node = new Node{T{std::forward<Args>(args)...}, nullptr};
+        node->next = head.load(std::memory_order_relaxed);
+        while (!head.compare_exchange_weak(node->next, node, std::memory_order_release,
+                                           std::memory_order_relaxed)) {
+        }
+    }
+
+    /// Returns true when no message is pending. Messages may be pushed concurrently.
+    bool Empty() const {
+        return head.load(std::memory_order_relaxed) == nullptr;
+    }
+
+    /// Takes the pending messages and passes them to func from the oldest to the newest.
+    template <typename Func>
+    void Drain(Func&& func) {
+        if (Empty()) {
+            return;
+        }
+        // The messages are linked from the newest to the oldest, reverse them.
+        Node* node = head.exchange(nullptr, std::memory_order_acquire);
+        Node* oldest = nullptr;
+        while (node != nullptr) {
+            Node* const next = node->next;
+            node->next = oldest;
+            oldest = node;
+            node = next;
+        }
+        while (oldest != nullptr) {
+            Node* const next = oldest->next;
+            func(std::move(oldest->value));
+            delete oldest;
+            oldest = next;
+        }
+    }
+
+private:
+    struct Node {
+        T value;
+        Node* next;
+    };
+
+    std::atomic<Node*> head{nullptr};
+};
+
+} // namespace Common
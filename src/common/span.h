@@ -0,0 +1,95 @@
+// Copyright 2019 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "common/assert.h"
+
+namespace Common {
+
+/**
+ * Non-owning view of a contiguous sequence of objects, modeled after C++20's std::span with a
+ * dynamic extent. It can be built from a pointer and a size or from any contiguous container.
+ */
+template <typename T>
+class Span {
+public:
+    using element_type = T;
+    using value_type = std::remove_cv_t<T>;
+    using size_type = std::size_t;
+    using pointer = T*;
+    using reference = T&;
+    using iterator = T*;
+
+    constexpr Span() = default;
+
+    constexpr Span(T* data, std::size_t size) : ptr{data}, count{size} {}
+
+    template <typename Container,
+              typename = std::enable_if_t<std::is_convertible_v<
+                  std::remove_pointer_t<decltype(std::data(std::declval<Container&>()))> (*)[],
+                  T (*)[]>>>
+    constexpr Span(Container& container)
+        : ptr{std::data(container)}, count{std::size(container)} {}
+
+    template <typename U, typename = std::enable_if_t<std::is_convertible_v<U (*)[], T (*)[]>>>
+    constexpr Span(const Span<U>& other) : ptr{other.data()}, count{other.size()} {}
+
+    constexpr T* data() const {
+        return ptr;
+    }
+
+    constexpr std::size_t size() const {
+        return count;
+    }
+
+    constexpr std::size_t size_bytes() const {
+        return count * sizeof(T);
+    }
+
+    constexpr bool empty() const {
+        return count == 0;
+    }
+
+    constexpr iterator begin() const {
+        return ptr;
+    }
+
+    constexpr iterator end() const {
+        return ptr + count;
+    }
+
+    constexpr T& operator[](std::size_t index) const {
+        return ptr[index];
+    }
+
+    /// Returns a view of the first `size` elements.
+    Span first(std::size_t size) const {
+        ASSERT(size <= count);
+        return {ptr, size};
+    }
+
+    /// Returns a view of the elements from `offset` to the end.
+    Span subspan(std::size_t offset) const {
+        ASSERT(offset <= count);
+        return {ptr + offset, count - offset};
+    }
+
+    /// Returns a view of `size` elements starting at `offset`.
+    Span subspan(std::size_t offset, std::size_t size) const {
+        ASSERT(offset <= count && size <= count - offset);
+        return {ptr + offset, size};
+    }
+
+private:
+    T* ptr = nullptr;
+    std::size_t count = 0;
+};
+
+} // namespace Common
@@ -0,0 +1,64 @@
+// Copyright 2019 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+#include "common/virtual_buffer.h"
+
+namespace Common {
+
+void* ReserveMemoryPages(std::size_t size) noexcept {
+#ifdef _WIN32
+    return VirtualAlloc(nullptr, size, MEM_RESERVE, PAGE_NOACCESS);
+#else
+    void* const base =
+        mmap(nullptr, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    return base == MAP_FAILED ? nullptr : base;
+#endif
+}
+
+bool CommitMemoryPages(void* base, std::size_t size) noexcept {
+#ifdef _WIN32
+    return VirtualAlloc(base, size, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+#else
+    return mprotect(base, size, PROT_READ | PROT_WRITE) == 0;
+#endif
+}
+
+void DecommitMemoryPages(void* base, std::size_t size) noexcept {
+#ifdef _WIN32
+    // Decommitting and committing again gives back zero filled pages.
+    VirtualFree(base, size, MEM_DECOMMIT);
+    VirtualAlloc(base, size, MEM_COMMIT, PAGE_READWRITE);
+#else
+    madvise(base, size, MADV_DONTNEED);
+#endif
+}
+
+void* AllocateMemoryPages(std::size_t size) noexcept {
+#ifdef _WIN32
+    return VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+#else
+    void* const base = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                            MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    return base == MAP_FAILED ? nullptr : base;
+#endif
+}
+
+void FreeMemoryPages(void* base, std::size_t size) noexcept {
+    if (base == nullptr) {
+        return;
+    }
+#ifdef _WIN32
+    VirtualFree(base, 0, MEM_RELEASE);
+#else
+    munmap(base, size);
+#endif
+}
+
+} // namespace Common
@@ -0,0 +1,32 @@
+// Copyright 2019 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <cstddef>
+
+namespace Common {
+
+/**
+ * Reserves a range of host virtual memory without backing it. Pages have to be committed with
+ * CommitMemoryPages before they are accessed. Returns nullptr on failure.
+ */
+void* ReserveMemoryPages(std::size_t size) noexcept;
+
+/// Makes a reserved range readable and writable. The host backs the pages on first access.
+bool CommitMemoryPages(void* base, std::size_t size) noexcept;
+
+/**
+ * Releases the host pages backing a committed range, the range stays accessible and reads as
+ * zero afterwards.
+ */
+void DecommitMemoryPages(void* base, std::size_t size) noexcept;
+
+/// Reserves and commits a range of zero filled pages. Returns nullptr on failure.
+void* AllocateMemoryPages(std::size_t size) noexcept;
+
+/// Releases a range returned by ReserveMemoryPages or AllocateMemoryPages.
+void FreeMemoryPages(void* base, std::size_t size) noexcept;
+
+} // namespace Common
@@ -134,13 +134,43 @@ public:
      * Saves the current CPU context
      * @param ctx Thread context to save
      */
-    virtual void SaveContext(ThreadContext& ctx) = 0;
+    void SaveContext(ThreadContext& ctx) {
+        SaveGeneralContext(ctx);
+        SaveVectorContext(ctx);
+    }
 
     /**
      * Loads a CPU context
      * @param ctx Thread context to load
      */
-    virtual void LoadContext(const ThreadContext& ctx) = 0;
+    void LoadContext(const ThreadContext& ctx) {
+        LoadGeneralContext(ctx);
+        LoadVectorContext(ctx);
+    }
+
+    /**
+     * Saves the general purpose registers, stack pointer, PC, PSTATE and TPIDR_EL0
+     * @param ctx Thread context to save
+     */
+    virtual void SaveGeneralContext(ThreadContext& ctx) = 0;
+
+    /**
+     * Loads the general purpose registers, stack pointer, PC, PSTATE and TPIDR_EL0
+     * @param ctx Thread context to load
+     */
+    virtual void LoadGeneralContext(const ThreadContext& ctx) = 0;
+
+    /**
+     * Saves the vector registers and the floating point control and status registers
+     * @param ctx Thread context to save
+     */
+    virtual void SaveVectorContext(ThreadContext& ctx) = 0;
+
+    /**
+     * Loads the vector registers and the floating point control and status registers
+     * @param ctx Thread context to load
+     */
+    virtual void LoadVectorContext(const ThreadContext& ctx) = 0;
 
     /// Clears the exclusive monitor's state.
     virtual void ClearExclusiveState() = 0;
@@ -148,6 +178,9 @@ public:
     /// Prepare core for thread reschedule (if needed to correctly handle state)
     virtual void PrepareReschedule() = 0;
 
+    /// Stops execution as soon as possible, a CoreTiming event is due before the slice ends.
+    virtual void NotifyEventDue() = 0;
+
     struct BacktraceEntry {
         std::string module;
         u64 address;
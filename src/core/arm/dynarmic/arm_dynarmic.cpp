@@ -9,6 +9,7 @@
 #include "common/logging/log.h"
 #include "common/microprofile.h"
 #include "core/arm/dynarmic/arm_dynarmic.h"
+#include "core/arm/spin_detector.h"
 #include "core/core.h"
 #include "core/core_cpu.h"
 #include "core/core_timing.h"
@@ -78,14 +79,19 @@ public:
     void ExceptionRaised(u64 pc, Dynarmic::A64::Exception exception) override {
         switch (exception) {
         case Dynarmic::A64::Exception::WaitForInterrupt:
+            // Nothing will happen on this core until the next event.
+            RequestSkip();
+            return;
         case Dynarmic::A64::Exception::WaitForEvent:
+        case Dynarmic::A64::Exception::Yield:
+            DetectSpin(pc);
+            return;
         case Dynarmic::A64::Exception::SendEvent:
         case Dynarmic::A64::Exception::SendEventLocal:
-        case Dynarmic::A64::Exception::Yield:
             return;
         case Dynarmic::A64::Exception::Breakpoint:
             if (GDBStub::IsServerEnabled()) {
-                parent.jit->HaltExecution();
+                parent.Halt(ARM_Dynarmic::ExitReason::Debug);
                 parent.SetPC(pc);
                 Kernel::Thread* thread = Kernel::GetCurrentThread();
                 parent.SaveContext(thread->GetContext());
@@ -124,8 +130,22 @@ public:
         return Timing::CpuCyclesToClockCycles(parent.system.CoreTiming().GetTicks());
     }
 
+    /// Skips the rest of the slice when the hint at pc is part of a spin-wait.
+    void DetectSpin(u64 pc) {
+        if (spin_detector.OnHint(pc, parent.jit->GetRegisters(), parent.jit->GetSP())) {
+            ++parent.spin_statistics.detected_spins;
+            RequestSkip();
+        }
+    }
+
+    void RequestSkip() {
+        parent.skip_to_next_event = true;
+        parent.Halt(ARM_Dynarmic::ExitReason::Idle);
+    }
+
     ARM_Dynarmic& parent;
     std::size_t num_interpreted_instructions = 0;
+    SpinDetector spin_detector;
     u64 tpidrro_el0 = 0;
     u64 tpidr_el0 = 0;
 };
@@ -156,6 +176,9 @@ std::unique_ptr<Dynarmic::A64::Jit> ARM_Dynarmic::MakeJit(Common::PageTable& pag
     // Unpredictable instructions
     config.define_unpredictable_behaviour = true;
 
+    // Hint instructions are reported to detect spin-waits
+    config.hook_hint_instructions = true;
+
     return std::make_unique<Dynarmic::A64::Jit>(config);
 }
 
@@ -164,7 +187,60 @@ MICROPROFILE_DEFINE(ARM_Jit_Dynarmic, "ARM JIT", "Dynarmic", MP_RGB(255, 64, 64)
 void ARM_Dynarmic::Run() {
     MICROPROFILE_SCOPE(ARM_Jit_Dynarmic);
 
+    // Halts requested while the JIT was stopped are dropped when it starts running again.
+    halt_reason.store(ExitReason::SliceEnd, std::memory_order_relaxed);
     jit->Run();
+    RecordExit();
+
+    if (skip_to_next_event) {
+        skip_to_next_event = false;
+        SkipToNextEvent();
+    }
+}
+
+void ARM_Dynarmic::SkipToNextEvent() {
+    auto& core_timing = system.CoreTiming();
+    const s64 remaining_ticks = core_timing.GetDowncount();
+    if (remaining_ticks <= 0) {
+        return;
+    }
+    spin_statistics.skipped_ticks += static_cast<u64>(remaining_ticks);
+    core_timing.Idle();
+}
+
+void ARM_Dynarmic::Halt(ExitReason reason) {
+    halt_reason.store(reason, std::memory_order_relaxed);
+    jit->HaltExecution();
+}
+
+void ARM_Dynarmic::RecordExit() {
+    const ExitReason reason = halt_reason.exchange(ExitReason::SliceEnd, std::memory_order_relaxed);
+    ++exit_statistics.exits[static_cast<std::size_t>(reason)];
+
+    const auto now = std::chrono::steady_clock::now();
+    const auto elapsed = now - last_exit_report;
+    if (elapsed < std::chrono::seconds{1}) {
+        return;
+    }
+    const double seconds = std::chrono::duration<double>(elapsed).count();
+    const auto per_second = [seconds](u64 count, u64 reported_count) {
+        return static_cast<double>(count - reported_count) / seconds;
+    };
+    const auto rate = [&](ExitReason exit_reason) {
+        return per_second(exit_statistics.GetExits(exit_reason),
+                          reported_exit_statistics.GetExits(exit_reason));
+    };
+    LOG_DEBUG(Core_ARM,
+              "Core {} JIT exits/s: slice end={:.0f}, event due={:.0f}, reschedule={:.0f}, "
+              "idle={:.0f}, debug={:.0f}",
+              core_index, rate(ExitReason::SliceEnd), rate(ExitReason::EventDue),
+              rate(ExitReason::Reschedule), rate(ExitReason::Idle), rate(ExitReason::Debug));
+    LOG_DEBUG(Core_ARM, "Core {} spin-waits/s: detected={:.0f}, skipped ticks={:.0f}", core_index,
+              per_second(spin_statistics.detected_spins, reported_spin_statistics.detected_spins),
+              per_second(spin_statistics.skipped_ticks, reported_spin_statistics.skipped_ticks));
+    reported_exit_statistics = exit_statistics;
+    reported_spin_statistics = spin_statistics;
+    last_exit_report = now;
 }
 
 void ARM_Dynarmic::Step() {
@@ -173,8 +249,8 @@ void ARM_Dynarmic::Step() {
 
 ARM_Dynarmic::ARM_Dynarmic(System& system, ExclusiveMonitor& exclusive_monitor,
                            std::size_t core_index)
-    : ARM_Interface{system},
-      cb(std::make_unique<ARM_Dynarmic_Callbacks>(*this)), inner_unicorn{system},
+    : ARM_Interface{system}, cb(std::make_unique<ARM_Dynarmic_Callbacks>(*this)),
+      last_exit_report{std::chrono::steady_clock::now()}, inner_unicorn{system},
       core_index{core_index}, exclusive_monitor{
                                   dynamic_cast<DynarmicExclusiveMonitor&>(exclusive_monitor)} {}
 
@@ -228,30 +304,40 @@ void ARM_Dynarmic::SetTPIDR_EL0(u64 value) {
     cb->tpidr_el0 = value;
 }
 
-void ARM_Dynarmic::SaveContext(ThreadContext& ctx) {
+void ARM_Dynarmic::SaveGeneralContext(ThreadContext& ctx) {
     ctx.cpu_registers = jit->GetRegisters();
     ctx.sp = jit->GetSP();
     ctx.pc = jit->GetPC();
     ctx.pstate = jit->GetPstate();
-    ctx.vector_registers = jit->GetVectors();
-    ctx.fpcr = jit->GetFpcr();
-    ctx.fpsr = jit->GetFpsr();
     ctx.tpidr = cb->tpidr_el0;
 }
 
-void ARM_Dynarmic::LoadContext(const ThreadContext& ctx) {
+void ARM_Dynarmic::LoadGeneralContext(const ThreadContext& ctx) {
     jit->SetRegisters(ctx.cpu_registers);
     jit->SetSP(ctx.sp);
     jit->SetPC(ctx.pc);
     jit->SetPstate(ctx.pstate);
+    SetTPIDR_EL0(ctx.tpidr);
+}
+
+void ARM_Dynarmic::SaveVectorContext(ThreadContext& ctx) {
+    ctx.vector_registers = jit->GetVectors();
+    ctx.fpcr = jit->GetFpcr();
+    ctx.fpsr = jit->GetFpsr();
+}
+
+void ARM_Dynarmic::LoadVectorContext(const ThreadContext& ctx) {
     jit->SetVectors(ctx.vector_registers);
     jit->SetFpcr(ctx.fpcr);
     jit->SetFpsr(ctx.fpsr);
-    SetTPIDR_EL0(ctx.tpidr);
 }
 
 void ARM_Dynarmic::PrepareReschedule() {
-    jit->HaltExecution();
+    Halt(ExitReason::Reschedule);
+}
+
+void ARM_Dynarmic::NotifyEventDue() {
+    Halt(ExitReason::EventDue);
 }
 
 void ARM_Dynarmic::ClearInstructionCache() {
@@ -268,13 +354,33 @@ void ARM_Dynarmic::PageTableChanged(Common::PageTable& page_table,
 }
 
 DynarmicExclusiveMonitor::DynarmicExclusiveMonitor(Memory::Memory& memory_, std::size_t core_count)
-    : monitor(core_count), memory{memory_} {}
+    : monitor(core_count), memory{memory_}, reserved_values(core_count) {}
 
 DynarmicExclusiveMonitor::~DynarmicExclusiveMonitor() = default;
 
-void DynarmicExclusiveMonitor::SetExclusive(std::size_t core_index, VAddr addr) {
-    // Size doesn't actually matter.
-    monitor.Mark(core_index, addr, 16);
+void DynarmicExclusiveMonitor::Reserve(std::size_t core_index, VAddr addr, std::size_t size,
+                                       u128 value) {
+    monitor.Mark(core_index, addr, size);
+    reserved_values[core_index] = value;
+}
+
+template <typename Read, typename Write>
+bool DynarmicExclusiveMonitor::ExclusiveWrite(std::size_t core_index, VAddr addr, std::size_t size,
+                                              Read&& read, Write&& write) {
+    bool result = false;
+    monitor.DoExclusiveOperation(core_index, addr, size, [&] {
+        result = read() == reserved_values[core_index];
+        if (result) {
+            write();
+        }
+    });
+    return result;
+}
+
+u32 DynarmicExclusiveMonitor::ExclusiveRead32(std::size_t core_index, VAddr addr) {
+    const u32 value = memory.Read32(addr);
+    Reserve(core_index, addr, sizeof(value), {value, 0});
+    return value;
 }
 
 void DynarmicExclusiveMonitor::ClearExclusive() {
@@ -282,29 +388,37 @@ void DynarmicExclusiveMonitor::ClearExclusive() {
 }
 
 bool DynarmicExclusiveMonitor::ExclusiveWrite8(std::size_t core_index, VAddr vaddr, u8 value) {
-    return monitor.DoExclusiveOperation(core_index, vaddr, 1, [&] { memory.Write8(vaddr, value); });
+    return ExclusiveWrite(
+        core_index, vaddr, 1, [&] { return u128{memory.Read8(vaddr), 0}; },
+        [&] { memory.Write8(vaddr, value); });
 }
 
 bool DynarmicExclusiveMonitor::ExclusiveWrite16(std::size_t core_index, VAddr vaddr, u16 value) {
-    return monitor.DoExclusiveOperation(core_index, vaddr, 2,
-                                        [&] { memory.Write16(vaddr, value); });
+    return ExclusiveWrite(
+        core_index, vaddr, 2, [&] { return u128{memory.Read16(vaddr), 0}; },
+        [&] { memory.Write16(vaddr, value); });
 }
 
 bool DynarmicExclusiveMonitor::ExclusiveWrite32(std::size_t core_index, VAddr vaddr, u32 value) {
-    return monitor.DoExclusiveOperation(core_index, vaddr, 4,
-                                        [&] { memory.Write32(vaddr, value); });
+    return ExclusiveWrite(
+        core_index, vaddr, 4, [&] { return u128{memory.Read32(vaddr), 0}; },
+        [&] { memory.Write32(vaddr, value); });
 }
 
 bool DynarmicExclusiveMonitor::ExclusiveWrite64(std::size_t core_index, VAddr vaddr, u64 value) {
-    return monitor.DoExclusiveOperation(core_index, vaddr, 8,
-                                        [&] { memory.Write64(vaddr, value); });
+    return ExclusiveWrite(
+        core_index, vaddr, 8, [&] { return u128{memory.Read64(vaddr), 0}; },
+        [&] { memory.Write64(vaddr, value); });
 }
 
 bool DynarmicExclusiveMonitor::ExclusiveWrite128(std::size_t core_index, VAddr vaddr, u128 value) {
-    return monitor.DoExclusiveOperation(core_index, vaddr, 16, [&] {
-        memory.Write64(vaddr + 0, value[0]);
-        memory.Write64(vaddr + 8, value[1]);
-    });
+    return ExclusiveWrite(
+        core_index, vaddr, 16,
+        [&] { return u128{memory.Read64(vaddr + 0), memory.Read64(vaddr + 8)}; },
+        [&] {
+            memory.Write64(vaddr + 0, value[0]);
+            memory.Write64(vaddr + 8, value[1]);
+        });
 }
 
 } // namespace Core
@@ -4,7 +4,11 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <memory>
+#include <vector>
 #include <dynarmic/A64/a64.h>
 #include <dynarmic/A64/exclusive_monitor.h>
 #include "common/common_types.h"
@@ -42,23 +46,78 @@ public:
     void SetTPIDR_EL0(u64 value) override;
     u64 GetTPIDR_EL0() const override;
 
-    void SaveContext(ThreadContext& ctx) override;
-    void LoadContext(const ThreadContext& ctx) override;
+    void SaveGeneralContext(ThreadContext& ctx) override;
+    void LoadGeneralContext(const ThreadContext& ctx) override;
+    void SaveVectorContext(ThreadContext& ctx) override;
+    void LoadVectorContext(const ThreadContext& ctx) override;
 
     void PrepareReschedule() override;
+    void NotifyEventDue() override;
     void ClearExclusiveState() override;
 
     void ClearInstructionCache() override;
     void PageTableChanged(Common::PageTable& new_page_table,
                           std::size_t new_address_space_size_in_bits) override;
 
+    struct SpinStatistics {
+        u64 detected_spins = 0; ///< Spin-waits detected in guest code.
+        u64 skipped_ticks = 0;  ///< Ticks skipped because the core was spinning or waiting.
+    };
+
+    const SpinStatistics& GetSpinStatistics() const {
+        return spin_statistics;
+    }
+
+    /// Reasons for the JIT to return control to the emulator.
+    enum class ExitReason : u32 {
+        SliceEnd,   ///< The ticks of the slice were consumed.
+        EventDue,   ///< A CoreTiming event became due before the slice ended.
+        Reschedule, ///< A thread reschedule was requested.
+        Idle,       ///< The core waits or spins until the next event.
+        Debug,      ///< A debugger breakpoint was hit.
+        Count,
+    };
+
+    struct ExitStatistics {
+        /// Number of times the JIT returned for each reason.
+        std::array<u64, static_cast<std::size_t>(ExitReason::Count)> exits{};
+
+        u64 GetExits(ExitReason reason) const {
+            return exits[static_cast<std::size_t>(reason)];
+        }
+    };
+
+    const ExitStatistics& GetExitStatistics() const {
+        return exit_statistics;
+    }
+
 private:
     std::unique_ptr<Dynarmic::A64::Jit> MakeJit(Common::PageTable& page_table,
                                                 std::size_t address_space_bits) const;
 
+    /// Fast-forwards the core to the next CoreTiming event.
+    void SkipToNextEvent();
+
+    /// Halts the JIT, recording why so the exit can be accounted for.
+    void Halt(ExitReason reason);
+
+    /// Accounts the exit of the JIT and periodically logs the exit and spin-wait rates.
+    void RecordExit();
+
     friend class ARM_Dynarmic_Callbacks;
     std::unique_ptr<ARM_Dynarmic_Callbacks> cb;
     std::unique_ptr<Dynarmic::A64::Jit> jit;
+
+    SpinStatistics spin_statistics;
+    SpinStatistics reported_spin_statistics;
+    bool skip_to_next_event = false;
+
+    /// Reason of the last halt request, the JIT ran out of ticks when none was requested.
+    std::atomic<ExitReason> halt_reason{ExitReason::SliceEnd};
+    ExitStatistics exit_statistics;
+    ExitStatistics reported_exit_statistics;
+    std::chrono::steady_clock::time_point last_exit_report;
+
     ARM_Unicorn inner_unicorn;
 
     std::size_t core_index;
@@ -70,7 +129,7 @@ public:
     explicit DynarmicExclusiveMonitor(Memory::Memory& memory_, std::size_t core_count);
     ~DynarmicExclusiveMonitor() override;
 
-    void SetExclusive(std::size_t core_index, VAddr addr) override;
+    u32 ExclusiveRead32(std::size_t core_index, VAddr addr) override;
     void ClearExclusive() override;
 
     bool ExclusiveWrite8(std::size_t core_index, VAddr vaddr, u8 value) override;
@@ -81,8 +140,22 @@ public:
 
 private:
     friend class ARM_Dynarmic;
+
+    /// Reserves the address on the JIT monitor and records the value loaded by the core.
+    void Reserve(std::size_t core_index, VAddr addr, std::size_t size, u128 value);
+
+    /**
+     * Performs the exclusive store of a core while the JIT monitor holds its lock. The store only
+     * happens when the reservation is still held and memory still holds the value the core loaded,
+     * so plain stores made between the exclusive read and write are detected as well.
+     */
+    template <typename Read, typename Write>
+    bool ExclusiveWrite(std::size_t core_index, VAddr addr, std::size_t size, Read&& read,
+                        Write&& write);
+
     Dynarmic::A64::ExclusiveMonitor monitor;
     Memory::Memory& memory;
+    std::vector<u128> reserved_values; ///< Value loaded by the last exclusive read of each core.
 };
 
 } // namespace Core
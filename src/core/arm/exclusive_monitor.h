@@ -8,11 +8,16 @@
 
 namespace Core {
 
+/**
+ * Emulates the exclusive monitors used by load/store exclusive instructions on behalf of HLE code.
+ * An exclusive read reserves the address and records the value it loaded, the following exclusive
+ * write only succeeds when the reservation is still held and memory still holds that value.
+ */
 class ExclusiveMonitor {
 public:
     virtual ~ExclusiveMonitor();
 
-    virtual void SetExclusive(std::size_t core_index, VAddr addr) = 0;
+    virtual u32 ExclusiveRead32(std::size_t core_index, VAddr addr) = 0;
     virtual void ClearExclusive() = 0;
 
     virtual bool ExclusiveWrite8(std::size_t core_index, VAddr vaddr, u8 value) = 0;
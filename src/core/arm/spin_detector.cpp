@@ -0,0 +1,26 @@
+// Copyright 2019 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include "core/arm/spin_detector.h"
+
+namespace Core {
+
+bool SpinDetector::OnHint(u64 pc, const std::array<u64, 31>& registers, u64 sp) {
+    if (pc == last_pc && sp == last_sp && registers == last_registers) {
+        ++iterations;
+    } else {
+        last_pc = pc;
+        last_sp = sp;
+        last_registers = registers;
+        iterations = 0;
+    }
+
+    if (iterations < DETECTION_ITERATIONS) {
+        return false;
+    }
+    iterations = 0;
+    return true;
+}
+
+} // namespace Core
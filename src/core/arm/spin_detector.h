@@ -0,0 +1,36 @@
+// Copyright 2019 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <array>
+#include "common/common_types.h"
+
+namespace Core {
+
+/**
+ * Recognizes guest spin-waits from the hint instructions (WFE, YIELD) they execute while polling
+ * memory. The guest clock doesn't advance while the JIT runs, so progress is judged from the
+ * registers instead: an iteration that reaches the same hint with exactly the same register state
+ * as the previous one computed nothing and only waits for memory to change.
+ */
+class SpinDetector {
+public:
+    /// Consecutive iterations without progress before a loop is considered a spin-wait.
+    static constexpr u32 DETECTION_ITERATIONS = 16;
+
+    /**
+     * Records a hint instruction at pc with the given register state. Returns true when the loop
+     * has been spinning for DETECTION_ITERATIONS iterations, the count starts over afterwards.
+     */
+    bool OnHint(u64 pc, const std::array<u64, 31>& registers, u64 sp);
+
+private:
+    u64 last_pc = 0;
+    u64 last_sp = 0;
+    std::array<u64, 31> last_registers{};
+    u32 iterations = 0;
+};
+
+} // namespace Core
@@ -187,7 +187,7 @@ void ARM_Unicorn::ExecuteInstructions(std::size_t num_instructions) {
     }
 }
 
-void ARM_Unicorn::SaveContext(ThreadContext& ctx) {
+void ARM_Unicorn::SaveGeneralContext(ThreadContext& ctx) {
     int uregs[32];
     void* tregs[32];
 
@@ -205,6 +205,11 @@ void ARM_Unicorn::SaveContext(ThreadContext& ctx) {
     tregs[30] = (void*)&ctx.cpu_registers[30];
 
     CHECKED(uc_reg_read_batch(uc, uregs, tregs, 31));
+}
+
+void ARM_Unicorn::SaveVectorContext(ThreadContext& ctx) {
+    int uregs[32];
+    void* tregs[32];
 
     for (int i = 0; i < 32; ++i) {
         uregs[i] = UC_ARM64_REG_Q0 + i;
@@ -214,7 +219,7 @@ void ARM_Unicorn::SaveContext(ThreadContext& ctx) {
     CHECKED(uc_reg_read_batch(uc, uregs, tregs, 32));
 }
 
-void ARM_Unicorn::LoadContext(const ThreadContext& ctx) {
+void ARM_Unicorn::LoadGeneralContext(const ThreadContext& ctx) {
     int uregs[32];
     void* tregs[32];
 
@@ -232,6 +237,11 @@ void ARM_Unicorn::LoadContext(const ThreadContext& ctx) {
     tregs[30] = (void*)&ctx.cpu_registers[30];
 
     CHECKED(uc_reg_write_batch(uc, uregs, tregs, 31));
+}
+
+void ARM_Unicorn::LoadVectorContext(const ThreadContext& ctx) {
+    int uregs[32];
+    void* tregs[32];
 
     for (auto i = 0; i < 32; ++i) {
         uregs[i] = UC_ARM64_REG_Q0 + i;
@@ -245,6 +255,10 @@ void ARM_Unicorn::PrepareReschedule() {
     CHECKED(uc_emu_stop(uc));
 }
 
+void ARM_Unicorn::NotifyEventDue() {
+    CHECKED(uc_emu_stop(uc));
+}
+
 void ARM_Unicorn::ClearExclusiveState() {}
 
 void ARM_Unicorn::ClearInstructionCache() {}
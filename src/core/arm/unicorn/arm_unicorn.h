@@ -30,9 +30,12 @@ public:
     void SetTlsAddress(VAddr address) override;
     void SetTPIDR_EL0(u64 value) override;
     u64 GetTPIDR_EL0() const override;
-    void SaveContext(ThreadContext& ctx) override;
-    void LoadContext(const ThreadContext& ctx) override;
+    void SaveGeneralContext(ThreadContext& ctx) override;
+    void LoadGeneralContext(const ThreadContext& ctx) override;
+    void SaveVectorContext(ThreadContext& ctx) override;
+    void LoadVectorContext(const ThreadContext& ctx) override;
     void PrepareReschedule() override;
+    void NotifyEventDue() override;
     void ClearExclusiveState() override;
     void ExecuteInstructions(std::size_t num_instructions);
     void Run() override;
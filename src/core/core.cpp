@@ -26,11 +26,13 @@
 #include "core/file_sys/vfs_real.h"
 #include "core/gdbstub/gdbstub.h"
 #include "core/hardware_interrupt_manager.h"
+#include "core/hle/host_routines.h"
 #include "core/hle/kernel/client_port.h"
 #include "core/hle/kernel/kernel.h"
 #include "core/hle/kernel/process.h"
 #include "core/hle/kernel/scheduler.h"
 #include "core/hle/kernel/thread.h"
+#include "core/hle/lock.h"
 #include "core/hle/service/am/applets/applets.h"
 #include "core/hle/service/apm/controller.h"
 #include "core/hle/service/filesystem/filesystem.h"
@@ -113,7 +115,7 @@ FileSys::VirtualFile GetGameFileFromPath(const FileSys::VirtualFilesystem& vfs,
 }
 struct System::Impl {
     explicit Impl(System& system)
-        : kernel{system}, fs_controller{system}, memory{system},
+        : kernel{system}, fs_controller{system}, memory{system}, host_routines{system},
           cpu_core_manager{system}, reporter{system}, applet_manager{system} {}
 
     Cpu& CurrentCpuCore() {
@@ -131,6 +133,7 @@ struct System::Impl {
     ResultStatus Init(System& system, Frontend::EmuWindow& emu_window) {
         LOG_DEBUG(HW_Memory, "initialized OK");
 
+        core_timing.SetMaxSliceLength(Settings::values.cpu_timeslice);
         core_timing.Initialize();
         cpu_core_manager.Initialize();
         kernel.Initialize();
@@ -203,6 +206,11 @@ struct System::Impl {
         AddGlueRegistrationForProcess(*app_loader, *main_process);
         kernel.MakeCurrentProcess(main_process.get());
 
+        // Patch hot libc routines now that the modules are mapped in the current process.
+        if (Settings::values.use_host_routines) {
+            host_routines.PatchModules(*app_loader);
+        }
+
         // Main process has been loaded and been made current.
         // Begin GPU and CPU execution.
         gpu_core->Start();
@@ -256,6 +264,7 @@ struct System::Impl {
         }
 
         lm_manager.Flush();
+        HLE::LogLockStatistics();
 
         is_powered_on = false;
         exit_lock = false;
@@ -346,6 +355,7 @@ struct System::Impl {
     std::shared_ptr<Tegra::DebugContext> debug_context;
     std::unique_ptr<Hardware::InterruptManager> interrupt_manager;
     Memory::Memory memory;
+    HLE::HostRoutines host_routines;
     CpuCoreManager cpu_core_manager;
     bool is_powered_on = false;
     bool exit_lock = false;
@@ -510,6 +520,14 @@ const Memory::Memory& System::Memory() const {
     return impl->memory;
 }
 
+HLE::HostRoutines& System::HostRoutines() {
+    return impl->host_routines;
+}
+
+const HLE::HostRoutines& System::HostRoutines() const {
+    return impl->host_routines;
+}
+
 Tegra::GPU& System::GPU() {
     return *impl->gpu_core;
 }
@@ -518,6 +536,10 @@ const Tegra::GPU& System::GPU() const {
     return *impl->gpu_core;
 }
 
+void System::SetGPU(std::unique_ptr<Tegra::GPU> gpu) {
+    impl->gpu_core = std::move(gpu);
+}
+
 Core::Hardware::InterruptManager& System::InterruptManager() {
     return *impl->interrupt_manager;
 }
@@ -24,6 +24,10 @@ enum class ContentProviderUnionSlot;
 class VfsFilesystem;
 } // namespace FileSys
 
+namespace HLE {
+class HostRoutines;
+} // namespace HLE
+
 namespace Kernel {
 class GlobalScheduler;
 class KernelCore;
@@ -235,12 +239,21 @@ public:
     /// Gets a constant reference to the system memory instance.
     const Memory::Memory& Memory() const;
 
+    /// Gets a mutable reference to the host replacements of guest routines.
+    HLE::HostRoutines& HostRoutines();
+
+    /// Gets a constant reference to the host replacements of guest routines.
+    const HLE::HostRoutines& HostRoutines() const;
+
     /// Gets a mutable reference to the GPU interface
     Tegra::GPU& GPU();
 
     /// Gets an immutable reference to the GPU interface.
     const Tegra::GPU& GPU() const;
 
+    /// Replaces the GPU interface, so services can be run against a GPU without a renderer.
+    void SetGPU(std::unique_ptr<Tegra::GPU> gpu);
+
     /// Gets a mutable reference to the renderer.
     VideoCore::RendererBase& Renderer();
 
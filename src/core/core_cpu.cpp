@@ -113,6 +113,11 @@ void Cpu::PrepareReschedule() {
 }
 
 void Cpu::Reschedule() {
+    // Most slices end with the same thread selected, which only needs the scheduler lock.
+    if (global_scheduler.IsSelectionUpToDate(core_index)) {
+        return;
+    }
+
     // Lock the global kernel mutex when we manipulate the HLE state
     std::lock_guard lock(HLE::g_hle_lock);
 
@@ -15,7 +15,8 @@
 
 namespace Core::Timing {
 
-constexpr int MAX_SLICE_LENGTH = 10000;
+constexpr s64 MIN_SLICE_LENGTH = 1000;
+constexpr s64 MAX_SLICE_LENGTH = 1000000;
 
 std::shared_ptr<EventType> CreateEvent(std::string name, TimedCallback&& callback) {
     return std::make_shared<EventType>(std::move(callback), std::move(name));
@@ -38,13 +39,29 @@ struct CoreTiming::Event {
     }
 };
 
+struct CoreTiming::CoreEventRequest {
+    s64 time;
+    u64 userdata;
+    std::weak_ptr<EventType> type;
+    bool cancel;
+};
+
 CoreTiming::CoreTiming() = default;
 CoreTiming::~CoreTiming() = default;
 
+void CoreTiming::SetMaxSliceLength(s64 ticks) {
+    max_slice_length = std::clamp(ticks, MIN_SLICE_LENGTH, MAX_SLICE_LENGTH);
+}
+
+void CoreTiming::SetEventDueCallback(EventDueCallback callback) {
+    std::lock_guard guard{inner_mutex};
+    event_due_callback = std::move(callback);
+}
+
 void CoreTiming::Initialize() {
-    downcounts.fill(MAX_SLICE_LENGTH);
-    time_slice.fill(MAX_SLICE_LENGTH);
-    slice_length = MAX_SLICE_LENGTH;
+    downcounts.fill(max_slice_length);
+    time_slice.fill(max_slice_length);
+    slice_length = max_slice_length;
     global_timer = 0;
     idled_cycles = 0;
     current_context = 0;
@@ -56,6 +73,7 @@ void CoreTiming::Initialize() {
     is_global_timer_sane = true;
 
     event_fifo_id = 0;
+    PublishTicks();
 
     const auto empty_timed_callback = [](u64, s64) {};
     ev_lost = CreateEvent("_lost_event", empty_timed_callback);
@@ -70,16 +88,84 @@ void CoreTiming::ScheduleEvent(s64 cycles_into_future, const std::shared_ptr<Eve
     std::lock_guard guard{inner_mutex};
     const s64 timeout = GetTicks() + cycles_into_future;
 
-    // If this event needs to be scheduled before the next advance(), force one early
-    if (!is_global_timer_sane) {
-        ForceExceptionCheck(cycles_into_future);
-    }
+    CheckEventDue(cycles_into_future);
 
     event_queue.emplace_back(Event{timeout, event_fifo_id++, userdata, event_type});
 
     std::push_heap(event_queue.begin(), event_queue.end(), std::greater<>());
 }
 
+void CoreTiming::ScheduleCoreEvent(std::size_t core, s64 cycles_into_future,
+                                   const std::shared_ptr<EventType>& event_type, u64 userdata) {
+    // The published values may be a slice behind when posting from another thread, which only
+    // moves the deadline as much as reading the ticks before that slice ran would.
+    const s64 timeout = published_ticks.load(std::memory_order_relaxed) + cycles_into_future;
+    core_queues[core].mailbox.Push(timeout, userdata, event_type, false);
+    if (timeout >= published_slice_end.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    // The request is already posted, so an Advance running concurrently either applies it or
+    // finishes before the lock is taken here.
+    std::lock_guard guard{inner_mutex};
+    CheckEventDue(timeout - static_cast<s64>(GetTicks()));
+}
+
+void CoreTiming::UnscheduleCoreEvent(std::size_t core,
+                                     const std::shared_ptr<EventType>& event_type, u64 userdata) {
+    core_queues[core].mailbox.Push(s64{0}, userdata, event_type, true);
+}
+
+void CoreTiming::CheckEventDue(s64 cycles_into_future) {
+    // If this event needs to be scheduled before the next advance(), force one early. The CPU
+    // emulation only reads the downcount when it starts running, so it has to be stopped too.
+    if (is_global_timer_sane || cycles_into_future >= downcounts[current_context]) {
+        return;
+    }
+    ForceExceptionCheck(cycles_into_future);
+    if (event_due_callback) {
+        event_due_callback(current_context);
+    }
+}
+
+void CoreTiming::PublishTicks() {
+    const s64 ticks = static_cast<s64>(GetTicks());
+    published_ticks.store(ticks, std::memory_order_relaxed);
+    published_slice_end.store(ticks + downcounts[current_context], std::memory_order_relaxed);
+}
+
+void CoreTiming::DrainCoreMailboxes() {
+    for (CoreQueue& queue : core_queues) {
+        queue.mailbox.Drain([&](CoreEventRequest&& request) {
+            auto& events = queue.events;
+            if (!request.cancel) {
+                events.push_back(Event{request.time, event_fifo_id++, request.userdata,
+                                       std::move(request.type)});
+                std::push_heap(events.begin(), events.end(), std::greater<>());
+                return;
+            }
+            const auto type = request.type.lock();
+            const auto itr = std::remove_if(events.begin(), events.end(), [&](const Event& e) {
+                return e.type.lock() == type && e.userdata == request.userdata;
+            });
+            if (itr != events.end()) {
+                events.erase(itr, events.end());
+                std::make_heap(events.begin(), events.end(), std::greater<>());
+            }
+        });
+    }
+}
+
+std::vector<CoreTiming::Event>* CoreTiming::NextEventQueue() {
+    std::vector<Event>* next = event_queue.empty() ? nullptr : &event_queue;
+    for (CoreQueue& queue : core_queues) {
+        if (!queue.events.empty() && (!next || queue.events.front() < next->front())) {
+            next = &queue.events;
+        }
+    }
+    return next;
+}
+
 void CoreTiming::UnscheduleEvent(const std::shared_ptr<EventType>& event_type, u64 userdata) {
     std::lock_guard guard{inner_mutex};
 
@@ -109,23 +195,35 @@ u64 CoreTiming::GetIdleTicks() const {
 void CoreTiming::AddTicks(u64 ticks) {
     accumulated_ticks += ticks;
     downcounts[current_context] -= static_cast<s64>(ticks);
+    PublishTicks();
 }
 
 void CoreTiming::ClearPendingEvents() {
     event_queue.clear();
+    for (CoreQueue& queue : core_queues) {
+        queue.mailbox.Drain([](CoreEventRequest&&) {});
+        queue.events.clear();
+    }
 }
 
 void CoreTiming::RemoveEvent(const std::shared_ptr<EventType>& event_type) {
     std::lock_guard guard{inner_mutex};
+    DrainCoreMailboxes();
 
-    const auto itr = std::remove_if(event_queue.begin(), event_queue.end(), [&](const Event& e) {
-        return e.type.lock().get() == event_type.get();
-    });
+    const auto remove = [&](std::vector<Event>& queue) {
+        const auto itr = std::remove_if(queue.begin(), queue.end(), [&](const Event& e) {
+            return e.type.lock().get() == event_type.get();
+        });
 
-    // Removing random items breaks the invariant so we have to re-establish it.
-    if (itr != event_queue.end()) {
-        event_queue.erase(itr, event_queue.end());
-        std::make_heap(event_queue.begin(), event_queue.end(), std::greater<>());
+        // Removing random items breaks the invariant so we have to re-establish it.
+        if (itr != queue.end()) {
+            queue.erase(itr, queue.end());
+            std::make_heap(queue.begin(), queue.end(), std::greater<>());
+        }
+    };
+    remove(event_queue);
+    for (CoreQueue& queue : core_queues) {
+        remove(queue.events);
     }
 }
 
@@ -138,6 +236,7 @@ void CoreTiming::ForceExceptionCheck(s64 cycles) {
     // downcount is always (much) smaller than MAX_INT so we can safely cast cycles to an int
     // here. Account for cycles already executed by adjusting the g.slice_length
     downcounts[current_context] = static_cast<int>(cycles);
+    PublishTicks();
 }
 
 std::optional<u64> CoreTiming::NextAvailableCore(const s64 needed_ticks) const {
@@ -163,10 +262,16 @@ void CoreTiming::Advance() {
 
     is_global_timer_sane = true;
 
-    while (!event_queue.empty() && event_queue.front().time <= global_timer) {
-        Event evt = std::move(event_queue.front());
-        std::pop_heap(event_queue.begin(), event_queue.end(), std::greater<>());
-        event_queue.pop_back();
+    // Callbacks may post requests to the core mailboxes, apply them before every event.
+    while (true) {
+        DrainCoreMailboxes();
+        std::vector<Event>* const queue = NextEventQueue();
+        if (queue == nullptr || queue->front().time > global_timer) {
+            break;
+        }
+        Event evt = std::move(queue->front());
+        std::pop_heap(queue->begin(), queue->end(), std::greater<>());
+        queue->pop_back();
         inner_mutex.unlock();
 
         if (auto event_type{evt.type.lock()}) {
@@ -179,9 +284,9 @@ void CoreTiming::Advance() {
     is_global_timer_sane = false;
 
     // Still events left (scheduled in the future)
-    if (!event_queue.empty()) {
+    if (const std::vector<Event>* const queue = NextEventQueue()) {
         const s64 needed_ticks =
-            std::min<s64>(event_queue.front().time - global_timer, MAX_SLICE_LENGTH);
+            std::min<s64>(queue->front().time - global_timer, max_slice_length);
         const auto next_core = NextAvailableCore(needed_ticks);
         if (next_core) {
             downcounts[*next_core] = needed_ticks;
@@ -191,27 +296,32 @@ void CoreTiming::Advance() {
     accumulated_ticks = 0;
 
     downcounts[current_context] = time_slice[current_context];
+    PublishTicks();
 }
 
 void CoreTiming::ResetRun() {
-    downcounts.fill(MAX_SLICE_LENGTH);
-    time_slice.fill(MAX_SLICE_LENGTH);
+    std::lock_guard guard{inner_mutex};
+    downcounts.fill(max_slice_length);
+    time_slice.fill(max_slice_length);
     current_context = 0;
     // Still events left (scheduled in the future)
-    if (!event_queue.empty()) {
+    DrainCoreMailboxes();
+    if (const std::vector<Event>* const queue = NextEventQueue()) {
         const s64 needed_ticks =
-            std::min<s64>(event_queue.front().time - global_timer, MAX_SLICE_LENGTH);
+            std::min<s64>(queue->front().time - global_timer, max_slice_length);
         downcounts[current_context] = needed_ticks;
     }
 
     is_global_timer_sane = false;
     accumulated_ticks = 0;
+    PublishTicks();
 }
 
 void CoreTiming::Idle() {
     accumulated_ticks += downcounts[current_context];
     idled_cycles += downcounts[current_context];
     downcounts[current_context] = 0;
+    PublishTicks();
 }
 
 std::chrono::microseconds CoreTiming::GetGlobalTimeUs() const {
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <functional>
 #include <memory>
@@ -13,13 +15,16 @@
 #include <vector>
 
 #include "common/common_types.h"
-#include "common/threadsafe_queue.h"
+#include "common/mailbox.h"
 
 namespace Core::Timing {
 
 /// A callback that may be scheduled for a particular core timing event.
 using TimedCallback = std::function<void(u64 userdata, s64 cycles_late)>;
 
+/// A callback invoked when an event becomes due before the running slice of a context ends.
+using EventDueCallback = std::function<void(u64 context)>;
+
 /// Contains the characteristics of a particular event.
 struct EventType {
     EventType(TimedCallback&& callback, std::string&& name)
@@ -54,6 +59,22 @@ public:
     CoreTiming& operator=(const CoreTiming&) = delete;
     CoreTiming& operator=(CoreTiming&&) = delete;
 
+    /// Default length of the slice given to each context, in ticks.
+    static constexpr s64 DEFAULT_SLICE_LENGTH = 10000;
+
+    /// Sets the length of the slice given to each context, in ticks. Longer slices leave the
+    /// CPU emulation less often, events scheduled in between still end the slice early through
+    /// the event due callback. Takes effect on the next call to Initialize() or ResetRun().
+    void SetMaxSliceLength(s64 ticks);
+
+    s64 GetMaxSliceLength() const {
+        return max_slice_length;
+    }
+
+    /// Sets the callback used to stop the CPU emulation of a context when an event scheduled
+    /// during its slice becomes due before the slice ends.
+    void SetEventDueCallback(EventDueCallback callback);
+
     /// CoreTiming begins at the boundary of timing slice -1. An initial call to Advance() is
     /// required to end slice - 1 and start slice 0 before the first cycle of code is executed.
     void Initialize();
@@ -70,6 +91,18 @@ public:
 
     void UnscheduleEvent(const std::shared_ptr<EventType>& event_type, u64 userdata);
 
+    /// Schedules an event in the queue of a core, meant for events tied to a core such as thread
+    /// wakeups. It can be called from any thread. The deadline is taken from the published tick
+    /// count when the request is posted to the core's mailbox. The timing lock is only taken when
+    /// the deadline falls before the end of the running slice, to shorten that slice.
+    void ScheduleCoreEvent(std::size_t core, s64 cycles_into_future,
+                           const std::shared_ptr<EventType>& event_type, u64 userdata = 0);
+
+    /// Unschedules an event scheduled with ScheduleCoreEvent. It has to be requested on the same
+    /// core the event was scheduled on, so the requests are applied in order.
+    void UnscheduleCoreEvent(std::size_t core, const std::shared_ptr<EventType>& event_type,
+                             u64 userdata);
+
     /// We only permit one event of each type in the queue at a time.
     void RemoveEvent(const std::shared_ptr<EventType>& event_type);
 
@@ -101,6 +134,7 @@ public:
 
     void SwitchContext(u64 new_context) {
         current_context = new_context;
+        PublishTicks();
     }
 
     bool CanCurrentContextRun() const {
@@ -111,15 +145,39 @@ public:
 
 private:
     struct Event;
+    struct CoreEventRequest;
+
+    /// Events tied to a core. Requests are posted to the mailbox and moved to the heap when the
+    /// timing lock is held. Producers never block, but every core queue is still drained and
+    /// executed by whichever context advances timing, under the timing lock.
+    struct CoreQueue {
+        Common::Mailbox<CoreEventRequest> mailbox;
+        std::vector<Event> events;
+    };
 
     /// Clear all pending events. This should ONLY be done on exit.
     void ClearPendingEvents();
 
+    /// Applies the requests posted to the core mailboxes. Requires the timing lock.
+    void DrainCoreMailboxes();
+
+    /// Returns the queue with the earliest event, or nullptr when there are no events.
+    /// Requires the timing lock.
+    std::vector<Event>* NextEventQueue();
+
+    /// Shortens the running slice when an event is due before it ends. Requires the timing lock.
+    void CheckEventDue(s64 cycles_into_future);
+
+    /// Publishes the tick count and the end of the running slice for ScheduleCoreEvent. Called
+    /// by the context running the slice whenever either of them changes.
+    void PublishTicks();
+
     static constexpr u64 num_cpu_cores = 4;
 
     s64 global_timer = 0;
     s64 idled_cycles = 0;
     s64 slice_length = 0;
+    s64 max_slice_length = DEFAULT_SLICE_LENGTH;
     u64 accumulated_ticks = 0;
     std::array<s64, num_cpu_cores> downcounts{};
     // Slice of time assigned to each core per run.
@@ -138,7 +196,12 @@ private:
     std::vector<Event> event_queue;
     u64 event_fifo_id = 0;
 
+    std::array<CoreQueue, num_cpu_cores> core_queues;
+    std::atomic<s64> published_ticks{0};
+    std::atomic<s64> published_slice_end{0};
+
     std::shared_ptr<EventType> ev_lost;
+    EventDueCallback event_due_callback;
 
     std::mutex inner_mutex;
 };
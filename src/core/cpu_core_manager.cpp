@@ -3,6 +3,7 @@
 // Refer to the license.txt file included.
 
 #include "common/assert.h"
+#include "core/arm/arm_interface.h"
 #include "core/arm/exclusive_monitor.h"
 #include "core/core.h"
 #include "core/core_cpu.h"
@@ -30,6 +31,10 @@ void CpuCoreManager::Initialize() {
     for (std::size_t index = 0; index < cores.size(); ++index) {
         cores[index] = std::make_unique<Cpu>(system, *exclusive_monitor, *barrier, index);
     }
+
+    // Cores run until their slice ends, stop them early when an event becomes due before that.
+    system.CoreTiming().SetEventDueCallback(
+        [this](u64 context) { cores[context]->ArmInterface().NotifyEventDue(); });
 }
 
 void CpuCoreManager::StartThreads() {
@@ -48,6 +53,7 @@ void CpuCoreManager::StartThreads() {
 }
 
 void CpuCoreManager::Shutdown() {
+    system.CoreTiming().SetEventDueCallback({});
     barrier->NotifyEnd();
     if (Settings::values.use_multi_core) {
         for (auto& thread : core_threads) {
@@ -0,0 +1,235 @@
+// Copyright 2019 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <cstring>
+#include <emmintrin.h>
+#include <wmmintrin.h>
+#include "common/swap.h"
+#include "common/x64/cpu_detect.h"
+#include "core/crypto/aes_ni.h"
+
+// The rest of the codebase is not built with AES-NI enabled, so the functions using the
+// intrinsics have to opt in individually. MSVC allows intrinsics without any annotation.
+#ifdef _MSC_VER
+#define AESNI_TARGET
+#else
+#define AESNI_TARGET __attribute__((target("aes,sse2")))
+#endif
+
+namespace Core::Crypto::AESNI {
+namespace {
+constexpr std::size_t BLOCK_SIZE = 0x10;
+constexpr std::size_t NUM_ROUNDS = 10;
+
+// Number of blocks processed together to hide the latency of the AES instructions.
+constexpr std::size_t PIPELINE_WIDTH = 8;
+
+template <int rcon>
+AESNI_TARGET __m128i ExpandKeyStep(__m128i key) {
+    const __m128i assist = _mm_shuffle_epi32(_mm_aeskeygenassist_si128(key, rcon), 0xFF);
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    return _mm_xor_si128(key, assist);
+}
+
+struct RoundKeys {
+    explicit RoundKeys(const std::array<u8, 11 * 0x10>& bytes) {
+        for (std::size_t i = 0; i <= NUM_ROUNDS; ++i) {
+            keys[i] = _mm_load_si128(reinterpret_cast<const __m128i*>(bytes.data()) + i);
+        }
+    }
+
+    __m128i keys[NUM_ROUNDS + 1];
+};
+
+AESNI_TARGET __m128i EncryptBlock(const RoundKeys& rk, __m128i block) {
+    block = _mm_xor_si128(block, rk.keys[0]);
+    for (std::size_t i = 1; i < NUM_ROUNDS; ++i) {
+        block = _mm_aesenc_si128(block, rk.keys[i]);
+    }
+    return _mm_aesenclast_si128(block, rk.keys[NUM_ROUNDS]);
+}
+
+AESNI_TARGET __m128i DecryptBlock(const RoundKeys& rk, __m128i block) {
+    block = _mm_xor_si128(block, rk.keys[0]);
+    for (std::size_t i = 1; i < NUM_ROUNDS; ++i) {
+        block = _mm_aesdec_si128(block, rk.keys[i]);
+    }
+    return _mm_aesdeclast_si128(block, rk.keys[NUM_ROUNDS]);
+}
+
+AESNI_TARGET void EncryptBlocks(const RoundKeys& rk, __m128i (&blocks)[PIPELINE_WIDTH]) {
+    for (auto& block : blocks) {
+        block = _mm_xor_si128(block, rk.keys[0]);
+    }
+    for (std::size_t i = 1; i < NUM_ROUNDS; ++i) {
+        for (auto& block : blocks) {
+            block = _mm_aesenc_si128(block, rk.keys[i]);
+        }
+    }
+    for (auto& block : blocks) {
+        block = _mm_aesenclast_si128(block, rk.keys[NUM_ROUNDS]);
+    }
+}
+
+AESNI_TARGET void DecryptBlocks(const RoundKeys& rk, __m128i (&blocks)[PIPELINE_WIDTH]) {
+    for (auto& block : blocks) {
+        block = _mm_xor_si128(block, rk.keys[0]);
+    }
+    for (std::size_t i = 1; i < NUM_ROUNDS; ++i) {
+        for (auto& block : blocks) {
+            block = _mm_aesdec_si128(block, rk.keys[i]);
+        }
+    }
+    for (auto& block : blocks) {
+        block = _mm_aesdeclast_si128(block, rk.keys[NUM_ROUNDS]);
+    }
+}
+
+// Big-endian 128-bit counter, kept in host order between blocks.
+class Counter {
+public:
+    explicit Counter(const u8* bytes) {
+        std::memcpy(&high, bytes, sizeof(u64));
+        std::memcpy(&low, bytes + sizeof(u64), sizeof(u64));
+        high = Common::swap64(high);
+        low = Common::swap64(low);
+    }
+
+    AESNI_TARGET __m128i Next() {
+        const __m128i block = _mm_set_epi64x(static_cast<s64>(Common::swap64(low)),
+                                             static_cast<s64>(Common::swap64(high)));
+        if (++low == 0) {
+            ++high;
+        }
+        return block;
+    }
+
+    void Store(u8* bytes) const {
+        const u64 high_be = Common::swap64(high);
+        const u64 low_be = Common::swap64(low);
+        std::memcpy(bytes, &high_be, sizeof(u64));
+        std::memcpy(bytes + sizeof(u64), &low_be, sizeof(u64));
+    }
+
+private:
+    u64 high;
+    u64 low;
+};
+
+// Multiplies the tweak by the primitive element of GF(2^128), as specified by IEEE P1619.
+AESNI_TARGET __m128i MultiplyTweak(__m128i tweak) {
+    __m128i carry = _mm_srai_epi32(tweak, 31);
+    carry = _mm_shuffle_epi32(carry, 0x93);
+    carry = _mm_and_si128(carry, _mm_set_epi32(1, 1, 1, 0x87));
+    return _mm_xor_si128(_mm_add_epi32(tweak, tweak), carry);
+}
+} // Anonymous namespace
+
+bool IsSupported() {
+    return Common::GetCPUCaps().aes;
+}
+
+AESNI_TARGET void ExpandKey(const u8* key, KeySchedule& schedule) {
+    auto* const enc = reinterpret_cast<__m128i*>(schedule.encrypt.data());
+    auto* const dec = reinterpret_cast<__m128i*>(schedule.decrypt.data());
+
+    enc[0] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(key));
+    enc[1] = ExpandKeyStep<0x01>(enc[0]);
+    enc[2] = ExpandKeyStep<0x02>(enc[1]);
+    enc[3] = ExpandKeyStep<0x04>(enc[2]);
+    enc[4] = ExpandKeyStep<0x08>(enc[3]);
+    enc[5] = ExpandKeyStep<0x10>(enc[4]);
+    enc[6] = ExpandKeyStep<0x20>(enc[5]);
+    enc[7] = ExpandKeyStep<0x40>(enc[6]);
+    enc[8] = ExpandKeyStep<0x80>(enc[7]);
+    enc[9] = ExpandKeyStep<0x1B>(enc[8]);
+    enc[10] = ExpandKeyStep<0x36>(enc[9]);
+
+    // The equivalent inverse cipher uses the encryption keys in reverse order, with InvMixColumns
+    // applied to all but the first and last.
+    dec[0] = enc[NUM_ROUNDS];
+    for (std::size_t i = 1; i < NUM_ROUNDS; ++i) {
+        dec[i] = _mm_aesimc_si128(enc[NUM_ROUNDS - i]);
+    }
+    dec[NUM_ROUNDS] = enc[0];
+}
+
+AESNI_TARGET void TranscodeCTR(const KeySchedule& key, u8* counter, const u8* src,
+                               std::size_t size, u8* dest) {
+    const RoundKeys rk(key.encrypt);
+    Counter ctr(counter);
+
+    std::size_t offset = 0;
+    for (; size - offset >= PIPELINE_WIDTH * BLOCK_SIZE; offset += PIPELINE_WIDTH * BLOCK_SIZE) {
+        __m128i blocks[PIPELINE_WIDTH];
+        for (auto& block : blocks) {
+            block = ctr.Next();
+        }
+        EncryptBlocks(rk, blocks);
+        for (std::size_t i = 0; i < PIPELINE_WIDTH; ++i) {
+            const auto* in = reinterpret_cast<const __m128i*>(src + offset) + i;
+            auto* out = reinterpret_cast<__m128i*>(dest + offset) + i;
+            _mm_storeu_si128(out, _mm_xor_si128(blocks[i], _mm_loadu_si128(in)));
+        }
+    }
+
+    for (; size - offset >= BLOCK_SIZE; offset += BLOCK_SIZE) {
+        const __m128i keystream = EncryptBlock(rk, ctr.Next());
+        const auto* in = reinterpret_cast<const __m128i*>(src + offset);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + offset),
+                         _mm_xor_si128(keystream, _mm_loadu_si128(in)));
+    }
+
+    if (offset != size) {
+        alignas(16) u8 keystream[BLOCK_SIZE];
+        _mm_store_si128(reinterpret_cast<__m128i*>(keystream), EncryptBlock(rk, ctr.Next()));
+        for (std::size_t i = 0; offset + i < size; ++i) {
+            dest[offset + i] = src[offset + i] ^ keystream[i];
+        }
+    }
+
+    ctr.Store(counter);
+}
+
+AESNI_TARGET void TranscodeXTS(const KeySchedule& data_key, const KeySchedule& tweak_key,
+                               const u8* tweak, const u8* src, std::size_t size, u8* dest,
+                               bool encrypt) {
+    const RoundKeys data_rk(encrypt ? data_key.encrypt : data_key.decrypt);
+    const RoundKeys tweak_rk(tweak_key.encrypt);
+
+    __m128i t = EncryptBlock(tweak_rk, _mm_loadu_si128(reinterpret_cast<const __m128i*>(tweak)));
+
+    std::size_t offset = 0;
+    for (; size - offset >= PIPELINE_WIDTH * BLOCK_SIZE; offset += PIPELINE_WIDTH * BLOCK_SIZE) {
+        __m128i tweaks[PIPELINE_WIDTH];
+        __m128i blocks[PIPELINE_WIDTH];
+        for (std::size_t i = 0; i < PIPELINE_WIDTH; ++i) {
+            const auto* in = reinterpret_cast<const __m128i*>(src + offset) + i;
+            tweaks[i] = t;
+            blocks[i] = _mm_xor_si128(_mm_loadu_si128(in), t);
+            t = MultiplyTweak(t);
+        }
+        if (encrypt) {
+            EncryptBlocks(data_rk, blocks);
+        } else {
+            DecryptBlocks(data_rk, blocks);
+        }
+        for (std::size_t i = 0; i < PIPELINE_WIDTH; ++i) {
+            auto* out = reinterpret_cast<__m128i*>(dest + offset) + i;
+            _mm_storeu_si128(out, _mm_xor_si128(blocks[i], tweaks[i]));
+        }
+    }
+
+    for (; offset < size; offset += BLOCK_SIZE) {
+        const auto* in = reinterpret_cast<const __m128i*>(src + offset);
+        __m128i block = _mm_xor_si128(_mm_loadu_si128(in), t);
+        block = encrypt ? EncryptBlock(data_rk, block) : DecryptBlock(data_rk, block);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + offset), _mm_xor_si128(block, t));
+        t = MultiplyTweak(t);
+    }
+}
+
+} // namespace Core::Crypto::AESNI
@@ -0,0 +1,40 @@
+// Copyright 2019 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include "common/common_types.h"
+
+// Hardware accelerated AES-128 CTR and XTS used by AESCipher on x86-64 hosts. Only compiled when
+// targetting x86-64; callers must check IsSupported() before using any other function here.
+namespace Core::Crypto::AESNI {
+
+/// Expanded AES-128 round keys for both encryption and decryption.
+struct KeySchedule {
+    alignas(16) std::array<u8, 11 * 0x10> encrypt;
+    alignas(16) std::array<u8, 11 * 0x10> decrypt;
+};
+
+/// Returns whether the host CPU supports the AES-NI instruction set.
+bool IsSupported();
+
+/// Expands the 16-byte key at `key` into `schedule`.
+void ExpandKey(const u8* key, KeySchedule& schedule);
+
+/**
+ * Transcodes `size` bytes in CTR mode. The 128-bit big-endian counter at `counter` is advanced by
+ * the number of (possibly partial) blocks consumed, matching mbedtls behaviour.
+ */
+void TranscodeCTR(const KeySchedule& key, u8* counter, const u8* src, std::size_t size, u8* dest);
+
+/**
+ * Transcodes `size` bytes of a single XTS data unit whose raw tweak is `tweak`. `size` must be a
+ * multiple of the AES block size, as ciphertext stealing is not implemented.
+ */
+void TranscodeXTS(const KeySchedule& data_key, const KeySchedule& tweak_key, const u8* tweak,
+                  const u8* src, std::size_t size, u8* dest, bool encrypt);
+
+} // namespace Core::Crypto::AESNI
@@ -2,16 +2,23 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
+#include <array>
+#include <cstring>
 #include <mbedtls/cipher.h>
 #include "common/assert.h"
 #include "common/logging/log.h"
 #include "core/crypto/aes_util.h"
 #include "core/crypto/key_manager.h"
 
+#ifdef ARCHITECTURE_x86_64
+#include "core/crypto/aes_ni.h"
+#endif
+
 namespace Core::Crypto {
 namespace {
-std::vector<u8> CalculateNintendoTweak(std::size_t sector_id) {
-    std::vector<u8> out(0x10);
+std::array<u8, 0x10> CalculateNintendoTweak(std::size_t sector_id) {
+    std::array<u8, 0x10> out{};
     for (std::size_t i = 0xF; i <= 0xF; --i) {
         out[i] = sector_id & 0xFF;
         sector_id >>= 8;
@@ -34,6 +41,16 @@ static_assert(static_cast<std::size_t>(Mode::XTS) ==
 struct CipherContext {
     mbedtls_cipher_context_t encryption_context;
     mbedtls_cipher_context_t decryption_context;
+
+#ifdef ARCHITECTURE_x86_64
+    // Hardware path for CTR and XTS, used instead of mbedtls when the host supports AES-NI.
+    // For XTS, aesni_key holds the data key and aesni_tweak_key the tweak key.
+    bool use_aesni = false;
+    Mode mode;
+    AESNI::KeySchedule aesni_key;
+    AESNI::KeySchedule aesni_tweak_key;
+    std::array<u8, 0x10> iv{};
+#endif
 };
 
 template <typename Key, std::size_t KeySize>
@@ -55,6 +72,20 @@ Crypto::AESCipher<Key, KeySize>::AESCipher(Key key, Mode mode)
     ASSERT(
         !mbedtls_cipher_setkey(&ctx->decryption_context, key.data(), KeySize * 8, MBEDTLS_DECRYPT));
     //"Failed to set key on mbedtls ciphers.");
+
+#ifdef ARCHITECTURE_x86_64
+    ctx->mode = mode;
+    if (AESNI::IsSupported()) {
+        if (mode == Mode::CTR && KeySize == 0x10) {
+            AESNI::ExpandKey(key.data(), ctx->aesni_key);
+            ctx->use_aesni = true;
+        } else if (mode == Mode::XTS && KeySize == 0x20) {
+            AESNI::ExpandKey(key.data(), ctx->aesni_key);
+            AESNI::ExpandKey(key.data() + 0x10, ctx->aesni_tweak_key);
+            ctx->use_aesni = true;
+        }
+    }
+#endif
 }
 
 template <typename Key, std::size_t KeySize>
@@ -65,6 +96,14 @@ AESCipher<Key, KeySize>::~AESCipher() {
 
 template <typename Key, std::size_t KeySize>
 void AESCipher<Key, KeySize>::SetIV(std::vector<u8> iv) {
+#ifdef ARCHITECTURE_x86_64
+    if (ctx->use_aesni) {
+        ctx->iv.fill(0);
+        std::memcpy(ctx->iv.data(), iv.data(), std::min(iv.size(), ctx->iv.size()));
+        return;
+    }
+#endif
+
     ASSERT_MSG((mbedtls_cipher_set_iv(&ctx->encryption_context, iv.data(), iv.size()) ||
                 mbedtls_cipher_set_iv(&ctx->decryption_context, iv.data(), iv.size())) == 0,
                "Failed to set IV on mbedtls ciphers.");
@@ -72,6 +111,23 @@ void AESCipher<Key, KeySize>::SetIV(std::vector<u8> iv) {
 
 template <typename Key, std::size_t KeySize>
 void AESCipher<Key, KeySize>::Transcode(const u8* src, std::size_t size, u8* dest, Op op) const {
+#ifdef ARCHITECTURE_x86_64
+    if (ctx->use_aesni) {
+        if (ctx->mode == Mode::CTR) {
+            AESNI::TranscodeCTR(ctx->aesni_key, ctx->iv.data(), src, size, dest);
+            return;
+        }
+        if (size % 0x10 == 0) {
+            AESNI::TranscodeXTS(ctx->aesni_key, ctx->aesni_tweak_key, ctx->iv.data(), src, size,
+                                dest, op == Op::Encrypt);
+            return;
+        }
+        // XTS with ciphertext stealing is left to mbedtls.
+        ASSERT(!mbedtls_cipher_set_iv(&ctx->encryption_context, ctx->iv.data(), ctx->iv.size()));
+        ASSERT(!mbedtls_cipher_set_iv(&ctx->decryption_context, ctx->iv.data(), ctx->iv.size()));
+    }
+#endif
+
     auto* const context = op == Op::Encrypt ? &ctx->encryption_context : &ctx->decryption_context;
 
     mbedtls_cipher_reset(context);
@@ -118,8 +174,20 @@ void AESCipher<Key, KeySize>::XTSTranscode(const u8* src, std::size_t size, u8*
                                            std::size_t sector_id, std::size_t sector_size, Op op) {
     ASSERT_MSG(size % sector_size == 0, "XTS decryption size must be a multiple of sector size.");
 
+#ifdef ARCHITECTURE_x86_64
+    if (ctx->use_aesni && sector_size % 0x10 == 0) {
+        for (std::size_t i = 0; i < size; i += sector_size) {
+            const auto tweak = CalculateNintendoTweak(sector_id++);
+            AESNI::TranscodeXTS(ctx->aesni_key, ctx->aesni_tweak_key, tweak.data(), src + i,
+                                sector_size, dest + i, op == Op::Encrypt);
+        }
+        return;
+    }
+#endif
+
     for (std::size_t i = 0; i < size; i += sector_size) {
-        SetIV(CalculateNintendoTweak(sector_id++));
+        const auto tweak = CalculateNintendoTweak(sector_id++);
+        SetIV({tweak.begin(), tweak.end()});
         Transcode<u8, u8>(src + i, sector_size, dest + i, op);
     }
 }
@@ -2,6 +2,7 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <array>
 #include <cstring>
 #include "common/assert.h"
 #include "core/crypto/ctr_encryption_layer.h"
@@ -13,20 +14,22 @@ CTREncryptionLayer::CTREncryptionLayer(FileSys::VirtualFile base_, Key128 key_,
     : EncryptionLayer(std::move(base_)), base_offset(base_offset), cipher(key_, Mode::CTR),
       iv(16, 0) {}
 
-std::size_t CTREncryptionLayer::Read(u8* data, std::size_t length, std::size_t offset) const {
+std::size_t CTREncryptionLayer::ReadDecrypted(u8* data, std::size_t length,
+                                              std::size_t offset) const {
     if (length == 0)
         return 0;
 
     const auto sector_offset = offset & 0xF;
     if (sector_offset == 0) {
         UpdateIV(base_offset + offset);
-        std::vector<u8> raw = base->ReadBytes(length, offset);
-        cipher.Transcode(raw.data(), raw.size(), data, Op::Decrypt);
+        const std::size_t raw_size = base->Read(data, length, offset);
+        cipher.Transcode(data, raw_size, data, Op::Decrypt);
         return length;
     }
 
     // offset does not fall on block boundary (0x10)
-    std::vector<u8> block = base->ReadBytes(0x10, offset - sector_offset);
+    std::array<u8, 0x10> block{};
+    base->Read(block.data(), block.size(), offset - sector_offset);
     UpdateIV(base_offset + offset - sector_offset);
     cipher.Transcode(block.data(), block.size(), block.data(), Op::Decrypt);
     std::size_t read = 0x10 - sector_offset;
@@ -36,12 +39,13 @@ std::size_t CTREncryptionLayer::Read(u8* data, std::size_t length, std::size_t o
         return std::min<u64>(length, read);
     }
     std::memcpy(data, block.data() + sector_offset, read);
-    return read + Read(data + read, length - read, offset + read);
+    return read + ReadDecrypted(data + read, length - read, offset + read);
 }
 
 void CTREncryptionLayer::SetIV(const std::vector<u8>& iv_) {
     const auto length = std::min(iv_.size(), iv.size());
     iv.assign(iv_.cbegin(), iv_.cbegin() + length);
+    InvalidateCache();
 }
 
 void CTREncryptionLayer::UpdateIV(std::size_t offset) const {
@@ -16,10 +16,11 @@ class CTREncryptionLayer : public EncryptionLayer {
 public:
     CTREncryptionLayer(FileSys::VirtualFile base, Key128 key, std::size_t base_offset);
 
-    std::size_t Read(u8* data, std::size_t length, std::size_t offset) const override;
-
     void SetIV(const std::vector<u8>& iv);
 
+protected:
+    std::size_t ReadDecrypted(u8* data, std::size_t length, std::size_t offset) const override;
+
 private:
     std::size_t base_offset;
 
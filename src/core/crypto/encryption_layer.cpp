@@ -2,11 +2,85 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
+#include <cstring>
+#include <vector>
 #include "core/crypto/encryption_layer.h"
+#include "core/crypto/sector_cache.h"
 
 namespace Core::Crypto {
 
-EncryptionLayer::EncryptionLayer(FileSys::VirtualFile base_) : base(std::move(base_)) {}
+namespace {
+constexpr std::size_t SECTOR_SIZE = SectorCache::SECTOR_SIZE;
+
+// Number of sectors decrypted beyond the end of a read that continues the previous one.
+constexpr std::size_t READ_AHEAD_SECTORS = 8;
+
+// Reads spanning more sectors than this decrypt straight into the caller's buffer, as caching them
+// would only evict the small, frequently re-read sectors the cache exists for.
+constexpr std::size_t MAX_CACHED_SECTORS = 16;
+} // Anonymous namespace
+
+EncryptionLayer::EncryptionLayer(FileSys::VirtualFile base_)
+    : base(std::move(base_)), cache_id(SectorCache::Get().AllocateID()) {}
+
+std::size_t EncryptionLayer::Read(u8* data, std::size_t length, std::size_t offset) const {
+    auto& cache = SectorCache::Get();
+    const std::size_t size = GetSize();
+    if (length == 0 || offset >= size || !cache.IsEnabled()) {
+        return ReadDecrypted(data, length, offset);
+    }
+
+    length = std::min(length, size - offset);
+    const std::size_t first_sector = offset / SECTOR_SIZE;
+    const std::size_t last_sector = (offset + length - 1) / SECTOR_SIZE;
+    const std::size_t previous_end =
+        next_sequential_sector.exchange(last_sector + 1, std::memory_order_relaxed);
+    if (last_sector - first_sector >= MAX_CACHED_SECTORS) {
+        return ReadDecrypted(data, length, offset);
+    }
+
+    // A read that starts where the last one ended, or within its final sector, is sequential.
+    const bool sequential = first_sector == previous_end || first_sector + 1 == previous_end;
+
+    std::size_t read = 0;
+    for (std::size_t sector = first_sector; sector <= last_sector; ++sector) {
+        const std::size_t sector_offset = (offset + read) % SECTOR_SIZE;
+        const std::size_t to_copy = std::min(SECTOR_SIZE - sector_offset, length - read);
+        if (cache.Read(cache_id, sector, data + read, sector_offset, to_copy)) {
+            read += to_copy;
+            continue;
+        }
+
+        // Decrypt every remaining sector of the request in one go, plus read-ahead if sequential.
+        const std::size_t sector_count = (size + SECTOR_SIZE - 1) / SECTOR_SIZE;
+        const std::size_t run_end =
+            std::min(last_sector + 1 + (sequential ? READ_AHEAD_SECTORS : 0), sector_count);
+        const std::size_t run_offset = sector * SECTOR_SIZE;
+        const std::size_t run_size = std::min(run_end * SECTOR_SIZE, size) - run_offset;
+
+        std::vector<u8> scratch(run_size);
+        const std::size_t decrypted = ReadDecrypted(scratch.data(), run_size, run_offset);
+        for (std::size_t i = 0; i * SECTOR_SIZE < decrypted; ++i) {
+            cache.Insert(cache_id, sector + i, scratch.data() + i * SECTOR_SIZE,
+                         std::min(SECTOR_SIZE, decrypted - i * SECTOR_SIZE));
+        }
+
+        if (decrypted <= sector_offset) {
+            return read;
+        }
+        const std::size_t available = std::min(decrypted - sector_offset, length - read);
+        std::memcpy(data + read, scratch.data() + sector_offset, available);
+        return read + available;
+    }
+
+    return read;
+}
+
+void EncryptionLayer::InvalidateCache() {
+    // Stale entries are never looked up again and simply age out of the cache.
+    cache_id = SectorCache::Get().AllocateID();
+}
 
 std::string EncryptionLayer::GetName() const {
     return base->GetName();
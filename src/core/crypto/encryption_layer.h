@@ -4,18 +4,20 @@
 
 #pragma once
 
+#include <atomic>
 #include "common/common_types.h"
 #include "core/file_sys/vfs.h"
 
 namespace Core::Crypto {
 
 // Basically non-functional class that implements all of the methods that are irrelevant to an
-// EncryptionLayer. Reduces duplicate code.
+// EncryptionLayer. Reduces duplicate code. Reads go through the shared SectorCache, so derived
+// classes only have to provide ReadDecrypted.
 class EncryptionLayer : public FileSys::VfsFile {
 public:
     explicit EncryptionLayer(FileSys::VirtualFile base);
 
-    std::size_t Read(u8* data, std::size_t length, std::size_t offset) const override = 0;
+    std::size_t Read(u8* data, std::size_t length, std::size_t offset) const override;
 
     std::string GetName() const override;
     std::size_t GetSize() const override;
@@ -27,7 +29,20 @@ public:
     bool Rename(std::string_view name) override;
 
 protected:
+    // Reads and decrypts directly from the base file, bypassing the sector cache.
+    virtual std::size_t ReadDecrypted(u8* data, std::size_t length, std::size_t offset) const = 0;
+
+    // Must be called whenever previously decrypted data becomes stale, e.g. on a key or IV change.
+    void InvalidateCache();
+
     FileSys::VirtualFile base;
+
+private:
+    u64 cache_id;
+
+    // Sector following the last one read, used to detect sequential access for read-ahead. It is
+    // only a hint, concurrent readers may overwrite each other's value.
+    mutable std::atomic<std::size_t> next_sequential_sector{0};
 };
 
 } // namespace Core::Crypto
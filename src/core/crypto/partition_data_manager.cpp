@@ -9,8 +9,11 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cctype>
 #include <cstring>
+#include <mutex>
+#include <thread>
 #include <mbedtls/sha256.h>
 #include "common/assert.h"
 #include "common/common_funcs.h"
@@ -153,25 +156,98 @@ static u8 CalculateMaxKeyblobSourceHash() {
 
 const u8 PartitionDataManager::MAX_KEYBLOB_SOURCE_HASH = CalculateMaxKeyblobSourceHash();
 
+namespace {
+// Scans below this many offsets per thread are not worth spawning threads for.
+constexpr std::size_t MIN_OFFSETS_PER_WORKER = 0x10000;
+
+// Keys are uniformly random, so a 16-byte key has fewer than 10 distinct byte values with a
+// probability of ~1e-8 and a 32-byte key fewer than 21 with ~4e-9. Windows below these thresholds
+// (padding, tables, strings and most code) are skipped without being hashed or decrypted.
+constexpr std::size_t MinDistinctBytes(std::size_t key_size) {
+    return key_size == 0x10 ? 10 : 21;
+}
+
+// Splits the offsets [0, count) into contiguous ranges and calls worker(begin, end) for each of
+// them on its own thread, returning once all of them are done.
+template <typename Worker>
+void RunParallelScan(std::size_t count, Worker&& worker) {
+    const std::size_t num_workers = std::clamp<std::size_t>(
+        count / MIN_OFFSETS_PER_WORKER, 1, std::max(1U, std::thread::hardware_concurrency()));
+    if (num_workers == 1) {
+        worker(std::size_t{0}, count);
+        return;
+    }
+
+    const std::size_t bucket_size = count / num_workers;
+    std::vector<std::thread> threads(num_workers);
+    for (std::size_t i = 0; i < num_workers; ++i) {
+        const bool is_last_worker = i + 1 == num_workers;
+        const std::size_t start = bucket_size * i;
+        const std::size_t end = is_last_worker ? count : start + bucket_size;
+        threads[i] = std::thread(worker, start, end);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+// Calls visit(offset) for each offset in [begin, end) whose window_size-byte window passes the
+// distinct byte pre-filter. The byte histogram is updated incrementally as the window slides, so
+// rejecting a window costs a couple of table updates. Returns early once stop is set.
+template <typename Visitor>
+void ScanCandidates(const u8* data, std::size_t begin, std::size_t end, std::size_t window_size,
+                    const std::atomic_bool& stop, Visitor&& visit) {
+    const std::size_t min_distinct = MinDistinctBytes(window_size);
+    std::array<u8, 0x100> counts{};
+    std::size_t distinct = 0;
+    for (std::size_t i = begin; i < begin + window_size; ++i) {
+        if (counts[data[i]]++ == 0)
+            ++distinct;
+    }
+
+    for (std::size_t offset = begin; offset < end; ++offset) {
+        if (offset != begin) {
+            if (--counts[data[offset - 1]] == 0)
+                --distinct;
+            if (counts[data[offset + window_size - 1]]++ == 0)
+                ++distinct;
+        }
+
+        if (distinct >= min_distinct)
+            visit(offset);
+
+        if ((offset & 0xFFF) == 0 && stop)
+            return;
+    }
+}
+} // Anonymous namespace
+
 template <size_t key_size = 0x10>
 std::array<u8, key_size> FindKeyFromHex(const std::vector<u8>& binary,
                                         const std::array<u8, 0x20>& hash) {
     if (binary.size() < key_size)
         return {};
 
-    std::array<u8, 0x20> temp{};
-    for (size_t i = 0; i < binary.size() - key_size; ++i) {
-        mbedtls_sha256_ret(binary.data() + i, key_size, temp.data(), 0);
-
-        if (temp != hash)
-            continue;
-
-        std::array<u8, key_size> out{};
-        std::memcpy(out.data(), binary.data() + i, key_size);
-        return out;
-    }
+    std::atomic_bool found{false};
+    std::atomic<std::size_t> found_offset{0};
+    RunParallelScan(binary.size() - key_size + 1, [&](std::size_t begin, std::size_t end) {
+        std::array<u8, 0x20> temp{};
+        ScanCandidates(binary.data(), begin, end, key_size, found, [&](std::size_t offset) {
+            mbedtls_sha256_ret(binary.data() + offset, key_size, temp.data(), 0);
+            if (temp != hash)
+                return;
+
+            found_offset = offset;
+            found = true;
+        });
+    });
+
+    if (!found)
+        return {};
 
-    return {};
+    std::array<u8, key_size> out{};
+    std::memcpy(out.data(), binary.data() + found_offset, key_size);
+    return out;
 }
 
 std::array<u8, 16> FindKeyFromHex16(const std::vector<u8>& binary, std::array<u8, 32> hash) {
@@ -183,21 +259,34 @@ static std::array<Key128, 0x20> FindEncryptedMasterKeyFromHex(const std::vector<
     if (binary.size() < 0x10)
         return {};
 
-    SHA256Hash temp{};
-    Key128 dec_temp{};
+    // The ciphertext of a random key is just as random, so the pre-filter applies to it too.
+    const std::atomic_bool stop{false};
+    std::mutex out_mutex;
     std::array<Key128, 0x20> out{};
-    AESCipher<Key128> cipher(key, Mode::ECB);
-    for (size_t i = 0; i < binary.size() - 0x10; ++i) {
-        cipher.Transcode(binary.data() + i, dec_temp.size(), dec_temp.data(), Op::Decrypt);
-        mbedtls_sha256_ret(dec_temp.data(), dec_temp.size(), temp.data(), 0);
+    RunParallelScan(binary.size() - 0x10 + 1, [&](std::size_t begin, std::size_t end) {
+        SHA256Hash temp{};
+        Key128 dec_temp{};
+        std::array<Key128, 0x20> found{};
+        AESCipher<Key128> cipher(key, Mode::ECB);
+        ScanCandidates(binary.data(), begin, end, dec_temp.size(), stop, [&](std::size_t offset) {
+            cipher.Transcode(binary.data() + offset, dec_temp.size(), dec_temp.data(),
+                             Op::Decrypt);
+            mbedtls_sha256_ret(dec_temp.data(), dec_temp.size(), temp.data(), 0);
+
+            for (size_t k = 0; k < found.size(); ++k) {
+                if (temp == master_key_hashes[k]) {
+                    found[k] = dec_temp;
+                    break;
+                }
+            }
+        });
 
+        std::lock_guard lock{out_mutex};
         for (size_t k = 0; k < out.size(); ++k) {
-            if (temp == master_key_hashes[k]) {
-                out[k] = dec_temp;
-                break;
-            }
+            if (found[k] != Key128{})
+                out[k] = found[k];
         }
-    }
+    });
 
     return out;
 }
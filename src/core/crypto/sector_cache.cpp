@@ -0,0 +1,112 @@
+// Copyright 2019 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include "common/assert.h"
+#include "core/crypto/sector_cache.h"
+
+namespace Core::Crypto {
+
+SectorCache::SectorCache(std::size_t capacity) {
+    SetCapacity(capacity);
+}
+
+SectorCache::~SectorCache() = default;
+
+SectorCache& SectorCache::Get() {
+    static SectorCache cache;
+    return cache;
+}
+
+u64 SectorCache::AllocateID() {
+    return next_id++;
+}
+
+void SectorCache::SetCapacity(std::size_t capacity) {
+    const std::size_t max_entries = capacity / SECTOR_SIZE / NUM_SHARDS;
+    for (auto& shard : shards) {
+        std::lock_guard lock{shard.mutex};
+        shard.max_entries = max_entries;
+        shard.Trim();
+    }
+    enabled = max_entries != 0;
+}
+
+bool SectorCache::IsEnabled() const {
+    return enabled;
+}
+
+bool SectorCache::Read(u64 id, u64 sector, u8* out, std::size_t offset, std::size_t length) {
+    auto& shard = GetShard(id, sector);
+    std::lock_guard lock{shard.mutex};
+
+    const auto iter = shard.lookup.find({id, sector});
+    if (iter == shard.lookup.end()) {
+        return false;
+    }
+
+    const auto& data = iter->second->data;
+    if (offset + length > data.size()) {
+        return false;
+    }
+
+    std::memcpy(out, data.data() + offset, length);
+    shard.entries.splice(shard.entries.begin(), shard.entries, iter->second);
+    return true;
+}
+
+void SectorCache::Insert(u64 id, u64 sector, const u8* data, std::size_t size) {
+    ASSERT(size <= SECTOR_SIZE);
+
+    auto& shard = GetShard(id, sector);
+    std::lock_guard lock{shard.mutex};
+    if (shard.max_entries == 0) {
+        return;
+    }
+
+    const Key key{id, sector};
+    const auto iter = shard.lookup.find(key);
+    if (iter == shard.lookup.end()) {
+        if (shard.entries.size() < shard.max_entries) {
+            shard.entries.emplace_front();
+        } else {
+            // Recycle the least recently used entry and its buffer instead of allocating.
+            shard.lookup.erase(shard.entries.back().key);
+            shard.entries.splice(shard.entries.begin(), shard.entries,
+                                 std::prev(shard.entries.end()));
+        }
+        shard.entries.front().key = key;
+        shard.lookup.emplace(key, shard.entries.begin());
+    } else {
+        shard.entries.splice(shard.entries.begin(), shard.entries, iter->second);
+    }
+
+    auto& entry = shard.entries.front();
+    entry.data.resize(size);
+    std::memcpy(entry.data.data(), data, size);
+}
+
+void SectorCache::Clear() {
+    for (auto& shard : shards) {
+        std::lock_guard lock{shard.mutex};
+        shard.entries.clear();
+        shard.lookup.clear();
+    }
+}
+
+void SectorCache::Shard::Trim() {
+    while (entries.size() > max_entries) {
+        lookup.erase(entries.back().key);
+        entries.pop_back();
+    }
+}
+
+SectorCache::Shard& SectorCache::GetShard(u64 id, u64 sector) {
+    // Consecutive sectors of one layer land in different shards.
+    return shards[(sector + id) % NUM_SHARDS];
+}
+
+} // namespace Core::Crypto
@@ -0,0 +1,96 @@
+// Copyright 2019 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "common/common_types.h"
+
+namespace Core::Crypto {
+
+/**
+ * Process-wide LRU cache of decrypted sectors shared by all encryption layers. Entries are keyed
+ * by a per-layer ID and the sector index within that layer, and are spread across several
+ * independently locked shards so concurrent readers of different sectors do not contend.
+ */
+class SectorCache {
+public:
+    static constexpr std::size_t SECTOR_SIZE = 0x4000;
+
+    /// Default memory budget used until the frontend applies the configured one.
+    static constexpr std::size_t DEFAULT_CAPACITY = 0x4000000;
+
+    explicit SectorCache(std::size_t capacity = DEFAULT_CAPACITY);
+    ~SectorCache();
+
+    /// Returns the cache shared by all encryption layers.
+    static SectorCache& Get();
+
+    /// Returns a cache ID that has never been handed out before.
+    u64 AllocateID();
+
+    /// Sets the memory budget in bytes, evicting entries if necessary. Zero disables the cache.
+    void SetCapacity(std::size_t capacity);
+
+    bool IsEnabled() const;
+
+    /**
+     * Copies `length` bytes starting at `offset` within the given sector to `out`.
+     * @return true if the sector was cached and held enough data, false otherwise.
+     */
+    bool Read(u64 id, u64 sector, u8* out, std::size_t offset, std::size_t length);
+
+    /// Inserts a decrypted sector of at most SECTOR_SIZE bytes, replacing any existing entry.
+    void Insert(u64 id, u64 sector, const u8* data, std::size_t size);
+
+    /// Drops all cached sectors.
+    void Clear();
+
+private:
+    static constexpr std::size_t NUM_SHARDS = 16;
+
+    struct Key {
+        u64 id;
+        u64 sector;
+
+        bool operator==(const Key& rhs) const {
+            return id == rhs.id && sector == rhs.sector;
+        }
+    };
+
+    struct KeyHash {
+        std::size_t operator()(const Key& key) const {
+            return static_cast<std::size_t>((key.id * 0x9E3779B97F4A7C15ULL) ^ key.sector);
+        }
+    };
+
+    struct Entry {
+        Key key;
+        std::vector<u8> data;
+    };
+
+    struct Shard {
+        std::mutex mutex;
+        // Most recently used entries are at the front.
+        std::list<Entry> entries;
+        std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> lookup;
+        std::size_t max_entries = 0;
+
+        void Trim();
+    };
+
+    Shard& GetShard(u64 id, u64 sector);
+
+    std::array<Shard, NUM_SHARDS> shards;
+    std::atomic<u64> next_id{1};
+    std::atomic_bool enabled{false};
+};
+
+} // namespace Core::Crypto
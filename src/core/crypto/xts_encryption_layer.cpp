@@ -3,6 +3,7 @@
 // Refer to the license.txt file included.
 
 #include <algorithm>
+#include <array>
 #include <cstring>
 #include "common/assert.h"
 #include "core/crypto/xts_encryption_layer.h"
@@ -14,26 +15,33 @@ constexpr u64 XTS_SECTOR_SIZE = 0x4000;
 XTSEncryptionLayer::XTSEncryptionLayer(FileSys::VirtualFile base_, Key256 key_)
     : EncryptionLayer(std::move(base_)), cipher(key_, Mode::XTS) {}
 
-std::size_t XTSEncryptionLayer::Read(u8* data, std::size_t length, std::size_t offset) const {
+std::size_t XTSEncryptionLayer::ReadDecrypted(u8* data, std::size_t length,
+                                              std::size_t offset) const {
     if (length == 0)
         return 0;
 
     const auto sector_offset = offset & 0x3FFF;
     if (sector_offset == 0) {
         if (length % XTS_SECTOR_SIZE == 0) {
-            std::vector<u8> raw = base->ReadBytes(length, offset);
-            cipher.XTSTranscode(raw.data(), raw.size(), data, offset / XTS_SECTOR_SIZE,
-                                XTS_SECTOR_SIZE, Op::Decrypt);
-            return raw.size();
+            const std::size_t raw_size = base->Read(data, length, offset);
+            const std::size_t full_size = raw_size - raw_size % XTS_SECTOR_SIZE;
+            cipher.XTSTranscode(data, full_size, data, offset / XTS_SECTOR_SIZE, XTS_SECTOR_SIZE,
+                                Op::Decrypt);
+            if (full_size == raw_size) {
+                return raw_size;
+            }
+            // The base file ended partway through the last sector.
+            return full_size + ReadDecrypted(data + full_size, raw_size - full_size,
+                                             offset + full_size);
         }
         if (length > XTS_SECTOR_SIZE) {
             const auto rem = length % XTS_SECTOR_SIZE;
             const auto read = length - rem;
-            return Read(data, read, offset) + Read(data + read, rem, offset + read);
+            return ReadDecrypted(data, read, offset) +
+                   ReadDecrypted(data + read, rem, offset + read);
         }
-        std::vector<u8> buffer = base->ReadBytes(XTS_SECTOR_SIZE, offset);
-        if (buffer.size() < XTS_SECTOR_SIZE)
-            buffer.resize(XTS_SECTOR_SIZE);
+        std::array<u8, XTS_SECTOR_SIZE> buffer{};
+        base->Read(buffer.data(), buffer.size(), offset);
         cipher.XTSTranscode(buffer.data(), buffer.size(), buffer.data(), offset / XTS_SECTOR_SIZE,
                             XTS_SECTOR_SIZE, Op::Decrypt);
         std::memcpy(data, buffer.data(), std::min(buffer.size(), length));
@@ -41,9 +49,8 @@ std::size_t XTSEncryptionLayer::Read(u8* data, std::size_t length, std::size_t o
     }
 
     // offset does not fall on block boundary (0x4000)
-    std::vector<u8> block = base->ReadBytes(0x4000, offset - sector_offset);
-    if (block.size() < XTS_SECTOR_SIZE)
-        block.resize(XTS_SECTOR_SIZE);
+    std::array<u8, XTS_SECTOR_SIZE> block{};
+    base->Read(block.data(), block.size(), offset - sector_offset);
     cipher.XTSTranscode(block.data(), block.size(), block.data(),
                         (offset - sector_offset) / XTS_SECTOR_SIZE, XTS_SECTOR_SIZE, Op::Decrypt);
     const std::size_t read = XTS_SECTOR_SIZE - sector_offset;
@@ -53,6 +60,6 @@ std::size_t XTSEncryptionLayer::Read(u8* data, std::size_t length, std::size_t o
         return std::min<u64>(length, read);
     }
     std::memcpy(data, block.data() + sector_offset, read);
-    return read + Read(data + read, length - read, offset + read);
+    return read + ReadDecrypted(data + read, length - read, offset + read);
 }
 } // namespace Core::Crypto
@@ -2,6 +2,7 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <cstring>
 #include <memory>
 
 #include "common/common_types.h"
@@ -55,6 +56,15 @@ static_assert(sizeof(FileEntry) == 0x20, "FileEntry has incorrect size.");
 template <typename Entry>
 std::pair<Entry, std::string> GetEntry(const VirtualFile& file, std::size_t offset) {
     Entry entry{};
+    if (const u8* const data = file->GetPointer(sizeof(Entry), offset); data != nullptr) {
+        std::memcpy(&entry, data, sizeof(Entry));
+        if (const u8* const name = file->GetPointer(entry.name_length, offset + sizeof(Entry));
+            name != nullptr) {
+            return {entry, std::string(reinterpret_cast<const char*>(name), entry.name_length)};
+        }
+        return {};
+    }
+
     if (file->ReadObject(&entry, offset) != sizeof(Entry))
         return {};
     std::string string(entry.name_length, '\0');
@@ -167,6 +167,10 @@ std::string VfsFile::GetExtension() const {
 
 VfsDirectory::~VfsDirectory() = default;
 
+const u8* VfsFile::GetPointer(std::size_t length, std::size_t offset) const {
+    return nullptr;
+}
+
 std::optional<u8> VfsFile::ReadByte(std::size_t offset) const {
     u8 out{};
     std::size_t size = Read(&out, 1, offset);
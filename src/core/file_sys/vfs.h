@@ -105,6 +105,12 @@ public:
     // into file. Returns number of bytes successfully written.
     virtual std::size_t Write(const u8* data, std::size_t length, std::size_t offset = 0) = 0;
 
+    // Returns a pointer to length bytes starting at offset that can be read without copying, or
+    // nullptr if the file cannot provide one (e.g. the data has to be decrypted or read from disk),
+    // in which case the caller should fall back to Read. The pointer remains valid for as long as
+    // the file is alive and is not written to or resized.
+    virtual const u8* GetPointer(std::size_t length, std::size_t offset = 0) const;
+
     // Reads exactly one byte at the offset provided, returning std::nullopt on error.
     virtual std::optional<u8> ReadByte(std::size_t offset = 0) const;
     // Reads size bytes starting at offset in file into a vector.
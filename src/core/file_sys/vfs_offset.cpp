@@ -57,6 +57,12 @@ std::size_t OffsetVfsFile::Write(const u8* data, std::size_t length, std::size_t
     return file->Write(data, TrimToFit(length, r_offset), offset + r_offset);
 }
 
+const u8* OffsetVfsFile::GetPointer(std::size_t length, std::size_t r_offset) const {
+    if (r_offset > size || length > size - r_offset)
+        return nullptr;
+    return file->GetPointer(length, offset + r_offset);
+}
+
 std::optional<u8> OffsetVfsFile::ReadByte(std::size_t r_offset) const {
     if (r_offset < size)
         return file->ReadByte(offset + r_offset);
@@ -3,17 +3,32 @@
 // Refer to the license.txt file included.
 
 #include <algorithm>
+#include <array>
 #include <cstddef>
+#include <cstring>
 #include <iterator>
 #include <utility>
 #include "common/assert.h"
 #include "common/common_paths.h"
 #include "common/file_util.h"
 #include "common/logging/log.h"
+#include "common/string_util.h"
 #include "core/file_sys/vfs_real.h"
 
 namespace FileSys {
 
+// Game images are large, read-only and read at random offsets for the whole session, which makes
+// them ideal for memory mapping.
+static bool ShouldMap(const std::string& path, Mode perms) {
+    constexpr std::array<std::string_view, 3> mapped_extensions{"xci", "nsp", "nca"};
+    if (perms != Mode::Read)
+        return false;
+
+    const auto extension = Common::ToLower(std::string(FileUtil::GetExtensionFromFilename(path)));
+    return std::find(mapped_extensions.begin(), mapped_extensions.end(), extension) !=
+           mapped_extensions.end();
+}
+
 static std::string ModeFlagsToString(Mode mode) {
     std::string mode_str;
 
@@ -66,10 +81,12 @@ VfsEntryType RealVfsFilesystem::GetEntryType(std::string_view path_) const {
 
 VirtualFile RealVfsFilesystem::OpenFile(std::string_view path_, Mode perms) {
     const auto path = FileUtil::SanitizePath(path_, FileUtil::DirectorySeparator::PlatformDefault);
+    auto mapping = ShouldMap(path, perms) ? OpenMapping(path) : nullptr;
     if (cache.find(path) != cache.end()) {
         auto weak = cache[path];
         if (!weak.expired()) {
-            return std::shared_ptr<RealVfsFile>(new RealVfsFile(*this, weak.lock(), path, perms));
+            return std::shared_ptr<RealVfsFile>(
+                new RealVfsFile(*this, weak.lock(), std::move(mapping), path, perms));
         }
     }
 
@@ -80,7 +97,37 @@ VirtualFile RealVfsFilesystem::OpenFile(std::string_view path_, Mode perms) {
     cache[path] = backing;
 
     // Cannot use make_shared as RealVfsFile constructor is private
-    return std::shared_ptr<RealVfsFile>(new RealVfsFile(*this, backing, path, perms));
+    return std::shared_ptr<RealVfsFile>(
+        new RealVfsFile(*this, backing, std::move(mapping), path, perms));
+}
+
+std::shared_ptr<FileUtil::MappedFile> RealVfsFilesystem::OpenMapping(const std::string& path) {
+    const auto iter = mappings.find(path);
+    if (iter != mappings.end()) {
+        if (auto mapping = iter->second.lock()) {
+            return mapping;
+        }
+    }
+
+    auto mapping = std::make_shared<FileUtil::MappedFile>(path);
+    if (!mapping->IsOpen()) {
+        LOG_DEBUG(Service_FS, "Failed to map {}, falling back to buffered reads", path);
+        mappings.erase(path);
+        return nullptr;
+    }
+    mappings[path] = mapping;
+    return mapping;
+}
+
+void RealVfsFilesystem::DropMappings(const std::string& path) {
+    // Files that are still open keep their mapping, which stays valid for the old contents.
+    for (auto iter = mappings.begin(); iter != mappings.end();) {
+        if (iter->first.rfind(path, 0) == 0) {
+            iter = mappings.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
 }
 
 VirtualFile RealVfsFilesystem::CreateFile(std::string_view path_, Mode perms) {
@@ -116,6 +163,7 @@ VirtualFile RealVfsFilesystem::MoveFile(std::string_view old_path_, std::string_
         FileUtil::IsDirectory(old_path) || !FileUtil::Rename(old_path, new_path))
         return nullptr;
 
+    DropMappings(old_path);
     if (cache.find(old_path) != cache.end()) {
         auto cached = cache[old_path];
         if (!cached.expired()) {
@@ -130,6 +178,7 @@ VirtualFile RealVfsFilesystem::MoveFile(std::string_view old_path_, std::string_
 
 bool RealVfsFilesystem::DeleteFile(std::string_view path_) {
     const auto path = FileUtil::SanitizePath(path_, FileUtil::DirectorySeparator::PlatformDefault);
+    DropMappings(path);
     if (cache.find(path) != cache.end()) {
         if (!cache[path].expired())
             cache[path].lock()->Close();
@@ -179,6 +228,7 @@ VirtualDir RealVfsFilesystem::MoveDirectory(std::string_view old_path_,
         FileUtil::IsDirectory(old_path) || !FileUtil::Rename(old_path, new_path))
         return nullptr;
 
+    DropMappings(old_path);
     for (auto& kv : cache) {
         // Path in cache starts with old_path
         if (kv.first.rfind(old_path, 0) == 0) {
@@ -202,6 +252,7 @@ VirtualDir RealVfsFilesystem::MoveDirectory(std::string_view old_path_,
 
 bool RealVfsFilesystem::DeleteDirectory(std::string_view path_) {
     const auto path = FileUtil::SanitizePath(path_, FileUtil::DirectorySeparator::PlatformDefault);
+    DropMappings(path);
     for (auto& kv : cache) {
         // Path in cache starts with old_path
         if (kv.first.rfind(path, 0) == 0) {
@@ -214,8 +265,9 @@ bool RealVfsFilesystem::DeleteDirectory(std::string_view path_) {
 }
 
 RealVfsFile::RealVfsFile(RealVfsFilesystem& base_, std::shared_ptr<FileUtil::IOFile> backing_,
-                         const std::string& path_, Mode perms_)
-    : base(base_), backing(std::move(backing_)), path(path_),
+                         std::shared_ptr<FileUtil::MappedFile> mapping_, const std::string& path_,
+                         Mode perms_)
+    : base(base_), backing(std::move(backing_)), mapping(std::move(mapping_)), path(path_),
       parent_path(FileUtil::GetParentPath(path_)),
       path_components(FileUtil::SplitPathComponents(path_)),
       parent_components(FileUtil::SliceVector(path_components, 0, path_components.size() - 1)),
@@ -248,6 +300,11 @@ bool RealVfsFile::IsReadable() const {
 }
 
 std::size_t RealVfsFile::Read(u8* data, std::size_t length, std::size_t offset) const {
+    if (const u8* const mapped = GetPointer(length, offset); mapped != nullptr) {
+        std::memcpy(data, mapped, length);
+        return length;
+    }
+
     if (!backing->Seek(offset, SEEK_SET))
         return 0;
     return backing->ReadBytes(data, length);
@@ -259,11 +316,18 @@ std::size_t RealVfsFile::Write(const u8* data, std::size_t length, std::size_t o
     return backing->WriteBytes(data, length);
 }
 
+const u8* RealVfsFile::GetPointer(std::size_t length, std::size_t offset) const {
+    if (mapping == nullptr || offset > mapping->GetSize() || length > mapping->GetSize() - offset)
+        return nullptr;
+    return mapping->GetData() + offset;
+}
+
 bool RealVfsFile::Rename(std::string_view name) {
     return base.MoveFile(path, parent_path + DIR_SEP + std::string(name)) != nullptr;
 }
 
 bool RealVfsFile::Close() {
+    mapping.reset();
     return backing->Close();
 }
 
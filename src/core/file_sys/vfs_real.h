@@ -11,7 +11,8 @@
 
 namespace FileUtil {
 class IOFile;
-}
+class MappedFile;
+} // namespace FileUtil
 
 namespace FileSys {
 
@@ -36,7 +37,14 @@ public:
     bool DeleteDirectory(std::string_view path) override;
 
 private:
+    /// Returns the mapping of a game image, shared by every open file of the path.
+    std::shared_ptr<FileUtil::MappedFile> OpenMapping(const std::string& path);
+
+    /// Forgets the mappings of path and everything below it, later opens map the file again.
+    void DropMappings(const std::string& path);
+
     boost::container::flat_map<std::string, std::weak_ptr<FileUtil::IOFile>> cache;
+    boost::container::flat_map<std::string, std::weak_ptr<FileUtil::MappedFile>> mappings;
 };
 
 // An implmentation of VfsFile that represents a file on the user's computer.
@@ -55,16 +63,23 @@ public:
     bool IsReadable() const override;
     std::size_t Read(u8* data, std::size_t length, std::size_t offset) const override;
     std::size_t Write(const u8* data, std::size_t length, std::size_t offset) override;
+    const u8* GetPointer(std::size_t length, std::size_t offset) const override;
     bool Rename(std::string_view name) override;
 
 private:
     RealVfsFile(RealVfsFilesystem& base, std::shared_ptr<FileUtil::IOFile> backing,
-                const std::string& path, Mode perms = Mode::Read);
+                std::shared_ptr<FileUtil::MappedFile> mapping, const std::string& path,
+                Mode perms = Mode::Read);
 
     bool Close();
 
     RealVfsFilesystem& base;
     std::shared_ptr<FileUtil::IOFile> backing;
+    // Read-only game images are additionally mapped into memory, so reads within the mapping can
+    // skip the stdio backing entirely. Shared with other opens of the path, nullptr if the file is
+    // not mapped. Game images are never written while they are open, so the mapping is assumed to
+    // stay within the file.
+    std::shared_ptr<FileUtil::MappedFile> mapping;
     std::string path;
     std::string parent_path;
     std::vector<std::string> path_components;
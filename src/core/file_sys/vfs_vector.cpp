@@ -43,6 +43,12 @@ std::size_t VectorVfsFile::Read(u8* data_, std::size_t length, std::size_t offse
     return read;
 }
 
+const u8* VectorVfsFile::GetPointer(std::size_t length, std::size_t offset) const {
+    if (offset > data.size() || length > data.size() - offset)
+        return nullptr;
+    return data.data() + offset;
+}
+
 std::size_t VectorVfsFile::Write(const u8* data_, std::size_t length, std::size_t offset) {
     if (offset + length > data.size())
         data.resize(offset + length);
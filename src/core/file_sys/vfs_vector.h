@@ -50,6 +50,12 @@ public:
         return 0;
     }
 
+    const u8* GetPointer(std::size_t length, std::size_t offset) const override {
+        if (offset > size || length > size - offset)
+            return nullptr;
+        return data.data() + offset;
+    }
+
     bool Rename(std::string_view name) override {
         this->name = name;
         return true;
@@ -76,6 +82,7 @@ public:
     bool IsReadable() const override;
     std::size_t Read(u8* data, std::size_t length, std::size_t offset) const override;
     std::size_t Write(const u8* data, std::size_t length, std::size_t offset) override;
+    const u8* GetPointer(std::size_t length, std::size_t offset) const override;
     bool Rename(std::string_view name) override;
 
     virtual void Assign(std::vector<u8> new_data);
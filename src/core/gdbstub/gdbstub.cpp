@@ -212,10 +212,16 @@ static Kernel::Thread* FindThreadById(s64 id) {
     return nullptr;
 }
 
+/// Writes back the vector state of the thread if a core still holds it.
+static void FlushVectorState(const Kernel::Thread& thread) {
+    Core::System::GetInstance().GlobalScheduler().FlushVectorState(thread);
+}
+
 static u64 RegRead(std::size_t id, Kernel::Thread* thread = nullptr) {
     if (!thread) {
         return 0;
     }
+    FlushVectorState(*thread);
 
     const auto& thread_context = thread->GetContext();
 
@@ -238,6 +244,7 @@ static void RegWrite(std::size_t id, u64 val, Kernel::Thread* thread = nullptr)
     if (!thread) {
         return;
     }
+    FlushVectorState(*thread);
 
     auto& thread_context = thread->GetContext();
 
@@ -258,6 +265,7 @@ static u128 FpuRead(std::size_t id, Kernel::Thread* thread = nullptr) {
     if (!thread) {
         return u128{0};
     }
+    FlushVectorState(*thread);
 
     auto& thread_context = thread->GetContext();
 
@@ -274,6 +282,7 @@ static void FpuWrite(std::size_t id, u128 val, Kernel::Thread* thread = nullptr)
     if (!thread) {
         return;
     }
+    FlushVectorState(*thread);
 
     auto& thread_context = thread->GetContext();
 
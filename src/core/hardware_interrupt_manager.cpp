@@ -12,18 +12,28 @@ namespace Core::Hardware {
 
 InterruptManager::InterruptManager(Core::System& system_in) : system(system_in) {
     gpu_interrupt_event = Core::Timing::CreateEvent("GPUInterrupt", [this](u64 message, s64) {
-        auto nvdrv = system.ServiceManager().GetService<Service::Nvidia::NVDRV>("nvdrv");
         const u32 syncpt = static_cast<u32>(message >> 32);
         const u32 value = static_cast<u32>(message);
-        nvdrv->SignalGPUInterruptSyncpt(syncpt, value);
+        SignalGPUInterruptSyncpt(syncpt, value);
     });
 }
 
 InterruptManager::~InterruptManager() = default;
 
 void InterruptManager::GPUInterruptSyncpt(const u32 syncpoint_id, const u32 value) {
+    // Events and thread state may only be touched from the CPU thread, so the interrupt is always
+    // delivered through CoreTiming, even when this is called from the GPU thread.
     const u64 msg = (static_cast<u64>(syncpoint_id) << 32ULL) | value;
     system.CoreTiming().ScheduleEvent(10, gpu_interrupt_event, msg);
 }
 
+void InterruptManager::SignalGPUInterruptSyncpt(u32 syncpoint_id, u32 value) {
+    auto nvdrv_service = nvdrv.lock();
+    if (!nvdrv_service) {
+        nvdrv_service = system.ServiceManager().GetService<Service::Nvidia::NVDRV>("nvdrv");
+        nvdrv = nvdrv_service;
+    }
+    nvdrv_service->SignalGPUInterruptSyncpt(syncpoint_id, value);
+}
+
 } // namespace Core::Hardware
@@ -16,6 +16,10 @@ namespace Core::Timing {
 struct EventType;
 }
 
+namespace Service::Nvidia {
+class NVDRV;
+}
+
 namespace Core::Hardware {
 
 class InterruptManager {
@@ -23,11 +27,17 @@ public:
     explicit InterruptManager(Core::System& system);
     ~InterruptManager();
 
+    /// Signals the nvdrv events waiting on a syncpoint value, may be called from any host thread.
     void GPUInterruptSyncpt(u32 syncpoint_id, u32 value);
 
 private:
+    void SignalGPUInterruptSyncpt(u32 syncpoint_id, u32 value);
+
     Core::System& system;
     std::shared_ptr<Core::Timing::EventType> gpu_interrupt_event;
+
+    /// nvdrv service, looked up on the first interrupt. Only accessed from the CPU thread.
+    std::weak_ptr<Service::Nvidia::NVDRV> nvdrv;
 };
 
 } // namespace Core::Hardware
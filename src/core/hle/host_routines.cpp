@@ -0,0 +1,199 @@
+// Copyright 2019 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <map>
+#include <string>
+#include <string_view>
+#include "common/assert.h"
+#include "common/logging/log.h"
+#include "common/microprofile.h"
+#include "core/arm/arm_interface.h"
+#include "core/arm/symbols.h"
+#include "core/core.h"
+#include "core/hle/host_routines.h"
+#include "core/hle/kernel/process.h"
+#include "core/loader/loader.h"
+#include "core/memory.h"
+
+MICROPROFILE_DEFINE(HLE_HostRoutines, "HLE", "Host Routines", MP_RGB(70, 160, 200));
+
+namespace HLE {
+namespace {
+
+constexpr u32 INSN_RET = 0xD65F03C0;
+
+constexpr std::array<std::string_view, HostRoutines::NUM_ROUTINES> ROUTINE_NAMES{
+    "memcpy", "memmove", "memset", "memcmp", "strlen",
+};
+
+/// Encodes "svc #immediate".
+constexpr u32 EncodeSvc(u32 immediate) {
+    return 0xD4000001 | (immediate << 5);
+}
+
+/// Returns the number of bytes from address to the end of its page, capped to size.
+u64 ChunkSize(VAddr address, u64 size) {
+    return std::min(size, Memory::PAGE_SIZE - (address & Memory::PAGE_MASK));
+}
+
+} // Anonymous namespace
+
+HostRoutines::HostRoutines(Core::System& system) : system{system} {}
+
+HostRoutines::~HostRoutines() = default;
+
+void HostRoutines::PatchModules(Loader::AppLoader& loader) {
+    patched_count = 0;
+
+    std::map<VAddr, std::string> modules;
+    if (loader.ReadNSOModules(modules) != Loader::ResultStatus::Success) {
+        return;
+    }
+    for (const auto& [base, name] : modules) {
+        PatchModule(base);
+    }
+    if (patched_count > 0) {
+        system.InvalidateCpuInstructionCaches();
+    }
+    LOG_INFO(Core, "Patched {} guest routines with host implementations", patched_count);
+}
+
+void HostRoutines::PatchModule(VAddr base) {
+    auto& memory = system.Memory();
+    for (const auto& [symbol, name] : Core::Symbols::GetSymbols(base, memory)) {
+        // Only patch functions defined by the module that have room for two instructions.
+        if (symbol.type != Core::Symbols::ELFSymbolType::Function || symbol.sh_index == 0 ||
+            symbol.value == 0 || symbol.size < sizeof(u32) * 2) {
+            continue;
+        }
+        const auto it = std::find(ROUTINE_NAMES.begin(), ROUTINE_NAMES.end(), name);
+        if (it == ROUTINE_NAMES.end()) {
+            continue;
+        }
+        const auto index = static_cast<u32>(std::distance(ROUTINE_NAMES.begin(), it));
+        const VAddr address = base + symbol.value;
+        memory.Write32(address, EncodeSvc(SVC_BASE + index));
+        memory.Write32(address + sizeof(u32), INSN_RET);
+        ++patched_count;
+
+        LOG_DEBUG(Core, "Patched {} at 0x{:016X}", name, address);
+    }
+}
+
+void HostRoutines::Call(u32 immediate) {
+    MICROPROFILE_SCOPE(HLE_HostRoutines);
+    ASSERT(IsHostRoutineCall(immediate));
+
+    auto& cpu = system.CurrentArmInterface();
+    const auto& process = *system.CurrentProcess();
+    const u64 arg0 = cpu.GetReg(0);
+    const u64 arg1 = cpu.GetReg(1);
+    const u64 arg2 = cpu.GetReg(2);
+
+    const auto routine = static_cast<Routine>(immediate - SVC_BASE);
+    switch (routine) {
+    case Routine::Memcpy:
+        cpu.SetReg(0, Memcpy(process, arg0, arg1, arg2));
+        break;
+    case Routine::Memmove:
+        cpu.SetReg(0, Memmove(process, arg0, arg1, arg2));
+        break;
+    case Routine::Memset:
+        cpu.SetReg(0, Memset(process, arg0, static_cast<u8>(arg1), arg2));
+        break;
+    case Routine::Memcmp:
+        cpu.SetReg(0, static_cast<u64>(static_cast<s64>(Memcmp(process, arg0, arg1, arg2))));
+        break;
+    case Routine::Strlen:
+        cpu.SetReg(0, Strlen(process, arg0));
+        break;
+    default:
+        UNREACHABLE();
+        return;
+    }
+    hits[static_cast<std::size_t>(routine)].fetch_add(1, std::memory_order_relaxed);
+}
+
+VAddr HostRoutines::Memcpy(const Kernel::Process& process, VAddr dest, VAddr src, u64 size) {
+    system.Memory().CopyBlock(process, dest, src, size);
+    return dest;
+}
+
+VAddr HostRoutines::Memmove(const Kernel::Process& process, VAddr dest, VAddr src, u64 size) {
+    auto& memory = system.Memory();
+    std::array<u8, Memory::PAGE_SIZE> buffer;
+    if (dest <= src || dest >= src + size) {
+        // Copying forwards never overwrites source bytes that have not been read yet.
+        for (u64 offset = 0; offset < size;) {
+            const u64 chunk = std::min<u64>(size - offset, buffer.size());
+            memory.ReadBlock(process, src + offset, buffer.data(), chunk);
+            memory.WriteBlock(process, dest + offset, buffer.data(), chunk);
+            offset += chunk;
+        }
+    } else {
+        for (u64 remaining = size; remaining > 0;) {
+            const u64 chunk = std::min<u64>(remaining, buffer.size());
+            remaining -= chunk;
+            memory.ReadBlock(process, src + remaining, buffer.data(), chunk);
+            memory.WriteBlock(process, dest + remaining, buffer.data(), chunk);
+        }
+    }
+    return dest;
+}
+
+VAddr HostRoutines::Memset(const Kernel::Process& process, VAddr dest, u8 value, u64 size) {
+    auto& memory = system.Memory();
+    if (value == 0) {
+        memory.ZeroBlock(process, dest, size);
+        return dest;
+    }
+    std::array<u8, Memory::PAGE_SIZE> buffer;
+    buffer.fill(value);
+    for (u64 offset = 0; offset < size;) {
+        const u64 chunk = ChunkSize(dest + offset, size - offset);
+        memory.WriteBlock(process, dest + offset, buffer.data(), chunk);
+        offset += chunk;
+    }
+    return dest;
+}
+
+s32 HostRoutines::Memcmp(const Kernel::Process& process, VAddr lhs, VAddr rhs, u64 size) {
+    auto& memory = system.Memory();
+    std::array<u8, Memory::PAGE_SIZE> lhs_buffer;
+    std::array<u8, Memory::PAGE_SIZE> rhs_buffer;
+    for (u64 offset = 0; offset < size;) {
+        const u64 chunk = std::min<u64>(size - offset, lhs_buffer.size());
+        memory.ReadBlock(process, lhs + offset, lhs_buffer.data(), chunk);
+        memory.ReadBlock(process, rhs + offset, rhs_buffer.data(), chunk);
+        if (std::memcmp(lhs_buffer.data(), rhs_buffer.data(), chunk) != 0) {
+            const auto [lhs_it, rhs_it] =
+                std::mismatch(lhs_buffer.begin(), lhs_buffer.begin() + chunk, rhs_buffer.begin());
+            return static_cast<s32>(*lhs_it) - static_cast<s32>(*rhs_it);
+        }
+        offset += chunk;
+    }
+    return 0;
+}
+
+u64 HostRoutines::Strlen(const Kernel::Process& process, VAddr string) {
+    auto& memory = system.Memory();
+    std::array<u8, Memory::PAGE_SIZE> buffer;
+    u64 length = 0;
+    while (true) {
+        // Never read past the page holding the terminator, the next one might not be mapped.
+        const VAddr address = string + length;
+        const u64 chunk = ChunkSize(address, Memory::PAGE_SIZE);
+        memory.ReadBlock(process, address, buffer.data(), chunk);
+        const void* terminator = std::memchr(buffer.data(), 0, chunk);
+        if (terminator != nullptr) {
+            return length + static_cast<u64>(static_cast<const u8*>(terminator) - buffer.data());
+        }
+        length += chunk;
+    }
+}
+
+} // namespace HLE
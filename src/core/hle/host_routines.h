@@ -0,0 +1,90 @@
+// Copyright 2019 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include "common/common_types.h"
+
+namespace Core {
+class System;
+}
+
+namespace Kernel {
+class Process;
+}
+
+namespace Loader {
+class AppLoader;
+}
+
+namespace HLE {
+
+/**
+ * Replaces hot guest libc routines with host implementations. The entry point of each routine
+ * exported by the loaded modules is patched with a supervisor call outside the range used by the
+ * kernel followed by a return, the supervisor call is then dispatched here instead of the kernel.
+ * Guest memory is accessed through the block functions of Memory, so rasterizer cached regions
+ * are flushed and invalidated the same way a guest access would.
+ */
+class HostRoutines final {
+public:
+    enum class Routine : u32 {
+        Memcpy,
+        Memmove,
+        Memset,
+        Memcmp,
+        Strlen,
+        Count,
+    };
+
+    /// First supervisor call immediate used by the patched routines.
+    static constexpr u32 SVC_BASE = 0x1000;
+
+    static constexpr std::size_t NUM_ROUTINES = static_cast<std::size_t>(Routine::Count);
+
+    explicit HostRoutines(Core::System& system);
+    ~HostRoutines();
+
+    /// Patches the routines exported by the modules of the current process.
+    void PatchModules(Loader::AppLoader& loader);
+
+    /// Returns true when the supervisor call immediate belongs to a patched routine.
+    static bool IsHostRoutineCall(u32 immediate) {
+        return immediate >= SVC_BASE && immediate < SVC_BASE + NUM_ROUTINES;
+    }
+
+    /// Executes the routine the immediate belongs to using the current core registers.
+    void Call(u32 immediate);
+
+    /// Returns how many times the routine has been executed on the host.
+    u64 GetHits(Routine routine) const {
+        return hits[static_cast<std::size_t>(routine)].load(std::memory_order_relaxed);
+    }
+
+    /// Returns how many entry points were patched on the last PatchModules call.
+    std::size_t GetPatchedCount() const {
+        return patched_count;
+    }
+
+    /// Host implementations of the routines, operating on the memory of the given process.
+    VAddr Memcpy(const Kernel::Process& process, VAddr dest, VAddr src, u64 size);
+    VAddr Memmove(const Kernel::Process& process, VAddr dest, VAddr src, u64 size);
+    VAddr Memset(const Kernel::Process& process, VAddr dest, u8 value, u64 size);
+    s32 Memcmp(const Kernel::Process& process, VAddr lhs, VAddr rhs, u64 size);
+    u64 Strlen(const Kernel::Process& process, VAddr string);
+
+private:
+    /// Patches the entry points of the routines exported by the module at base.
+    void PatchModule(VAddr base);
+
+    Core::System& system;
+
+    std::array<std::atomic<u64>, NUM_ROUTINES> hits{};
+    std::size_t patched_count = 0;
+};
+
+} // namespace HLE
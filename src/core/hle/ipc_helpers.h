@@ -356,6 +356,22 @@ public:
     template <typename T>
     T PopRaw();
 
+    /**
+     * Reads the next normal parameter as a value of any type: arithmetic types and ResultCode are
+     * read with Pop, enums through their underlying type and anything else as a raw struct.
+     */
+    template <typename T>
+    T PopArgument();
+
+    /// Reads the next normal parameters, in order, into a tuple of the given types.
+    template <typename... Args>
+    std::tuple<Args...> PopArguments() {
+        std::tuple<Args...> values;
+        // The comma fold guarantees the parameters are read left to right.
+        std::apply([this](auto&... value) { ((value = PopArgument<Args>()), ...); }, values);
+        return values;
+    }
+
     template <typename T>
     std::shared_ptr<T> GetMoveObject(std::size_t index);
 
@@ -464,6 +480,19 @@ void RequestParser::Pop(First& first_value, Other&... other_values) {
     Pop(other_values...);
 }
 
+template <typename T>
+T RequestParser::PopArgument() {
+    if constexpr (std::is_enum_v<T>) {
+        return static_cast<T>(Pop<std::underlying_type_t<T>>());
+    } else if constexpr (std::is_arithmetic_v<T> || std::is_same_v<T, ResultCode>) {
+        return Pop<T>();
+    } else {
+        static_assert(std::is_trivially_copyable_v<T>,
+                      "Handler arguments must be trivially copyable to be read as raw structs.");
+        return PopRaw<T>();
+    }
+}
+
 template <typename T>
 std::shared_ptr<T> RequestParser::GetMoveObject(std::size_t index) {
     return context->GetMoveObject<T>(index);
@@ -474,4 +503,10 @@ std::shared_ptr<T> RequestParser::GetCopyObject(std::size_t index) {
     return context->GetCopyObject<T>(index);
 }
 
+template <typename... Args>
+std::tuple<Args...> PopArguments(Kernel::HLERequestContext& ctx) {
+    RequestParser rp{ctx};
+    return rp.PopArguments<Args...>();
+}
+
 } // namespace IPC
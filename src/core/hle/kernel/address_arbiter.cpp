@@ -2,9 +2,6 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
-#include <algorithm>
-#include <vector>
-
 #include "common/assert.h"
 #include "common/common_types.h"
 #include "core/core.h"
@@ -18,24 +15,28 @@
 
 namespace Kernel {
 
-// Wake up num_to_wake (or all) threads in a vector.
-void AddressArbiter::WakeThreads(const std::vector<std::shared_ptr<Thread>>& waiting_threads,
-                                 s32 num_to_wake) {
+// Wake up num_to_wake (or all) threads waiting on an address.
+void AddressArbiter::WakeThreads(VAddr address, s32 num_to_wake) {
+    const auto iter = arb_threads.find(address);
+    if (iter == arb_threads.end()) {
+        return;
+    }
+
     // Only process up to 'target' threads, unless 'target' is <= 0, in which case process
     // them all.
-    std::size_t last = waiting_threads.size();
-    if (num_to_wake > 0) {
-        last = std::min(last, static_cast<std::size_t>(num_to_wake));
-    }
+    auto& waiting_threads = iter->second;
+    for (s32 i = 0; num_to_wake <= 0 || i < num_to_wake; i++) {
+        Thread* const thread = waiting_threads.pop_front();
+        if (thread == nullptr) {
+            break;
+        }
 
-    // Signal the waiting threads.
-    for (std::size_t i = 0; i < last; i++) {
-        ASSERT(waiting_threads[i]->GetStatus() == ThreadStatus::WaitArb);
-        waiting_threads[i]->SetWaitSynchronizationResult(RESULT_SUCCESS);
-        RemoveThread(waiting_threads[i]);
-        waiting_threads[i]->SetArbiterWaitAddress(0);
-        waiting_threads[i]->ResumeFromWait();
-        system.PrepareReschedule(waiting_threads[i]->GetProcessorID());
+        // Signal the waiting thread.
+        ASSERT(thread->GetStatus() == ThreadStatus::WaitArb);
+        thread->SetWaitSynchronizationResult(RESULT_SUCCESS);
+        thread->SetArbiterWaitAddress(0);
+        thread->ResumeFromWait();
+        system.PrepareReschedule(thread->GetProcessorID());
     }
 }
 
@@ -57,9 +58,7 @@ ResultCode AddressArbiter::SignalToAddress(VAddr address, SignalType type, s32 v
 }
 
 ResultCode AddressArbiter::SignalToAddressOnly(VAddr address, s32 num_to_wake) {
-    const std::vector<std::shared_ptr<Thread>> waiting_threads =
-        GetThreadsWaitingOnAddress(address);
-    WakeThreads(waiting_threads, num_to_wake);
+    WakeThreads(address, num_to_wake);
     return RESULT_SUCCESS;
 }
 
@@ -89,22 +88,21 @@ ResultCode AddressArbiter::ModifyByWaitingCountAndSignalToAddressIfEqual(VAddr a
         return ERR_INVALID_ADDRESS_STATE;
     }
 
-    // Get threads waiting on the address.
-    const std::vector<std::shared_ptr<Thread>> waiting_threads =
-        GetThreadsWaitingOnAddress(address);
+    // Get the number of threads waiting on the address.
+    const std::size_t num_waiting_threads = GetNumThreadsWaitingOnAddress(address);
 
     // Determine the modified value depending on the waiting count.
     s32 updated_value;
     if (num_to_wake <= 0) {
-        if (waiting_threads.empty()) {
+        if (num_waiting_threads == 0) {
             updated_value = value + 1;
         } else {
             updated_value = value - 1;
         }
     } else {
-        if (waiting_threads.empty()) {
+        if (num_waiting_threads == 0) {
             updated_value = value + 1;
-        } else if (waiting_threads.size() <= static_cast<u32>(num_to_wake)) {
+        } else if (num_waiting_threads <= static_cast<u32>(num_to_wake)) {
             updated_value = value - 1;
         } else {
             updated_value = value;
@@ -116,7 +114,7 @@ ResultCode AddressArbiter::ModifyByWaitingCountAndSignalToAddressIfEqual(VAddr a
     }
 
     memory.Write32(address, static_cast<u32>(updated_value));
-    WakeThreads(waiting_threads, num_to_wake);
+    WakeThreads(address, num_to_wake);
     return RESULT_SUCCESS;
 }
 
@@ -184,7 +182,7 @@ ResultCode AddressArbiter::WaitForAddressIfEqual(VAddr address, s32 value, s64 t
 ResultCode AddressArbiter::WaitForAddressImpl(VAddr address, s64 timeout) {
     Thread* current_thread = system.CurrentScheduler().GetCurrentThread();
     current_thread->SetArbiterWaitAddress(address);
-    InsertThread(SharedFrom(current_thread));
+    InsertThread(*current_thread);
     current_thread->SetStatus(ThreadStatus::WaitArb);
     current_thread->InvalidateWakeupCallback();
     current_thread->WakeAfterDelay(timeout);
@@ -195,49 +193,26 @@ ResultCode AddressArbiter::WaitForAddressImpl(VAddr address, s64 timeout) {
 
 void AddressArbiter::HandleWakeupThread(std::shared_ptr<Thread> thread) {
     ASSERT(thread->GetStatus() == ThreadStatus::WaitArb);
-    RemoveThread(thread);
+    RemoveThread(*thread);
     thread->SetArbiterWaitAddress(0);
 }
 
-void AddressArbiter::InsertThread(std::shared_ptr<Thread> thread) {
-    const VAddr arb_addr = thread->GetArbiterWaitAddress();
-    std::list<std::shared_ptr<Thread>>& thread_list = arb_threads[arb_addr];
-    auto it = thread_list.begin();
-    while (it != thread_list.end()) {
-        const std::shared_ptr<Thread>& current_thread = *it;
-        if (current_thread->GetPriority() >= thread->GetPriority()) {
-            thread_list.insert(it, thread);
-            return;
-        }
-        ++it;
-    }
-    thread_list.push_back(std::move(thread));
+void AddressArbiter::InsertThread(Thread& thread) {
+    // Threads are placed before any waiting threads of the same priority.
+    arb_threads[thread.GetArbiterWaitAddress()].add(thread, thread.GetPriority(), false);
 }
 
-void AddressArbiter::RemoveThread(std::shared_ptr<Thread> thread) {
-    const VAddr arb_addr = thread->GetArbiterWaitAddress();
-    std::list<std::shared_ptr<Thread>>& thread_list = arb_threads[arb_addr];
-    auto it = thread_list.begin();
-    while (it != thread_list.end()) {
-        const std::shared_ptr<Thread>& current_thread = *it;
-        if (current_thread.get() == thread.get()) {
-            thread_list.erase(it);
-            return;
-        }
-        ++it;
-    }
-    UNREACHABLE();
+void AddressArbiter::RemoveThread(Thread& thread) {
+    const auto iter = arb_threads.find(thread.GetArbiterWaitAddress());
+    ASSERT(iter != arb_threads.end());
+    iter->second.remove(thread);
 }
 
-std::vector<std::shared_ptr<Thread>> AddressArbiter::GetThreadsWaitingOnAddress(VAddr address) {
-    std::vector<std::shared_ptr<Thread>> result;
-    std::list<std::shared_ptr<Thread>>& thread_list = arb_threads[address];
-    auto it = thread_list.begin();
-    while (it != thread_list.end()) {
-        std::shared_ptr<Thread> current_thread = *it;
-        result.push_back(std::move(current_thread));
-        ++it;
+std::size_t AddressArbiter::GetNumThreadsWaitingOnAddress(VAddr address) const {
+    const auto iter = arb_threads.find(address);
+    if (iter == arb_threads.end()) {
+        return 0;
     }
-    return result;
+    return iter->second.size();
 }
 } // namespace Kernel
@@ -4,12 +4,11 @@
 
 #pragma once
 
-#include <list>
 #include <memory>
 #include <unordered_map>
-#include <vector>
 
 #include "common/common_types.h"
+#include "core/hle/kernel/thread.h"
 
 union ResultCode;
 
@@ -19,8 +18,6 @@ class System;
 
 namespace Kernel {
 
-class Thread;
-
 class AddressArbiter {
 public:
     enum class ArbitrationType {
@@ -76,20 +73,21 @@ private:
     // Waits on the given address with a timeout in nanoseconds
     ResultCode WaitForAddressImpl(VAddr address, s64 timeout);
 
-    /// Wake up num_to_wake (or all) threads in a vector.
-    void WakeThreads(const std::vector<std::shared_ptr<Thread>>& waiting_threads, s32 num_to_wake);
+    /// Wake up num_to_wake (or all) threads waiting on an address.
+    void WakeThreads(VAddr address, s32 num_to_wake);
 
     /// Insert a thread into the address arbiter container
-    void InsertThread(std::shared_ptr<Thread> thread);
+    void InsertThread(Thread& thread);
 
     /// Removes a thread from the address arbiter container
-    void RemoveThread(std::shared_ptr<Thread> thread);
+    void RemoveThread(Thread& thread);
 
-    // Gets the threads waiting on an address.
-    std::vector<std::shared_ptr<Thread>> GetThreadsWaitingOnAddress(VAddr address);
+    /// Gets the number of threads waiting on an address.
+    std::size_t GetNumThreadsWaitingOnAddress(VAddr address) const;
 
-    /// List of threads waiting for a address arbiter
-    std::unordered_map<VAddr, std::list<std::shared_ptr<Thread>>> arb_threads;
+    /// Queues of threads waiting for a address arbiter. Queues are kept once created so that
+    /// waiting on an address does not allocate.
+    std::unordered_map<VAddr, ThreadWaitQueue> arb_threads;
 
     Core::System& system;
 };
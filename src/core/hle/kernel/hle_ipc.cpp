@@ -283,18 +283,9 @@ ResultCode HLERequestContext::WriteToOutgoingCommandBuffer(Thread& thread) {
 }
 
 std::vector<u8> HLERequestContext::ReadBuffer(int buffer_index) const {
-    std::vector<u8> buffer;
-    const bool is_buffer_a{BufferDescriptorA().size() && BufferDescriptorA()[buffer_index].Size()};
-    auto& memory = Core::System::GetInstance().Memory();
-
-    if (is_buffer_a) {
-        buffer.resize(BufferDescriptorA()[buffer_index].Size());
-        memory.ReadBlock(BufferDescriptorA()[buffer_index].Address(), buffer.data(), buffer.size());
-    } else {
-        buffer.resize(BufferDescriptorX()[buffer_index].Size());
-        memory.ReadBlock(BufferDescriptorX()[buffer_index].Address(), buffer.data(), buffer.size());
-    }
-
+    std::vector<u8> buffer(GetReadBufferSize(buffer_index));
+    Core::System::GetInstance().Memory().ReadBlock(GetReadBufferAddress(buffer_index),
+                                                   buffer.data(), buffer.size());
     return buffer;
 }
 
@@ -305,7 +296,6 @@ std::size_t HLERequestContext::WriteBuffer(const void* buffer, std::size_t size,
         return 0;
     }
 
-    const bool is_buffer_b{BufferDescriptorB().size() && BufferDescriptorB()[buffer_index].Size()};
     const std::size_t buffer_size{GetWriteBufferSize(buffer_index)};
     if (size > buffer_size) {
         LOG_CRITICAL(Core, "size ({:016X}) is greater than buffer_size ({:016X})", size,
@@ -313,13 +303,113 @@ std::size_t HLERequestContext::WriteBuffer(const void* buffer, std::size_t size,
         size = buffer_size; // TODO(bunnei): This needs to be HW tested
     }
 
+    Core::System::GetInstance().Memory().WriteBlock(GetWriteBufferAddress(buffer_index), buffer,
+                                                    size);
+    return size;
+}
+
+Common::Span<const u8> HLERequestContext::ReadBufferSpan(int buffer_index) {
+    const VAddr address = GetReadBufferAddress(buffer_index);
+    const std::size_t size = GetReadBufferSize(buffer_index);
     auto& memory = Core::System::GetInstance().Memory();
-    if (is_buffer_b) {
-        memory.WriteBlock(BufferDescriptorB()[buffer_index].Address(), buffer, size);
-    } else {
-        memory.WriteBlock(BufferDescriptorC()[buffer_index].Address(), buffer, size);
+    if (const u8* const pointer = memory.GetContiguousPointer(address, size)) {
+        return {pointer, size};
+    }
+
+    if (read_buffer_copies.size() <= static_cast<std::size_t>(buffer_index)) {
+        read_buffer_copies.resize(buffer_index + 1);
+    }
+    auto& copy = read_buffer_copies[buffer_index];
+    copy.resize(size);
+    memory.ReadBlock(address, copy.data(), size);
+    return copy;
+}
+
+Common::Span<u8> HLERequestContext::WriteBufferSpan(int buffer_index) {
+    const VAddr address = GetWriteBufferAddress(buffer_index);
+    const std::size_t size = GetWriteBufferSize(buffer_index);
+    auto& memory = Core::System::GetInstance().Memory();
+
+    // Writing in place must not clobber input buffers the service may still have to read, which
+    // happens when the guest passes the same memory for input and output.
+    if (!OverlapsReadBuffers(address, size)) {
+        if (u8* const pointer = memory.GetContiguousPointer(address, size)) {
+            return {pointer, size};
+        }
+    }
+
+    if (write_buffer_copies.size() <= static_cast<std::size_t>(buffer_index)) {
+        write_buffer_copies.resize(buffer_index + 1);
+    }
+    auto& copy = write_buffer_copies[buffer_index];
+    copy.resize(size);
+    return copy;
+}
+
+std::size_t HLERequestContext::CommitWriteBufferSpan(std::size_t size, int buffer_index) {
+    ASSERT(size <= GetWriteBufferSize(buffer_index));
+
+    // Spans pointing at guest memory need no further work.
+    if (write_buffer_copies.size() <= static_cast<std::size_t>(buffer_index) ||
+        write_buffer_copies[buffer_index].empty()) {
+        return size;
+    }
+
+    auto& copy = write_buffer_copies[buffer_index];
+    Core::System::GetInstance().Memory().WriteBlock(GetWriteBufferAddress(buffer_index),
+                                                    copy.data(), size);
+    copy.clear();
+    return size;
+}
+
+Common::Span<const u8> HLERequestContext::ReadBufferSpan(int buffer_index,
+                                                         Common::Span<u8> scratch) {
+    const VAddr address = GetReadBufferAddress(buffer_index);
+    const std::size_t size = GetReadBufferSize(buffer_index);
+    auto& memory = Core::System::GetInstance().Memory();
+    if (const u8* const pointer = memory.GetContiguousPointer(address, size)) {
+        return {pointer, size};
+    }
+    if (scratch.size() < size) {
+        return ReadBufferSpan(buffer_index);
+    }
+
+    memory.ReadBlock(address, scratch.data(), size);
+    return scratch.first(size);
+}
+
+Common::Span<u8> HLERequestContext::WriteBufferSpan(int buffer_index, Common::Span<u8> scratch) {
+    const VAddr address = GetWriteBufferAddress(buffer_index);
+    const std::size_t size = GetWriteBufferSize(buffer_index);
+    if (!OverlapsReadBuffers(address, size)) {
+        auto& memory = Core::System::GetInstance().Memory();
+        if (u8* const pointer = memory.GetContiguousPointer(address, size)) {
+            return {pointer, size};
+        }
+    }
+    if (scratch.size() < size) {
+        return WriteBufferSpan(buffer_index);
+    }
+    return scratch.first(size);
+}
+
+std::size_t HLERequestContext::CommitWriteBufferSpan(Common::Span<const u8> span, std::size_t size,
+                                                     int buffer_index) {
+    ASSERT(size <= span.size());
+
+    const VAddr address = GetWriteBufferAddress(buffer_index);
+    auto& memory = Core::System::GetInstance().Memory();
+    // Spans pointing at guest memory need no further work.
+    if (memory.GetContiguousPointer(address, span.size()) == span.data()) {
+        return size;
+    }
+    // Spans from the allocating fallback are owned by this context.
+    if (static_cast<std::size_t>(buffer_index) < write_buffer_copies.size() &&
+        write_buffer_copies[buffer_index].data() == span.data()) {
+        return CommitWriteBufferSpan(size, buffer_index);
     }
 
+    memory.WriteBlock(address, span.data(), size);
     return size;
 }
 
@@ -335,6 +425,27 @@ std::size_t HLERequestContext::GetWriteBufferSize(int buffer_index) const {
                        : BufferDescriptorC()[buffer_index].Size();
 }
 
+VAddr HLERequestContext::GetReadBufferAddress(int buffer_index) const {
+    const bool is_buffer_a{BufferDescriptorA().size() && BufferDescriptorA()[buffer_index].Size()};
+    return is_buffer_a ? BufferDescriptorA()[buffer_index].Address()
+                       : BufferDescriptorX()[buffer_index].Address();
+}
+
+VAddr HLERequestContext::GetWriteBufferAddress(int buffer_index) const {
+    const bool is_buffer_b{BufferDescriptorB().size() && BufferDescriptorB()[buffer_index].Size()};
+    return is_buffer_b ? BufferDescriptorB()[buffer_index].Address()
+                       : BufferDescriptorC()[buffer_index].Address();
+}
+
+bool HLERequestContext::OverlapsReadBuffers(VAddr address, std::size_t size) const {
+    const auto overlaps = [address, size](const auto& descriptor) {
+        return descriptor.Address() < address + size &&
+               address < descriptor.Address() + descriptor.Size();
+    };
+    return std::any_of(buffer_a_desciptors.begin(), buffer_a_desciptors.end(), overlaps) ||
+           std::any_of(buffer_x_desciptors.begin(), buffer_x_desciptors.end(), overlaps);
+}
+
 std::string HLERequestContext::Description() const {
     if (!command_header) {
         return "No command header available";
@@ -13,6 +13,7 @@
 #include <vector>
 #include <boost/container/small_vector.hpp>
 #include "common/common_types.h"
+#include "common/span.h"
 #include "common/swap.h"
 #include "core/hle/ipc.h"
 #include "core/hle/kernel/object.h"
@@ -204,6 +205,42 @@ public:
                            buffer_index);
     }
 
+    /**
+     * Helper function to access an input buffer without copying it. The returned span points
+     * directly at guest memory if the buffer is contiguous in host memory, and at a copy owned by
+     * this context otherwise. It remains valid until the next call for the same buffer index.
+     */
+    Common::Span<const u8> ReadBufferSpan(int buffer_index = 0);
+
+    /**
+     * Helper function to write an output buffer in place. The returned span covers the whole
+     * output buffer and points directly at guest memory if the buffer is contiguous in host
+     * memory, and at scratch space owned by this context otherwise. Once the service has written
+     * to it, CommitWriteBufferSpan must be called with the number of bytes written.
+     */
+    Common::Span<u8> WriteBufferSpan(int buffer_index = 0);
+
+    /// Makes the first `size` bytes written to a span from WriteBufferSpan visible to the guest.
+    std::size_t CommitWriteBufferSpan(std::size_t size, int buffer_index = 0);
+
+    /**
+     * Variant of ReadBufferSpan that copies the buffer to the given scratch space instead of
+     * allocating when it can't be accessed in place. Falls back to allocating if the scratch space
+     * is too small.
+     */
+    Common::Span<const u8> ReadBufferSpan(int buffer_index, Common::Span<u8> scratch);
+
+    /**
+     * Variant of WriteBufferSpan that hands out the given scratch space instead of allocating when
+     * the buffer can't be written in place. Falls back to allocating if the scratch space is too
+     * small. The span must be committed with CommitWriteBufferSpan(span, size, buffer_index).
+     */
+    Common::Span<u8> WriteBufferSpan(int buffer_index, Common::Span<u8> scratch);
+
+    /// Makes the first `size` bytes written to a span from WriteBufferSpan visible to the guest.
+    std::size_t CommitWriteBufferSpan(Common::Span<const u8> span, std::size_t size,
+                                      int buffer_index = 0);
+
     /// Helper function to get the size of the input buffer
     std::size_t GetReadBufferSize(int buffer_index = 0) const;
 
@@ -279,6 +316,10 @@ public:
 private:
     void ParseCommandBuffer(const HandleTable& handle_table, u32_le* src_cmdbuf, bool incoming);
 
+    VAddr GetReadBufferAddress(int buffer_index) const;
+    VAddr GetWriteBufferAddress(int buffer_index) const;
+    bool OverlapsReadBuffers(VAddr address, std::size_t size) const;
+
     std::array<u32, IPC::COMMAND_BUFFER_LENGTH> cmd_buf;
     std::shared_ptr<Kernel::ServerSession> server_session;
     std::shared_ptr<Thread> thread;
@@ -297,6 +338,10 @@ private:
     std::vector<IPC::BufferDescriptorABW> buffer_w_desciptors;
     std::vector<IPC::BufferDescriptorC> buffer_c_desciptors;
 
+    /// Copies of buffers accessed through spans that are not contiguous in host memory.
+    std::vector<std::vector<u8>> read_buffer_copies;
+    std::vector<std::vector<u8>> write_buffer_copies;
+
     unsigned data_payload_offset{};
     unsigned buffer_c_offset{};
     u32_le command{};
@@ -65,7 +65,7 @@ static void ThreadWakeupCallback(u64 thread_handle, [[maybe_unused]] s64 cycles_
         thread->SetMutexWaitAddress(0);
         thread->SetWaitHandle(0);
         if (thread->GetStatus() == ThreadStatus::WaitCondVar) {
-            thread->GetOwnerProcess()->RemoveConditionVariableThread(thread);
+            thread->GetOwnerProcess()->RemoveConditionVariableThread(*thread);
             thread->SetCondVarWaitAddress(0);
         }
 
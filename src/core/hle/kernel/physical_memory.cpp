@@ -0,0 +1,100 @@
+// Copyright 2019 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <new>
+#include <utility>
+#include "common/alignment.h"
+#include "common/assert.h"
+#include "common/virtual_buffer.h"
+#include "core/hle/kernel/physical_memory.h"
+#include "core/memory.h"
+
+namespace Kernel {
+
+PhysicalMemory::PhysicalMemory(std::size_t size) {
+    resize(size);
+}
+
+PhysicalMemory::~PhysicalMemory() {
+    Common::FreeMemoryPages(base, reserved_size);
+}
+
+PhysicalMemory::PhysicalMemory(PhysicalMemory&& rhs) noexcept {
+    *this = std::move(rhs);
+}
+
+PhysicalMemory& PhysicalMemory::operator=(PhysicalMemory&& rhs) noexcept {
+    Common::FreeMemoryPages(base, reserved_size);
+    base = std::exchange(rhs.base, nullptr);
+    used_size = std::exchange(rhs.used_size, 0);
+    reserved_size = std::exchange(rhs.reserved_size, 0);
+    dirty_size = std::exchange(rhs.dirty_size, 0);
+    is_reserved = std::exchange(rhs.is_reserved, false);
+    return *this;
+}
+
+std::optional<PhysicalMemory> PhysicalMemory::Reserve(std::size_t size) {
+    PhysicalMemory memory;
+    memory.reserved_size = Common::AlignUp(size, Memory::PAGE_SIZE);
+    memory.base = static_cast<u8*>(Common::ReserveMemoryPages(memory.reserved_size));
+    if (memory.base == nullptr) {
+        return std::nullopt;
+    }
+    memory.used_size = size;
+    memory.is_reserved = true;
+    return memory;
+}
+
+void PhysicalMemory::reserve(std::size_t new_capacity) {
+    if (new_capacity > reserved_size) {
+        Reallocate(new_capacity);
+    }
+}
+
+void PhysicalMemory::resize(std::size_t new_size) {
+    ASSERT_MSG(!is_reserved, "Reserved blocks can't be resized");
+    if (new_size > reserved_size) {
+        Reallocate(std::max(new_size, reserved_size * 2));
+    }
+    if (new_size > used_size && used_size < dirty_size) {
+        // Clear what a previous shrink left behind, the rest of the pages are still untouched.
+        std::memset(base + used_size, 0, std::min(new_size, dirty_size) - used_size);
+    }
+    used_size = new_size;
+    dirty_size = std::max(dirty_size, new_size);
+}
+
+bool PhysicalMemory::Commit(std::size_t offset, std::size_t size) {
+    ASSERT(is_reserved && offset + size <= used_size);
+    const std::size_t begin = Common::AlignDown(offset, Memory::PAGE_SIZE);
+    const std::size_t end = Common::AlignUp(offset + size, Memory::PAGE_SIZE);
+    return Common::CommitMemoryPages(base + begin, end - begin);
+}
+
+void PhysicalMemory::Decommit(std::size_t offset, std::size_t size) {
+    ASSERT(offset + size <= used_size);
+    // Only release whole pages, partially covered pages may still hold data in use.
+    const std::size_t begin = Common::AlignUp(offset, Memory::PAGE_SIZE);
+    const std::size_t end = Common::AlignDown(offset + size, Memory::PAGE_SIZE);
+    if (begin < end) {
+        Common::DecommitMemoryPages(base + begin, end - begin);
+    }
+}
+
+void PhysicalMemory::Reallocate(std::size_t new_capacity) {
+    new_capacity = Common::AlignUp(new_capacity, Memory::PAGE_SIZE);
+    auto* const new_base = static_cast<u8*>(Common::AllocateMemoryPages(new_capacity));
+    if (new_base == nullptr) {
+        throw std::bad_alloc();
+    }
+    if (base != nullptr) {
+        std::memcpy(new_base, base, used_size);
+        Common::FreeMemoryPages(base, reserved_size);
+    }
+    base = new_base;
+    reserved_size = new_capacity;
+    dirty_size = used_size;
+}
+
+} // namespace Kernel
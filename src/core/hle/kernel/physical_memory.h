@@ -4,16 +4,130 @@
 
 #pragma once
 
-#include "common/alignment.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <optional>
+#include "common/common_types.h"
 
 namespace Kernel {
 
-// This encapsulation serves 2 purposes:
-// - First, to encapsulate host physical memory under a single type and set an
-// standard for managing it.
-// - Second to ensure all host backing memory used is aligned to 256 bytes due
-// to strict alignment restrictions on GPU memory.
+/**
+ * Host memory backing guest physical memory.
+ *
+ * This encapsulation serves 3 purposes:
+ * - First, to encapsulate host physical memory under a single type and set an standard for
+ *   managing it.
+ * - Second to ensure all host backing memory used is page aligned due to strict alignment
+ *   restrictions on GPU memory.
+ * - Third, to let the host commit pages lazily. Blocks are allocated directly from host virtual
+ *   memory, so untouched pages don't take physical memory and released ranges can be given back
+ *   to the host with Decommit.
+ *
+ * The interface mirrors the subset of std::vector used by the kernel and the loaders.
+ */
+class PhysicalMemory final {
+public:
+    PhysicalMemory() = default;
 
-using PhysicalMemory = std::vector<u8, Common::AlignmentAllocator<u8, 256>>;
+    /// Allocates a zero filled block of the given size.
+    explicit PhysicalMemory(std::size_t size);
+
+    ~PhysicalMemory();
+
+    PhysicalMemory(const PhysicalMemory&) = delete;
+    PhysicalMemory& operator=(const PhysicalMemory&) = delete;
+
+    PhysicalMemory(PhysicalMemory&& rhs) noexcept;
+    PhysicalMemory& operator=(PhysicalMemory&& rhs) noexcept;
+
+    /**
+     * Creates a block that only reserves host address space. Ranges of it have to be committed
+     * with Commit before they are accessed, this allows reserving blocks much larger than the
+     * memory they end up using. The block can't be resized.
+     * Returns an empty optional if the host address space can't be reserved.
+     */
+    static std::optional<PhysicalMemory> Reserve(std::size_t size);
+
+    u8* data() noexcept {
+        return base;
+    }
+
+    const u8* data() const noexcept {
+        return base;
+    }
+
+    std::size_t size() const noexcept {
+        return used_size;
+    }
+
+    std::size_t capacity() const noexcept {
+        return reserved_size;
+    }
+
+    bool empty() const noexcept {
+        return used_size == 0;
+    }
+
+    u8& operator[](std::size_t index) noexcept {
+        return base[index];
+    }
+
+    const u8& operator[](std::size_t index) const noexcept {
+        return base[index];
+    }
+
+    u8* begin() noexcept {
+        return base;
+    }
+
+    const u8* begin() const noexcept {
+        return base;
+    }
+
+    u8* end() noexcept {
+        return base + used_size;
+    }
+
+    const u8* end() const noexcept {
+        return base + used_size;
+    }
+
+    /// Grows the reserved memory to hold at least new_capacity bytes without moving again.
+    void reserve(std::size_t new_capacity);
+
+    /// Resizes the block, new bytes are zero filled.
+    void resize(std::size_t new_size);
+
+    /// Inserts the range [first, last) before pos. The range can't come from this block.
+    template <typename InputIt>
+    u8* insert(const u8* pos, InputIt first, InputIt last) {
+        const auto index = static_cast<std::size_t>(pos - base);
+        const auto count = static_cast<std::size_t>(std::distance(first, last));
+        const std::size_t old_size = used_size;
+        resize(used_size + count);
+        std::memmove(base + index + count, base + index, old_size - index);
+        std::copy(first, last, base + index);
+        return base + index;
+    }
+
+    /// Commits a range of a block created with Reserve, returns false if the host is out of memory.
+    [[nodiscard]] bool Commit(std::size_t offset, std::size_t size);
+
+    /// Gives the host pages of a range back to the host, the range reads as zero afterwards.
+    void Decommit(std::size_t offset, std::size_t size);
+
+private:
+    /// Moves the contents to a new allocation of new_capacity bytes.
+    void Reallocate(std::size_t new_capacity);
+
+    u8* base = nullptr;
+    std::size_t used_size = 0;
+    std::size_t reserved_size = 0;
+    /// Bytes past this offset have never been written and are known to be zero.
+    std::size_t dirty_size = 0;
+    bool is_reserved = false;
+};
 
 } // namespace Kernel
@@ -142,47 +142,23 @@ u64 Process::GetTotalPhysicalMemoryUsedWithoutSystemResource() const {
     return GetTotalPhysicalMemoryUsed() - GetSystemResourceUsage();
 }
 
-void Process::InsertConditionVariableThread(std::shared_ptr<Thread> thread) {
-    VAddr cond_var_addr = thread->GetCondVarWaitAddress();
-    std::list<std::shared_ptr<Thread>>& thread_list = cond_var_threads[cond_var_addr];
-    auto it = thread_list.begin();
-    while (it != thread_list.end()) {
-        const std::shared_ptr<Thread> current_thread = *it;
-        if (current_thread->GetPriority() > thread->GetPriority()) {
-            thread_list.insert(it, thread);
-            return;
-        }
-        ++it;
-    }
-    thread_list.push_back(thread);
+void Process::InsertConditionVariableThread(Thread& thread) {
+    // Threads are placed after any waiting threads of the same priority.
+    cond_var_threads[thread.GetCondVarWaitAddress()].add(thread, thread.GetPriority());
 }
 
-void Process::RemoveConditionVariableThread(std::shared_ptr<Thread> thread) {
-    VAddr cond_var_addr = thread->GetCondVarWaitAddress();
-    std::list<std::shared_ptr<Thread>>& thread_list = cond_var_threads[cond_var_addr];
-    auto it = thread_list.begin();
-    while (it != thread_list.end()) {
-        const std::shared_ptr<Thread> current_thread = *it;
-        if (current_thread.get() == thread.get()) {
-            thread_list.erase(it);
-            return;
-        }
-        ++it;
-    }
-    UNREACHABLE();
+void Process::RemoveConditionVariableThread(Thread& thread) {
+    const auto iter = cond_var_threads.find(thread.GetCondVarWaitAddress());
+    ASSERT(iter != cond_var_threads.end());
+    iter->second.remove(thread);
 }
 
-std::vector<std::shared_ptr<Thread>> Process::GetConditionVariableThreads(
-    const VAddr cond_var_addr) {
-    std::vector<std::shared_ptr<Thread>> result{};
-    std::list<std::shared_ptr<Thread>>& thread_list = cond_var_threads[cond_var_addr];
-    auto it = thread_list.begin();
-    while (it != thread_list.end()) {
-        std::shared_ptr<Thread> current_thread = *it;
-        result.push_back(current_thread);
-        ++it;
+Thread* Process::GetConditionVariableThread(const VAddr cond_var_addr) const {
+    const auto iter = cond_var_threads.find(cond_var_addr);
+    if (iter == cond_var_threads.end()) {
+        return nullptr;
     }
-    return result;
+    return iter->second.front();
 }
 
 void Process::RegisterThread(const Thread* thread) {
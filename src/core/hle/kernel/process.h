@@ -238,13 +238,13 @@ public:
     }
 
     /// Insert a thread into the condition variable wait container
-    void InsertConditionVariableThread(std::shared_ptr<Thread> thread);
+    void InsertConditionVariableThread(Thread& thread);
 
     /// Remove a thread from the condition variable wait container
-    void RemoveConditionVariableThread(std::shared_ptr<Thread> thread);
+    void RemoveConditionVariableThread(Thread& thread);
 
-    /// Obtain all condition variable threads waiting for some address
-    std::vector<std::shared_ptr<Thread>> GetConditionVariableThreads(VAddr cond_var_addr);
+    /// Obtain the highest priority thread waiting for a condition variable, or nullptr if none.
+    Thread* GetConditionVariableThread(VAddr cond_var_addr) const;
 
     /// Registers a thread as being created under this process,
     /// adding it to this process' thread list.
@@ -386,8 +386,9 @@ private:
     /// List of threads that are running with this process as their owner.
     std::list<const Thread*> thread_list;
 
-    /// List of threads waiting for a condition variable
-    std::unordered_map<VAddr, std::list<std::shared_ptr<Thread>>> cond_var_threads;
+    /// Queues of threads waiting for a condition variable. Queues are kept once created so that
+    /// waiting on a condition variable does not allocate.
+    std::unordered_map<VAddr, ThreadWaitQueue> cond_var_threads;
 
     /// System context
     Core::System& system;
@@ -27,20 +27,24 @@ GlobalScheduler::GlobalScheduler(Core::System& system) : system{system} {}
 GlobalScheduler::~GlobalScheduler() = default;
 
 void GlobalScheduler::AddThread(std::shared_ptr<Thread> thread) {
+    std::lock_guard lock{scheduler_lock};
     thread_list.push_back(std::move(thread));
 }
 
 void GlobalScheduler::RemoveThread(std::shared_ptr<Thread> thread) {
+    std::lock_guard lock{scheduler_lock};
     thread_list.erase(std::remove(thread_list.begin(), thread_list.end(), thread),
                       thread_list.end());
 }
 
 void GlobalScheduler::UnloadThread(std::size_t core) {
-    Scheduler& sched = system.Scheduler(core);
+    std::lock_guard lock{scheduler_lock};
+    Scheduler& sched = *schedulers[core];
     sched.UnloadThread();
 }
 
 void GlobalScheduler::SelectThread(std::size_t core) {
+    std::lock_guard lock{scheduler_lock};
     const auto update_thread = [](Thread* thread, Scheduler& sched) {
         if (thread != sched.selected_thread.get()) {
             if (thread == nullptr) {
@@ -51,7 +55,7 @@ void GlobalScheduler::SelectThread(std::size_t core) {
         sched.is_context_switch_pending = sched.selected_thread != sched.current_thread;
         std::atomic_thread_fence(std::memory_order_seq_cst);
     };
-    Scheduler& sched = system.Scheduler(core);
+    Scheduler& sched = *schedulers[core];
     Thread* current_thread = nullptr;
     // Step 1: Get top thread in schedule queue.
     current_thread = scheduled_queue[core].empty() ? nullptr : scheduled_queue[core].front();
@@ -102,6 +106,7 @@ void GlobalScheduler::SelectThread(std::size_t core) {
 }
 
 bool GlobalScheduler::YieldThread(Thread* yielding_thread) {
+    std::lock_guard lock{scheduler_lock};
     // Note: caller should use critical section, etc.
     const u32 core_id = static_cast<u32>(yielding_thread->GetProcessorID());
     const u32 priority = yielding_thread->GetPriority();
@@ -115,6 +120,7 @@ bool GlobalScheduler::YieldThread(Thread* yielding_thread) {
 }
 
 bool GlobalScheduler::YieldThreadAndBalanceLoad(Thread* yielding_thread) {
+    std::lock_guard lock{scheduler_lock};
     // Note: caller should check if !thread.IsSchedulerOperationRedundant and use critical section,
     // etc.
     const u32 core_id = static_cast<u32>(yielding_thread->GetProcessorID());
@@ -166,6 +172,7 @@ bool GlobalScheduler::YieldThreadAndBalanceLoad(Thread* yielding_thread) {
 }
 
 bool GlobalScheduler::YieldThreadAndWaitForLoadBalancing(Thread* yielding_thread) {
+    std::lock_guard lock{scheduler_lock};
     // Note: caller should check if !thread.IsSchedulerOperationRedundant and use critical section,
     // etc.
     Thread* winner = nullptr;
@@ -209,6 +216,7 @@ bool GlobalScheduler::YieldThreadAndWaitForLoadBalancing(Thread* yielding_thread
 }
 
 void GlobalScheduler::PreemptThreads() {
+    std::lock_guard lock{scheduler_lock};
     for (std::size_t core_id = 0; core_id < NUM_CPU_CORES; core_id++) {
         const u32 priority = preemption_priorities[core_id];
 
@@ -293,29 +301,35 @@ void GlobalScheduler::PreemptThreads() {
 }
 
 void GlobalScheduler::Suggest(u32 priority, std::size_t core, Thread* thread) {
+    std::lock_guard lock{scheduler_lock};
     suggested_queue[core].add(thread, priority);
 }
 
 void GlobalScheduler::Unsuggest(u32 priority, std::size_t core, Thread* thread) {
+    std::lock_guard lock{scheduler_lock};
     suggested_queue[core].remove(thread, priority);
 }
 
 void GlobalScheduler::Schedule(u32 priority, std::size_t core, Thread* thread) {
+    std::lock_guard lock{scheduler_lock};
     ASSERT_MSG(thread->GetProcessorID() == s32(core), "Thread must be assigned to this core.");
     scheduled_queue[core].add(thread, priority);
 }
 
 void GlobalScheduler::SchedulePrepend(u32 priority, std::size_t core, Thread* thread) {
+    std::lock_guard lock{scheduler_lock};
     ASSERT_MSG(thread->GetProcessorID() == s32(core), "Thread must be assigned to this core.");
     scheduled_queue[core].add(thread, priority, false);
 }
 
 void GlobalScheduler::Reschedule(u32 priority, std::size_t core, Thread* thread) {
+    std::lock_guard lock{scheduler_lock};
     scheduled_queue[core].remove(thread, priority);
     scheduled_queue[core].add(thread, priority);
 }
 
 void GlobalScheduler::Unschedule(u32 priority, std::size_t core, Thread* thread) {
+    std::lock_guard lock{scheduler_lock};
     scheduled_queue[core].remove(thread, priority);
 }
 
@@ -338,6 +352,24 @@ void GlobalScheduler::TransferToCore(u32 priority, s32 destination_core, Thread*
     }
 }
 
+bool GlobalScheduler::HaveReadyThreads(std::size_t core_id) const {
+    std::lock_guard lock{scheduler_lock};
+    return !scheduled_queue[core_id].empty();
+}
+
+bool GlobalScheduler::IsSelectionUpToDate(std::size_t core) const {
+    std::lock_guard lock{scheduler_lock};
+    const Scheduler& sched = *schedulers[core];
+    Thread* const top_thread =
+        scheduled_queue[core].empty() ? nullptr : scheduled_queue[core].front();
+    if (top_thread == nullptr && !suggested_queue[core].empty()) {
+        // The core is idle but it could pick a suggested thread.
+        return false;
+    }
+    return !sched.is_context_switch_pending && top_thread == sched.current_thread.get() &&
+           sched.selected_thread == sched.current_thread;
+}
+
 bool GlobalScheduler::AskForReselectionOrMarkRedundant(Thread* current_thread,
                                                        const Thread* winner) {
     if (current_thread == winner) {
@@ -349,7 +381,25 @@ bool GlobalScheduler::AskForReselectionOrMarkRedundant(Thread* current_thread,
     }
 }
 
+void GlobalScheduler::FlushVectorState(const Thread& thread) {
+    std::lock_guard lock{scheduler_lock};
+    for (std::size_t core = 0; core < NUM_CPU_CORES; core++) {
+        Scheduler& sched = *schedulers[core];
+        if (sched.vector_state_thread.get() == &thread) {
+            sched.SaveVectorState();
+        }
+    }
+}
+
+void GlobalScheduler::FlushVectorStates() {
+    std::lock_guard lock{scheduler_lock};
+    for (std::size_t core = 0; core < NUM_CPU_CORES; core++) {
+        schedulers[core]->SaveVectorState();
+    }
+}
+
 void GlobalScheduler::Shutdown() {
+    std::lock_guard lock{scheduler_lock};
     for (std::size_t core = 0; core < NUM_CPU_CORES; core++) {
         scheduled_queue[core].clear();
         suggested_queue[core].clear();
@@ -358,9 +408,13 @@ void GlobalScheduler::Shutdown() {
 }
 
 Scheduler::Scheduler(Core::System& system, Core::ARM_Interface& cpu_core, std::size_t core_id)
-    : system(system), cpu_core(cpu_core), core_id(core_id) {}
+    : system(system), cpu_core(cpu_core), core_id(core_id) {
+    system.GlobalScheduler().schedulers[core_id] = this;
+}
 
-Scheduler::~Scheduler() = default;
+Scheduler::~Scheduler() {
+    system.GlobalScheduler().schedulers[core_id] = nullptr;
+}
 
 bool Scheduler::HaveReadyThreads() const {
     return system.GlobalScheduler().HaveReadyThreads(core_id);
@@ -383,6 +437,7 @@ u64 Scheduler::GetLastContextSwitchTicks() const {
 }
 
 void Scheduler::TryDoContextSwitch() {
+    std::lock_guard lock{system.GlobalScheduler().scheduler_lock};
     if (is_context_switch_pending) {
         SwitchContext();
     }
@@ -406,6 +461,7 @@ void Scheduler::UnloadThread() {
             previous_thread->SetStatus(ThreadStatus::Ready);
         }
         previous_thread->SetIsRunning(false);
+        vector_state_thread = nullptr;
     }
     current_thread = nullptr;
 }
@@ -419,13 +475,15 @@ void Scheduler::SwitchContext() {
         return;
     }
 
+    const auto switch_start = std::chrono::steady_clock::now();
     Process* const previous_process = system.Kernel().CurrentProcess();
 
     UpdateLastContextSwitchTime(previous_thread, previous_process);
 
-    // Save context for previous thread
+    // Save context for previous thread, its vector state stays in the CPU until another thread
+    // needs it.
     if (previous_thread) {
-        cpu_core.SaveContext(previous_thread->GetContext());
+        cpu_core.SaveGeneralContext(previous_thread->GetContext());
         // Save the TPIDR_EL0 system register in case it was modified.
         previous_thread->SetTPIDR_EL0(cpu_core.GetTPIDR_EL0());
 
@@ -436,6 +494,7 @@ void Scheduler::SwitchContext() {
         }
         previous_thread->SetIsRunning(false);
     }
+    current_thread = nullptr;
 
     // Load context of new thread
     if (new_thread) {
@@ -446,23 +505,47 @@ void Scheduler::SwitchContext() {
 
         // Cancel any outstanding wakeup events for this thread
         new_thread->CancelWakeupTimer();
-        current_thread = SharedFrom(new_thread);
-        new_thread->SetStatus(ThreadStatus::Running);
-        new_thread->SetIsRunning(true);
 
-        auto* const thread_owner_process = current_thread->GetOwnerProcess();
+        auto* const thread_owner_process = new_thread->GetOwnerProcess();
         if (previous_process != thread_owner_process) {
+            // Changing the page table changes the JIT of every core, which would drop the vector
+            // state they hold.
+            system.GlobalScheduler().FlushVectorStates();
             system.Kernel().MakeCurrentProcess(thread_owner_process);
         }
 
-        cpu_core.LoadContext(new_thread->GetContext());
+        if (vector_state_thread.get() == new_thread) {
+            ++context_switch_statistics.lazy_vector_switches;
+        } else {
+            SaveVectorState();
+            // The thread may have last run on another core that still holds its vector state.
+            system.GlobalScheduler().FlushVectorState(*new_thread);
+            cpu_core.LoadVectorContext(new_thread->GetContext());
+            vector_state_thread = SharedFrom(new_thread);
+        }
+
+        current_thread = SharedFrom(new_thread);
+        new_thread->SetStatus(ThreadStatus::Running);
+        new_thread->SetIsRunning(true);
+
+        cpu_core.LoadGeneralContext(new_thread->GetContext());
         cpu_core.SetTlsAddress(new_thread->GetTLSAddress());
         cpu_core.SetTPIDR_EL0(new_thread->GetTPIDR_EL0());
-    } else {
-        current_thread = nullptr;
-        // Note: We do not reset the current process and current page table when idling because
-        // technically we haven't changed processes, our threads are just paused.
     }
+    // Note: We do not reset the current process and current page table when idling because
+    // technically we haven't changed processes, our threads are just paused.
+
+    ++context_switch_statistics.switches;
+    context_switch_statistics.switch_time += std::chrono::steady_clock::now() - switch_start;
+}
+
+void Scheduler::SaveVectorState() {
+    if (vector_state_thread == nullptr || vector_state_thread == current_thread) {
+        return;
+    }
+    cpu_core.SaveVectorContext(vector_state_thread->GetContext());
+    vector_state_thread = nullptr;
+    ++context_switch_statistics.vector_saves;
 }
 
 void Scheduler::UpdateLastContextSwitchTime(Thread* thread, Process* process) {
@@ -482,8 +565,16 @@ void Scheduler::UpdateLastContextSwitchTime(Thread* thread, Process* process) {
 }
 
 void Scheduler::Shutdown() {
+    const auto& stats = context_switch_statistics;
+    LOG_INFO(Kernel,
+             "Core {} context switches: {}, vector loads skipped: {}, deferred vector saves: {}, "
+             "switch time: {} us",
+             core_id, stats.switches, stats.lazy_vector_switches, stats.vector_saves,
+             std::chrono::duration_cast<std::chrono::microseconds>(stats.switch_time).count());
+
     current_thread = nullptr;
     selected_thread = nullptr;
+    vector_state_thread = nullptr;
 }
 
 } // namespace Kernel
@@ -5,12 +5,15 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include "common/common_types.h"
 #include "common/multi_level_queue.h"
 #include "core/hle/kernel/thread.h"
+#include "core/hle/lock.h"
 
 namespace Core {
 class ARM_Interface;
@@ -20,6 +23,7 @@ class System;
 namespace Kernel {
 
 class Process;
+class Scheduler;
 
 class GlobalScheduler final {
 public:
@@ -86,9 +90,20 @@ public:
      */
     void SelectThread(std::size_t core);
 
-    bool HaveReadyThreads(std::size_t core_id) const {
-        return !scheduled_queue[core_id].empty();
-    }
+    bool HaveReadyThreads(std::size_t core_id) const;
+
+    /**
+     * Returns true when selecting a thread for the core would keep its current thread and no
+     * context switch is pending. Only the scheduler lock is taken, so cores can check it without
+     * contending on the kernel lock.
+     */
+    bool IsSelectionUpToDate(std::size_t core) const;
+
+    /// Saves the vector state of the thread if a core still holds it in its CPU.
+    void FlushVectorState(const Thread& thread);
+
+    /// Saves the vector state held by every core, needed before the cores switch page tables.
+    void FlushVectorStates();
 
     /**
      * Takes a thread and moves it to the back of the it's priority list.
@@ -139,6 +154,8 @@ public:
     void Shutdown();
 
 private:
+    friend class Scheduler;
+
     /**
      * Transfers a thread into an specific core. If the destination_core is -1
      * it will be unscheduled from its source code and added into its suggested
@@ -153,12 +170,23 @@ private:
     std::array<Common::MultiLevelQueue<Thread*, THREADPRIO_COUNT>, NUM_CPU_CORES> suggested_queue;
     std::atomic<bool> is_reselection_pending{false};
 
+    /// Protects the scheduling queues and the thread selection of each core. When the kernel lock
+    /// is also needed it has to be acquired first.
+    /// This is a single lock for all cores, not one lock per core plus a migration lock: thread
+    /// selection, yielding and preemption read and move threads across the queues of every core,
+    /// so a per-core split needs those paths reworked around a migration protocol first.
+    mutable HLE::ProfiledMutex<std::recursive_mutex> scheduler_lock{HLE::LockDomain::Scheduler};
+
     // The priority levels at which the global scheduler preempts threads every 10 ms. They are
     // ordered from Core 0 to Core 3.
     std::array<u32, NUM_CPU_CORES> preemption_priorities = {59, 59, 59, 62};
 
     /// Lists all thread ids that aren't deleted/etc.
     std::vector<std::shared_ptr<Thread>> thread_list;
+
+    /// The scheduler of each core, set by the schedulers themselves so selecting a thread doesn't
+    /// go through the system and its CPU cores.
+    std::array<Scheduler*, NUM_CPU_CORES> schedulers{};
     Core::System& system;
 };
 
@@ -192,7 +220,22 @@ public:
         return is_context_switch_pending;
     }
 
-    /// Shutdowns the scheduler.
+    struct ContextSwitchStatistics {
+        u64 switches = 0;             ///< Context switches performed.
+        u64 lazy_vector_switches = 0; ///< Switches that found the vector state already loaded.
+        u64 vector_saves = 0;         ///< Deferred saves of the vector state.
+        std::chrono::nanoseconds switch_time{}; ///< Host time spent switching contexts.
+    };
+
+    const ContextSwitchStatistics& GetContextSwitchStatistics() const {
+        return context_switch_statistics;
+    }
+
+    void ResetContextSwitchStatistics() {
+        context_switch_statistics = {};
+    }
+
+    /// Shutdowns the scheduler, logging its context switch statistics.
     void Shutdown();
 
 private:
@@ -214,9 +257,18 @@ private:
      */
     void UpdateLastContextSwitchTime(Thread* thread, Process* process);
 
+    /// Saves the vector state the CPU holds for a thread that is no longer running.
+    void SaveVectorState();
+
     std::shared_ptr<Thread> current_thread = nullptr;
     std::shared_ptr<Thread> selected_thread = nullptr;
 
+    /// Thread whose vector state is loaded in the CPU. It is only saved once another thread needs
+    /// the vector registers, so a thread resumed on a core that idled in between skips both the
+    /// save and the load.
+    std::shared_ptr<Thread> vector_state_thread = nullptr;
+    ContextSwitchStatistics context_switch_statistics;
+
     Core::System& system;
     Core::ARM_Interface& cpu_core;
     u64 last_context_switch_time = 0;
@@ -18,6 +18,7 @@
 #include "core/core_cpu.h"
 #include "core/core_timing.h"
 #include "core/core_timing_util.h"
+#include "core/hle/host_routines.h"
 #include "core/hle/kernel/address_arbiter.h"
 #include "core/hle/kernel/client_port.h"
 #include "core/hle/kernel/client_session.h"
@@ -1110,6 +1111,9 @@ static ResultCode GetThreadContext(Core::System& system, VAddr thread_context, H
         return ERR_BUSY;
     }
 
+    // The vector state of the thread may still be held by the core it last ran on.
+    system.GlobalScheduler().FlushVectorState(*thread);
+
     Core::ARM_Interface::ThreadContext ctx = thread->GetContext();
     // Mask away mode bits, interrupt bits, IL bit, and other reserved bits.
     ctx.pstate &= 0xFF0FFE20;
@@ -1639,7 +1643,7 @@ static ResultCode WaitProcessWideKeyAtomic(Core::System& system, VAddr mutex_add
     current_thread->SetWaitHandle(thread_handle);
     current_thread->SetStatus(ThreadStatus::WaitCondVar);
     current_thread->InvalidateWakeupCallback();
-    current_process->InsertConditionVariableThread(SharedFrom(current_thread));
+    current_process->InsertConditionVariableThread(*current_thread);
 
     current_thread->WakeAfterDelay(nano_seconds);
 
@@ -1656,39 +1660,34 @@ static void SignalProcessWideKey(Core::System& system, VAddr condition_variable_
 
     ASSERT(condition_variable_addr == Common::AlignDown(condition_variable_addr, 4));
 
-    // Retrieve a list of all threads that are waiting for this condition variable.
-    auto* const current_process = system.Kernel().CurrentProcess();
-    std::vector<std::shared_ptr<Thread>> waiting_threads =
-        current_process->GetConditionVariableThreads(condition_variable_addr);
-
     // Only process up to 'target' threads, unless 'target' is less equal 0, in which case process
-    // them all.
-    std::size_t last = waiting_threads.size();
-    if (target > 0)
-        last = std::min(waiting_threads.size(), static_cast<std::size_t>(target));
-
-    for (std::size_t index = 0; index < last; ++index) {
-        auto& thread = waiting_threads[index];
+    // them all. Threads are taken from the front of the wait queue one at a time, so waking a few
+    // threads does not depend on the total number of waiters.
+    auto* const current_process = system.Kernel().CurrentProcess();
+    for (s32 index = 0; target <= 0 || index < target; ++index) {
+        Thread* const waiting_thread =
+            current_process->GetConditionVariableThread(condition_variable_addr);
+        if (waiting_thread == nullptr) {
+            break;
+        }
+        const std::shared_ptr<Thread> thread = SharedFrom(waiting_thread);
 
         ASSERT(thread->GetCondVarWaitAddress() == condition_variable_addr);
 
         // liberate Cond Var Thread.
-        current_process->RemoveConditionVariableThread(thread);
+        current_process->RemoveConditionVariableThread(*thread);
         thread->SetCondVarWaitAddress(0);
 
         const std::size_t current_core = system.CurrentCoreIndex();
         auto& monitor = system.Monitor();
-        auto& memory = system.Memory();
 
         // Atomically read the value of the mutex.
         u32 mutex_val = 0;
         u32 update_val = 0;
         const VAddr mutex_address = thread->GetMutexWaitAddress();
         do {
-            monitor.SetExclusive(current_core, mutex_address);
-
             // If the mutex is not yet acquired, acquire it.
-            mutex_val = memory.Read32(mutex_address);
+            mutex_val = monitor.ExclusiveRead32(current_core, mutex_address);
 
             if (mutex_val != 0) {
                 update_val = mutex_val | Mutex::MutexHasWaitersFlag;
@@ -2507,6 +2506,12 @@ static const FunctionDef* GetSVCInfo(u32 func_num) {
 MICROPROFILE_DEFINE(Kernel_SVC, "Kernel", "SVC", MP_RGB(70, 200, 70));
 
 void CallSVC(Core::System& system, u32 immediate) {
+    // Patched guest routines don't touch kernel state, run them without taking the HLE lock.
+    if (HLE::HostRoutines::IsHostRoutineCall(immediate)) {
+        system.HostRoutines().Call(immediate);
+        return;
+    }
+
     MICROPROFILE_SCOPE(Kernel_SVC);
 
     // Lock the global kernel mutex when we enter the kernel HLE.
@@ -41,10 +41,19 @@ Thread::~Thread() = default;
 
 void Thread::Stop() {
     // Cancel any outstanding wakeup events for this thread
-    Core::System::GetInstance().CoreTiming().UnscheduleEvent(kernel.ThreadWakeupCallbackEventType(),
-                                                             callback_handle);
+    CancelWakeupTimer();
     kernel.ThreadWakeupCallbackHandleTable().Close(callback_handle);
     callback_handle = 0;
+
+    // Address arbiter and condition variable queues only link the thread, so it has to be taken
+    // out of them before it can go away.
+    if (status == ThreadStatus::WaitArb) {
+        owner_process->GetAddressArbiter().HandleWakeupThread(SharedFrom(this));
+    } else if (status == ThreadStatus::WaitCondVar) {
+        owner_process->RemoveConditionVariableThread(*this);
+        condvar_wait_address = 0;
+    }
+
     SetStatus(ThreadStatus::Dead);
     WakeupAllWaitingThreads();
 
@@ -65,16 +74,23 @@ void Thread::WakeAfterDelay(s64 nanoseconds) {
     if (nanoseconds == -1)
         return;
 
-    // This function might be called from any thread so we have to be cautious and use the
-    // thread-safe version of ScheduleEvent.
+    // This function might be called from any thread, the wakeup is posted to the event queue of
+    // the core the thread runs on, which doesn't block other cores.
     const s64 cycles = Core::Timing::nsToCycles(std::chrono::nanoseconds{nanoseconds});
-    Core::System::GetInstance().CoreTiming().ScheduleEvent(
-        cycles, kernel.ThreadWakeupCallbackEventType(), callback_handle);
+    wakeup_core = processor_id >= 0 ? static_cast<std::size_t>(processor_id) : 0;
+    has_wakeup_timer = true;
+    Core::System::GetInstance().CoreTiming().ScheduleCoreEvent(
+        wakeup_core, cycles, kernel.ThreadWakeupCallbackEventType(), callback_handle);
 }
 
 void Thread::CancelWakeupTimer() {
-    Core::System::GetInstance().CoreTiming().UnscheduleEvent(kernel.ThreadWakeupCallbackEventType(),
-                                                             callback_handle);
+    // Threads are resumed on every context switch, most of them have no wakeup pending.
+    if (!has_wakeup_timer) {
+        return;
+    }
+    has_wakeup_timer = false;
+    Core::System::GetInstance().CoreTiming().UnscheduleCoreEvent(
+        wakeup_core, kernel.ThreadWakeupCallbackEventType(), callback_handle);
 }
 
 void Thread::ResumeFromWait() {
@@ -311,13 +327,13 @@ void Thread::UpdatePriority() {
     }
 
     if (GetStatus() == ThreadStatus::WaitCondVar) {
-        owner_process->RemoveConditionVariableThread(SharedFrom(this));
+        owner_process->RemoveConditionVariableThread(*this);
     }
 
     SetCurrentPriority(new_priority);
 
     if (GetStatus() == ThreadStatus::WaitCondVar) {
-        owner_process->InsertConditionVariableThread(SharedFrom(this));
+        owner_process->InsertConditionVariableThread(*this);
     }
 
     if (!lock_owner) {
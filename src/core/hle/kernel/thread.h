@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "common/common_types.h"
+#include "common/intrusive_priority_queue.h"
 #include "core/arm/arm_interface.h"
 #include "core/hle/kernel/object.h"
 #include "core/hle/kernel/wait_object.h"
@@ -452,6 +453,9 @@ public:
         is_sync_cancelled = value;
     }
 
+    /// Links this thread into the address arbiter or condition variable queue it is waiting in.
+    Common::IntrusivePriorityQueueNode<Thread> wait_queue_node;
+
 private:
     void SetSchedulingStatus(ThreadSchedStatus new_status);
     void SetCurrentPriority(u32 new_priority);
@@ -515,6 +519,11 @@ private:
     /// Handle used as userdata to reference this object when inserting into the CoreTiming queue.
     Handle callback_handle = 0;
 
+    /// Core whose CoreTiming queue holds the wakeup event, cancelling has to target it too.
+    std::size_t wakeup_core = 0;
+    /// Whether a wakeup event may still be pending.
+    bool has_wakeup_timer = false;
+
     /// Callback that will be invoked when the thread is resumed from a waiting state. If the thread
     /// was waiting via WaitSynchronization then the object will be the last object that became
     /// available. In case of a timeout, the object will be nullptr.
@@ -538,6 +547,10 @@ private:
     std::string name;
 };
 
+/// Queue of threads waiting on an address arbiter or condition variable, ordered by priority.
+using ThreadWaitQueue =
+    Common::IntrusivePriorityQueue<Thread, &Thread::wait_queue_node, THREADPRIO_COUNT>;
+
 /**
  * Gets the current thread
  */
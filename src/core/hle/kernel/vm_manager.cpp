@@ -81,11 +81,14 @@ void VMManager::Reset(FileSys::ProgramAddressSpaceType type) {
     InitializeMemoryRegionRanges(type);
 
     page_table.Resize(address_space_width);
+    vma_index.resize(((address_space_end - 1) >> INDEX_BLOCK_BITS) + 1);
 
     // Initialize the map with a single free region covering the entire managed space.
     VirtualMemoryArea initial_vma;
     initial_vma.size = address_space_end;
-    vma_map.emplace(initial_vma.base, initial_vma);
+    const VMAIter initial_handle = vma_map.emplace(initial_vma.base, initial_vma).first;
+    AddToIndex(initial_handle);
+    UpdateIndex(0, address_space_end, initial_handle->second.index_slot);
 
     UpdatePageTableForVMA(initial_vma);
 }
@@ -93,9 +96,13 @@ void VMManager::Reset(FileSys::ProgramAddressSpaceType type) {
 VMManager::VMAHandle VMManager::FindVMA(VAddr target) const {
     if (target >= address_space_end) {
         return vma_map.end();
-    } else {
-        return std::prev(vma_map.upper_bound(target));
     }
+
+    const IndexBlock& block = vma_index[target >> INDEX_BLOCK_BITS];
+    if (block.pages == nullptr) {
+        return index_slots[block.slot];
+    }
+    return index_slots[block.pages[(target >> Memory::PAGE_BITS) & (INDEX_BLOCK_PAGES - 1)]];
 }
 
 bool VMManager::IsValidHandle(VMAHandle handle) const {
@@ -254,42 +261,30 @@ ResultVal<VAddr> VMManager::SetHeapSize(u64 size) {
     }
 
     // No need to do any additional work if the heap is already the given size.
-    if (size == GetCurrentHeapSize()) {
+    const u64 old_heap_size = GetCurrentHeapSize();
+    if (size == old_heap_size) {
         return MakeResult(heap_region_base);
     }
 
-    if (heap_memory == nullptr) {
-        // Initialize heap
-        heap_memory = std::make_shared<PhysicalMemory>(size);
-        heap_end = heap_region_base + size;
-    } else {
-        UnmapRange(heap_region_base, GetCurrentHeapSize());
-    }
-
-    // If necessary, expand backing vector to cover new heap extents in
-    // the case of allocating. Otherwise, shrink the backing memory,
-    // if a smaller heap has been requested.
-    const u64 old_heap_size = GetCurrentHeapSize();
+    // The heap memory already lives at its final place in the DRAM arena, only the difference
+    // between the old and the new extents has to be mapped or unmapped.
     if (size > old_heap_size) {
-        const u64 alloc_size = size - old_heap_size;
-
-        heap_memory->insert(heap_memory->end(), alloc_size, 0);
-        RefreshMemoryBlockMappings(heap_memory.get());
-    } else if (size < old_heap_size) {
-        heap_memory->resize(size);
-        heap_memory->shrink_to_fit();
-
-        RefreshMemoryBlockMappings(heap_memory.get());
+        const auto mapping_result = MapDramArena(heap_region_base + old_heap_size,
+                                                 size - old_heap_size, VMAPermission::ReadWrite);
+        if (mapping_result.Failed()) {
+            return mapping_result.Code();
+        }
+    } else {
+        const VAddr unmap_address = heap_region_base + size;
+        const u64 unmap_size = old_heap_size - size;
+        const ResultCode result = UnmapRange(unmap_address, unmap_size);
+        if (result.IsError()) {
+            return result;
+        }
+        dram_arena->Decommit(GetDramArenaOffset(unmap_address), unmap_size);
     }
 
     heap_end = heap_region_base + size;
-    ASSERT(GetCurrentHeapSize() == heap_memory->size());
-
-    const auto mapping_result =
-        MapMemoryBlock(heap_region_base, heap_memory, 0, size, MemoryState::Heap);
-    if (mapping_result.Failed()) {
-        return mapping_result.Code();
-    }
 
     return MakeResult<VAddr>(heap_region_base);
 }
@@ -337,9 +332,7 @@ ResultCode VMManager::MapPhysicalMemory(VAddr target, u64 size) {
             // Map the memory block
             const auto map_size = std::min(end_addr - cur_addr, vma_end - cur_addr);
             if (vma.state == MemoryState::Unmapped) {
-                const auto map_res =
-                    MapMemoryBlock(cur_addr, std::make_shared<PhysicalMemory>(map_size), 0,
-                                   map_size, MemoryState::Heap, VMAPermission::ReadWrite);
+                const auto map_res = MapDramArena(cur_addr, map_size, VMAPermission::ReadWrite);
                 result = map_res.Code();
                 if (result.IsError()) {
                     break;
@@ -431,19 +424,21 @@ ResultCode VMManager::UnmapPhysicalMemory(VAddr target, u64 size) {
         }
     }
 
-    // If we failed, re-map regions.
-    // TODO: Preserve memory contents?
+    // If we failed, re-map regions. Their contents are still in the DRAM arena.
     if (result.IsError()) {
         for (const auto [map_address, map_size] : unmapped_regions) {
-            const auto remap_res =
-                MapMemoryBlock(map_address, std::make_shared<PhysicalMemory>(map_size), 0, map_size,
-                               MemoryState::Heap, VMAPermission::None);
+            const auto remap_res = MapDramArena(map_address, map_size, VMAPermission::None);
             ASSERT_MSG(remap_res.Succeeded(), "Failed to remap a memory block.");
         }
 
         return result;
     }
 
+    // Give the memory of the unmapped regions back to the host.
+    for (const auto [unmap_address, unmap_size] : unmapped_regions) {
+        dram_arena->Decommit(GetDramArenaOffset(unmap_address), unmap_size);
+    }
+
     // Update mapped amount
     physical_memory_mapped -= mapped_size;
 
@@ -724,12 +719,15 @@ VMManager::VMAIter VMManager::SplitVMA(VMAIter vma_handle, u64 offset_in_vma) {
 
     ASSERT(old_vma.CanBeMergedWith(new_vma));
 
-    return vma_map.emplace_hint(std::next(vma_handle), new_vma.base, new_vma);
+    const VMAIter new_handle = vma_map.emplace_hint(std::next(vma_handle), new_vma.base, new_vma);
+    SplitIndex(vma_handle, new_handle);
+    return new_handle;
 }
 
 VMManager::VMAIter VMManager::MergeAdjacent(VMAIter iter) {
     const VMAIter next_vma = std::next(iter);
     if (next_vma != vma_map.end() && iter->second.CanBeMergedWith(next_vma->second)) {
+        MergeIndex(iter, next_vma->second);
         MergeAdjacentVMA(iter->second, next_vma->second);
         vma_map.erase(next_vma);
     }
@@ -737,6 +735,7 @@ VMManager::VMAIter VMManager::MergeAdjacent(VMAIter iter) {
     if (iter != vma_map.begin()) {
         VMAIter prev_vma = std::prev(iter);
         if (prev_vma->second.CanBeMergedWith(iter->second)) {
+            MergeIndex(prev_vma, iter->second);
             MergeAdjacentVMA(prev_vma->second, iter->second);
             vma_map.erase(iter);
             iter = prev_vma;
@@ -756,7 +755,8 @@ void VMManager::MergeAdjacentVMA(VirtualMemoryArea& left, const VirtualMemoryAre
         const auto right_end = right_begin + right.size;
 
         // Check if we can save work.
-        if (left.offset == 0 && left.size == left.backing_block->size()) {
+        if (left.backing_block != right.backing_block && left.offset == 0 &&
+            left.size == left.backing_block->size()) {
             // Fast case: left is an entire backing block.
             left.backing_block->insert(left.backing_block->end(), right_begin, right_end);
         } else {
@@ -882,6 +882,27 @@ void VMManager::InitializeMemoryRegionRanges(FileSys::ProgramAddressSpaceType ty
         tls_io_region_base = stack_and_tls_io_begin;
         tls_io_region_end = stack_and_tls_io_end;
     }
+
+    // Only reserve host address space, memory is committed as the regions are mapped.
+    const u64 dram_arena_size = heap_region_end - map_region_base;
+    auto reserved_arena = PhysicalMemory::Reserve(dram_arena_size);
+    if (!reserved_arena) {
+        // Leave an empty arena behind, mapping heap or physical memory fails with out of memory.
+        LOG_CRITICAL(Kernel, "Unable to reserve 0x{:X} bytes for the DRAM arena", dram_arena_size);
+        dram_arena = std::make_shared<PhysicalMemory>();
+        return;
+    }
+    dram_arena = std::make_shared<PhysicalMemory>(std::move(*reserved_arena));
+}
+
+ResultVal<VMManager::VMAHandle> VMManager::MapDramArena(VAddr target, u64 size,
+                                                        VMAPermission perm) {
+    ASSERT(target >= map_region_base && target + size <= heap_region_end);
+    const std::size_t offset = GetDramArenaOffset(target);
+    if (offset + size > dram_arena->size() || !dram_arena->Commit(offset, size)) {
+        return ERR_OUT_OF_MEMORY;
+    }
+    return MapMemoryBlock(target, dram_arena, offset, size, MemoryState::Heap, perm);
 }
 
 void VMManager::Clear() {
@@ -891,6 +912,74 @@ void VMManager::Clear() {
 
 void VMManager::ClearVMAMap() {
     vma_map.clear();
+    vma_index.clear();
+    index_slots.clear();
+    free_index_slots.clear();
+}
+
+void VMManager::AddToIndex(VMAIter vma) {
+    u32 slot;
+    if (free_index_slots.empty()) {
+        slot = static_cast<u32>(index_slots.size());
+        index_slots.push_back(vma);
+    } else {
+        slot = free_index_slots.back();
+        free_index_slots.pop_back();
+        index_slots[slot] = vma;
+    }
+    vma->second.index_slot = slot;
+}
+
+void VMManager::RemoveFromIndex(const VirtualMemoryArea& vma) {
+    free_index_slots.push_back(vma.index_slot);
+}
+
+void VMManager::SplitIndex(VMAIter left, VMAIter right) {
+    // The right side was copied from the left one, so both still share its slot.
+    if (right->second.size > left->second.size) {
+        index_slots[right->second.index_slot] = right;
+        AddToIndex(left);
+        UpdateIndex(left->second.base, left->second.size, left->second.index_slot);
+    } else {
+        AddToIndex(right);
+        UpdateIndex(right->second.base, right->second.size, right->second.index_slot);
+    }
+}
+
+void VMManager::MergeIndex(VMAIter left, const VirtualMemoryArea& right) {
+    VirtualMemoryArea& left_vma = left->second;
+    if (right.size > left_vma.size) {
+        RemoveFromIndex(left_vma);
+        left_vma.index_slot = right.index_slot;
+        index_slots[left_vma.index_slot] = left;
+        UpdateIndex(left_vma.base, left_vma.size, left_vma.index_slot);
+    } else {
+        RemoveFromIndex(right);
+        UpdateIndex(right.base, right.size, left_vma.index_slot);
+    }
+}
+
+void VMManager::UpdateIndex(VAddr base, u64 size, u32 slot) {
+    constexpr u64 block_size = 1ULL << INDEX_BLOCK_BITS;
+    const VAddr end = base + size;
+    while (base < end) {
+        IndexBlock& block = vma_index[base >> INDEX_BLOCK_BITS];
+        const VAddr block_end = Common::AlignDown(base, block_size) + block_size;
+        if (base % block_size == 0 && end >= block_end) {
+            block.pages.reset();
+            block.slot = slot;
+            base = block_end;
+            continue;
+        }
+        if (block.pages == nullptr) {
+            block.pages = std::make_unique<u32[]>(INDEX_BLOCK_PAGES);
+            std::fill_n(block.pages.get(), INDEX_BLOCK_PAGES, block.slot);
+        }
+        const VAddr range_end = std::min(end, block_end);
+        const std::size_t first_page = (base >> Memory::PAGE_BITS) & (INDEX_BLOCK_PAGES - 1);
+        std::fill_n(block.pages.get() + first_page, (range_end - base) >> Memory::PAGE_BITS, slot);
+        base = range_end;
+    }
 }
 
 void VMManager::ClearPageTable() {
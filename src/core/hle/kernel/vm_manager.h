@@ -304,6 +304,9 @@ struct VirtualMemoryArea {
     PAddr paddr = 0;
     Common::MemoryHookPointer mmio_handler = nullptr;
 
+    /// Slot of this VMA in the lookup index of its VMManager.
+    u32 index_slot = 0;
+
     /// Tests if this area can be merged to the right with `next`.
     bool CanBeMergedWith(const VirtualMemoryArea& next) const;
 };
@@ -698,6 +701,30 @@ private:
     /// Initializes memory region ranges to adhere to a given address space type.
     void InitializeMemoryRegionRanges(FileSys::ProgramAddressSpaceType type);
 
+    /// Returns the offset in the DRAM arena backing an address of the map or heap regions.
+    std::size_t GetDramArenaOffset(VAddr address) const {
+        return static_cast<std::size_t>(address - map_region_base);
+    }
+
+    /// Maps a range of the map or heap regions to its memory in the DRAM arena, fails with
+    /// ERR_OUT_OF_MEMORY if the host can't commit the memory.
+    ResultVal<VMAHandle> MapDramArena(VAddr target, u64 size, VMAPermission perm);
+
+    /// Assigns a new slot in the lookup index to a VMA.
+    void AddToIndex(VMAIter vma);
+
+    /// Releases the index slot of a VMA about to be erased.
+    void RemoveFromIndex(const VirtualMemoryArea& vma);
+
+    /// Assigns index slots to the two halves of a VMA that was just split.
+    void SplitIndex(VMAIter left, VMAIter right);
+
+    /// Moves the index entries of `right` to `left`, before `right` is merged into it and erased.
+    void MergeIndex(VMAIter left, const VirtualMemoryArea& right);
+
+    /// Points the index entries of the pages in [base, base + size) to the given slot.
+    void UpdateIndex(VAddr base, u64 size, u32 slot);
+
     /// Clears the underlying map and page table.
     void Clear();
 
@@ -752,6 +779,28 @@ private:
      */
     VMAMap vma_map;
 
+    /// Number of address bits covered by each block of the lookup index.
+    static constexpr std::size_t INDEX_BLOCK_BITS = 22;
+
+    /// Number of pages in each block of the lookup index.
+    static constexpr std::size_t INDEX_BLOCK_PAGES = 1ULL << (INDEX_BLOCK_BITS - Memory::PAGE_BITS);
+
+    /// Block of the lookup index, either covered by a single VMA or holding the slot of each page.
+    struct IndexBlock {
+        std::unique_ptr<u32[]> pages;
+        u32 slot = 0;
+    };
+
+    /**
+     * Two-level index of the address space giving the slot of the VMA containing each page. Blocks
+     * only get a per-page table once VMAs start or end inside of them. Each VMA owns a slot holding
+     * its iterator. Splits and merges keep the slot of the larger side, so only the entries of the
+     * smaller side are rewritten, and the huge free VMAs almost never are.
+     */
+    std::vector<IndexBlock> vma_index;
+    std::vector<VMAIter> index_slots;
+    std::vector<u32> free_index_slots;
+
     u32 address_space_width = 0;
     VAddr address_space_base = 0;
     VAddr address_space_end = 0;
@@ -774,11 +823,13 @@ private:
     VAddr tls_io_region_base = 0;
     VAddr tls_io_region_end = 0;
 
-    // Memory used to back the allocations in the regular heap. A single vector is used to cover
-    // the entire virtual address space extents that bound the allocations, including any holes.
-    // This makes deallocation and reallocation of holes fast and keeps process memory contiguous
-    // in the emulator address space, allowing Memory::GetPointer to be reasonably safe.
-    std::shared_ptr<PhysicalMemory> heap_memory;
+    // Memory used to back the heap and the memory mapped with MapPhysicalMemory. The map region
+    // is immediately followed by the heap region, so a single reserved block covers both and
+    // every address in them has a fixed offset into it. Pages are committed by the host when
+    // touched and given back when unmapped, growing the heap or merging adjacent VMAs never
+    // copies memory, and the memory stays contiguous in the emulator address space, allowing
+    // Memory::GetPointer to be reasonably safe.
+    std::shared_ptr<PhysicalMemory> dram_arena;
 
     // The end of the currently allocated heap. This is not an inclusive
     // end of the range. This is essentially 'base_address + current_size'.
@@ -2,8 +2,46 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <array>
 #include <core/hle/lock.h>
+#include "common/logging/log.h"
 
 namespace HLE {
-std::recursive_mutex g_hle_lock;
+namespace {
+constexpr auto NumLockDomains = static_cast<std::size_t>(LockDomain::Count);
+constexpr std::array<const char*, NumLockDomains> domain_names{"Kernel", "Scheduler"};
+
+std::array<LockDomainCounters, NumLockDomains> domain_counters;
+} // Anonymous namespace
+
+ProfiledMutex<std::recursive_mutex> g_hle_lock{LockDomain::Kernel};
+
+LockDomainCounters& GetLockDomainCounters(LockDomain domain) {
+    return domain_counters[static_cast<std::size_t>(domain)];
+}
+
+LockStatistics GetLockStatistics(LockDomain domain) {
+    const LockDomainCounters& counters = GetLockDomainCounters(domain);
+    return {counters.acquisitions.load(std::memory_order_relaxed),
+            counters.contentions.load(std::memory_order_relaxed),
+            std::chrono::nanoseconds{counters.wait_time_ns.load(std::memory_order_relaxed)}};
 }
+
+void ResetLockStatistics() {
+    for (LockDomainCounters& counters : domain_counters) {
+        counters.acquisitions.store(0, std::memory_order_relaxed);
+        counters.contentions.store(0, std::memory_order_relaxed);
+        counters.wait_time_ns.store(0, std::memory_order_relaxed);
+    }
+}
+
+void LogLockStatistics() {
+    for (std::size_t domain = 0; domain < NumLockDomains; ++domain) {
+        const LockStatistics stats = GetLockStatistics(static_cast<LockDomain>(domain));
+        LOG_INFO(Kernel, "{} lock acquisitions: {}, contended: {}, wait time: {} us",
+                 domain_names[domain], stats.acquisitions, stats.contentions,
+                 std::chrono::duration_cast<std::chrono::microseconds>(stats.wait_time).count());
+    }
+}
+
+} // namespace HLE
@@ -4,15 +4,98 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <cstddef>
 #include <mutex>
+#include "common/common_types.h"
 
 namespace HLE {
+
+/// Kernel state protected by an independent lock, reported separately by the lock profiler.
+enum class LockDomain : u32 {
+    Kernel,    ///< Global HLE kernel state, see g_hle_lock.
+    Scheduler, ///< Scheduling and suggested queues of the global scheduler.
+    Count,
+};
+
+/// Number of acquisitions of the locks of a domain and the time spent waiting for them.
+struct LockStatistics {
+    u64 acquisitions;
+    u64 contentions;
+    std::chrono::nanoseconds wait_time;
+};
+
+/// Counters shared by every lock of a domain.
+struct LockDomainCounters {
+    std::atomic<u64> acquisitions{};
+    std::atomic<u64> contentions{};
+    std::atomic<u64> wait_time_ns{};
+};
+
+/// Returns the counters of a lock domain.
+LockDomainCounters& GetLockDomainCounters(LockDomain domain);
+
+/// Returns the statistics of a lock domain, for debugging purposes.
+LockStatistics GetLockStatistics(LockDomain domain);
+
+/// Clears the counters of all lock domains.
+void ResetLockStatistics();
+
+/// Logs the statistics of every lock domain.
+void LogLockStatistics();
+
+/**
+ * Mutex wrapper that accounts acquisitions to a lock domain. Acquisitions that can't be satisfied
+ * right away are counted as contended and the time spent blocked is added to the domain.
+ */
+template <typename Mutex>
+class ProfiledMutex {
+public:
+    explicit ProfiledMutex(LockDomain domain) : counters{GetLockDomainCounters(domain)} {}
+
+    ProfiledMutex(const ProfiledMutex&) = delete;
+    ProfiledMutex& operator=(const ProfiledMutex&) = delete;
+
+    void lock() {
+        counters.acquisitions.fetch_add(1, std::memory_order_relaxed);
+        if (mutex.try_lock()) {
+            return;
+        }
+        const auto begin = std::chrono::steady_clock::now();
+        mutex.lock();
+        const auto wait_time = std::chrono::steady_clock::now() - begin;
+        counters.contentions.fetch_add(1, std::memory_order_relaxed);
+        counters.wait_time_ns.fetch_add(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(wait_time).count(),
+            std::memory_order_relaxed);
+    }
+
+    bool try_lock() {
+        if (!mutex.try_lock()) {
+            return false;
+        }
+        counters.acquisitions.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    void unlock() {
+        mutex.unlock();
+    }
+
+private:
+    Mutex mutex;
+    LockDomainCounters& counters;
+};
+
 /*
  * Synchronizes access to the internal HLE kernel structures, it is acquired when a guest
  * application thread performs a syscall. It should be acquired by any host threads that read or
  * modify the HLE kernel state. Note: Any operation that directly or indirectly reads from or writes
  * to the emulated memory is not protected by this mutex, and should be avoided in any threads other
  * than the CPU thread.
+ * The scheduling queues are protected by their own lock, taken after this one when both are held.
  */
-extern std::recursive_mutex g_hle_lock;
+extern ProfiledMutex<std::recursive_mutex> g_hle_lock;
+
 } // namespace HLE
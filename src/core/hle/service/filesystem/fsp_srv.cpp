@@ -2,6 +2,7 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
 #include <cinttypes>
 #include <cstring>
 #include <iterator>
@@ -59,7 +60,7 @@ public:
     explicit IStorage(FileSys::VirtualFile backend_)
         : ServiceFramework("IStorage"), backend(std::move(backend_)) {
         static const FunctionInfo functions[] = {
-            {0, &IStorage::Read, "Read"},
+            {0, Unpack<&IStorage::Read>, "Read"},
             {1, nullptr, "Write"},
             {2, nullptr, "Flush"},
             {3, nullptr, "SetSize"},
@@ -72,11 +73,7 @@ public:
 private:
     FileSys::VirtualFile backend;
 
-    void Read(Kernel::HLERequestContext& ctx) {
-        IPC::RequestParser rp{ctx};
-        const s64 offset = rp.Pop<s64>();
-        const s64 length = rp.Pop<s64>();
-
+    void Read(Kernel::HLERequestContext& ctx, s64 offset, s64 length) {
         LOG_DEBUG(Service_FS, "called, offset=0x{:X}, length={}", offset, length);
 
         // Error checking
@@ -93,10 +90,11 @@ private:
             return;
         }
 
-        // Read the data from the Storage backend
-        std::vector<u8> output = backend->ReadBytes(length, offset);
-        // Write the data to memory
-        ctx.WriteBuffer(output);
+        // Read the data from the Storage backend straight into the output buffer
+        const auto output = ctx.WriteBufferSpan();
+        const std::size_t read_size =
+            backend->Read(output.data(), std::min<std::size_t>(length, output.size()), offset);
+        ctx.CommitWriteBufferSpan(read_size);
 
         IPC::ResponseBuilder rb{ctx, 2};
         rb.Push(RESULT_SUCCESS);
@@ -117,9 +115,12 @@ public:
     explicit IFile(FileSys::VirtualFile backend_)
         : ServiceFramework("IFile"), backend(std::move(backend_)) {
         static const FunctionInfo functions[] = {
-            {0, &IFile::Read, "Read"},       {1, &IFile::Write, "Write"},
-            {2, &IFile::Flush, "Flush"},     {3, &IFile::SetSize, "SetSize"},
-            {4, &IFile::GetSize, "GetSize"}, {5, nullptr, "OperateRange"},
+            {0, Unpack<&IFile::Read>, "Read"},
+            {1, Unpack<&IFile::Write>, "Write"},
+            {2, &IFile::Flush, "Flush"},
+            {3, Unpack<&IFile::SetSize>, "SetSize"},
+            {4, &IFile::GetSize, "GetSize"},
+            {5, nullptr, "OperateRange"},
         };
         RegisterHandlers(functions);
     }
@@ -127,12 +128,7 @@ public:
 private:
     FileSys::VirtualFile backend;
 
-    void Read(Kernel::HLERequestContext& ctx) {
-        IPC::RequestParser rp{ctx};
-        const u64 option = rp.Pop<u64>();
-        const s64 offset = rp.Pop<s64>();
-        const s64 length = rp.Pop<s64>();
-
+    void Read(Kernel::HLERequestContext& ctx, u64 option, s64 offset, s64 length) {
         LOG_DEBUG(Service_FS, "called, option={}, offset=0x{:X}, length={}", option, offset,
                   length);
 
@@ -150,23 +146,18 @@ private:
             return;
         }
 
-        // Read the data from the Storage backend
-        std::vector<u8> output = backend->ReadBytes(length, offset);
-
-        // Write the data to memory
-        ctx.WriteBuffer(output);
+        // Read the data from the Storage backend straight into the output buffer
+        const auto output = ctx.WriteBufferSpan();
+        const std::size_t read_size =
+            backend->Read(output.data(), std::min<std::size_t>(length, output.size()), offset);
+        ctx.CommitWriteBufferSpan(read_size);
 
         IPC::ResponseBuilder rb{ctx, 4};
         rb.Push(RESULT_SUCCESS);
-        rb.Push(static_cast<u64>(output.size()));
+        rb.Push(static_cast<u64>(read_size));
     }
 
-    void Write(Kernel::HLERequestContext& ctx) {
-        IPC::RequestParser rp{ctx};
-        const u64 option = rp.Pop<u64>();
-        const s64 offset = rp.Pop<s64>();
-        const s64 length = rp.Pop<s64>();
-
+    void Write(Kernel::HLERequestContext& ctx, u64 option, s64 offset, s64 length) {
         LOG_DEBUG(Service_FS, "called, option={}, offset=0x{:X}, length={}", option, offset,
                   length);
 
@@ -184,7 +175,7 @@ private:
             return;
         }
 
-        const std::vector<u8> data = ctx.ReadBuffer();
+        const auto data = ctx.ReadBufferSpan();
 
         ASSERT_MSG(
             static_cast<s64>(data.size()) <= length,
@@ -213,9 +204,7 @@ private:
         rb.Push(RESULT_SUCCESS);
     }
 
-    void SetSize(Kernel::HLERequestContext& ctx) {
-        IPC::RequestParser rp{ctx};
-        const u64 size = rp.Pop<u64>();
+    void SetSize(Kernel::HLERequestContext& ctx, u64 size) {
         LOG_DEBUG(Service_FS, "called, size={}", size);
 
         backend->Resize(size);
@@ -4,9 +4,12 @@
 
 #pragma once
 
-#include <vector>
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
 #include "common/bit_field.h"
 #include "common/common_types.h"
+#include "common/span.h"
 #include "common/swap.h"
 #include "core/hle/service/nvdrv/nvdata.h"
 #include "core/hle/service/service.h"
@@ -17,6 +20,29 @@ class System;
 
 namespace Service::Nvidia::Devices {
 
+/**
+ * Copies the fixed-size parameter struct of an ioctl out of its input buffer. Bytes missing from a
+ * short buffer are left zeroed and bytes past the struct in a long buffer are ignored.
+ */
+template <typename T>
+T ReadParams(Common::Span<const u8> input) {
+    static_assert(std::is_trivially_copyable_v<T>, "Ioctl parameters must be trivially copyable");
+    T params{};
+    if (!input.empty()) {
+        std::memcpy(&params, input.data(), std::min(sizeof(T), input.size()));
+    }
+    return params;
+}
+
+/// Copies the fixed-size parameter struct of an ioctl to as much of its output buffer as it fits.
+template <typename T>
+void WriteParams(Common::Span<u8> output, const T& params) {
+    static_assert(std::is_trivially_copyable_v<T>, "Ioctl parameters must be trivially copyable");
+    if (!output.empty()) {
+        std::memcpy(output.data(), &params, std::min(sizeof(T), output.size()));
+    }
+}
+
 /// Represents an abstract nvidia device node. It is to be subclassed by concrete device nodes to
 /// implement the ioctl interface.
 class nvdevice {
@@ -39,8 +65,8 @@ public:
      * @param output A buffer where the output data will be written to.
      * @returns The result code of the ioctl.
      */
-    virtual u32 ioctl(Ioctl command, const std::vector<u8>& input, const std::vector<u8>& input2,
-                      std::vector<u8>& output, std::vector<u8>& output2, IoctlCtrl& ctrl,
+    virtual u32 ioctl(Ioctl command, Common::Span<const u8> input, Common::Span<const u8> input2,
+                      Common::Span<u8> output, Common::Span<u8> output2, IoctlCtrl& ctrl,
                       IoctlVersion version) = 0;
 
 protected:
@@ -17,8 +17,8 @@ public:
     explicit nvhost_ctrl(Core::System& system, EventInterface& events_interface);
     ~nvhost_ctrl() override;
 
-    u32 ioctl(Ioctl command, const std::vector<u8>& input, const std::vector<u8>& input2,
-              std::vector<u8>& output, std::vector<u8>& output2, IoctlCtrl& ctrl,
+    u32 ioctl(Ioctl command, Common::Span<const u8> input, Common::Span<const u8> input2,
+              Common::Span<u8> output, Common::Span<u8> output2, IoctlCtrl& ctrl,
               IoctlVersion version) override;
 
 private:
@@ -133,16 +133,16 @@ private:
     };
     static_assert(sizeof(IocCtrlEventKill) == 8, "IocCtrlEventKill is incorrect size");
 
-    u32 NvOsGetConfigU32(const std::vector<u8>& input, std::vector<u8>& output);
+    u32 NvOsGetConfigU32(Common::Span<const u8> input, Common::Span<u8> output);
 
-    u32 IocCtrlEventWait(const std::vector<u8>& input, std::vector<u8>& output, bool is_async,
+    u32 IocCtrlEventWait(Common::Span<const u8> input, Common::Span<u8> output, bool is_async,
                          IoctlCtrl& ctrl);
 
-    u32 IocCtrlEventRegister(const std::vector<u8>& input, std::vector<u8>& output);
+    u32 IocCtrlEventRegister(Common::Span<const u8> input, Common::Span<u8> output);
 
-    u32 IocCtrlEventUnregister(const std::vector<u8>& input, std::vector<u8>& output);
+    u32 IocCtrlEventUnregister(Common::Span<const u8> input, Common::Span<u8> output);
 
-    u32 IocCtrlEventSignal(const std::vector<u8>& input, std::vector<u8>& output);
+    u32 IocCtrlEventSignal(Common::Span<const u8> input, Common::Span<u8> output);
 
     EventInterface& events_interface;
 };
@@ -16,8 +16,8 @@ public:
     explicit nvhost_ctrl_gpu(Core::System& system);
     ~nvhost_ctrl_gpu() override;
 
-    u32 ioctl(Ioctl command, const std::vector<u8>& input, const std::vector<u8>& input2,
-              std::vector<u8>& output, std::vector<u8>& output2, IoctlCtrl& ctrl,
+    u32 ioctl(Ioctl command, Common::Span<const u8> input, Common::Span<const u8> input2,
+              Common::Span<u8> output, Common::Span<u8> output2, IoctlCtrl& ctrl,
               IoctlVersion version) override;
 
 private:
@@ -163,16 +163,16 @@ private:
     };
     static_assert(sizeof(IoctlGetGpuTime) == 8, "IoctlGetGpuTime is incorrect size");
 
-    u32 GetCharacteristics(const std::vector<u8>& input, std::vector<u8>& output,
-                           std::vector<u8>& output2, IoctlVersion version);
-    u32 GetTPCMasks(const std::vector<u8>& input, std::vector<u8>& output);
-    u32 GetActiveSlotMask(const std::vector<u8>& input, std::vector<u8>& output);
-    u32 ZCullGetCtxSize(const std::vector<u8>& input, std::vector<u8>& output);
-    u32 ZCullGetInfo(const std::vector<u8>& input, std::vector<u8>& output);
-    u32 ZBCSetTable(const std::vector<u8>& input, std::vector<u8>& output);
-    u32 ZBCQueryTable(const std::vector<u8>& input, std::vector<u8>& output);
-    u32 FlushL2(const std::vector<u8>& input, std::vector<u8>& output);
-    u32 GetGpuTime(const std::vector<u8>& input, std::vector<u8>& output);
+    u32 GetCharacteristics(Common::Span<const u8> input, Common::Span<u8> output,
+                           Common::Span<u8> output2, IoctlVersion version);
+    u32 GetTPCMasks(Common::Span<const u8> input, Common::Span<u8> output);
+    u32 GetActiveSlotMask(Common::Span<const u8> input, Common::Span<u8> output);
+    u32 ZCullGetCtxSize(Common::Span<const u8> input, Common::Span<u8> output);
+    u32 ZCullGetInfo(Common::Span<const u8> input, Common::Span<u8> output);
+    u32 ZBCSetTable(Common::Span<const u8> input, Common::Span<u8> output);
+    u32 ZBCQueryTable(Common::Span<const u8> input, Common::Span<u8> output);
+    u32 FlushL2(Common::Span<const u8> input, Common::Span<u8> output);
+    u32 GetGpuTime(Common::Span<const u8> input, Common::Span<u8> output);
 };
 
 } // namespace Service::Nvidia::Devices
@@ -13,8 +13,8 @@ namespace Service::Nvidia::Devices {
 nvhost_nvdec::nvhost_nvdec(Core::System& system) : nvdevice(system) {}
 nvhost_nvdec::~nvhost_nvdec() = default;
 
-u32 nvhost_nvdec::ioctl(Ioctl command, const std::vector<u8>& input, const std::vector<u8>& input2,
-                        std::vector<u8>& output, std::vector<u8>& output2, IoctlCtrl& ctrl,
+u32 nvhost_nvdec::ioctl(Ioctl command, Common::Span<const u8> input, Common::Span<const u8> input2,
+                        Common::Span<u8> output, Common::Span<u8> output2, IoctlCtrl& ctrl,
                         IoctlVersion version) {
     LOG_DEBUG(Service_NVDRV, "called, command=0x{:08X}, input_size=0x{:X}, output_size=0x{:X}",
               command.raw, input.size(), output.size());
@@ -40,7 +40,7 @@ u32 nvhost_nvdec::ioctl(Ioctl command, const std::vector<u8>& input, const std::
     return 0;
 }
 
-u32 nvhost_nvdec::SetNVMAPfd(const std::vector<u8>& input, std::vector<u8>& output) {
+u32 nvhost_nvdec::SetNVMAPfd(Common::Span<const u8> input, Common::Span<u8> output) {
     IoctlSetNvmapFD params{};
     std::memcpy(&params, input.data(), sizeof(IoctlSetNvmapFD));
     LOG_DEBUG(Service_NVDRV, "called, fd={}", params.nvmap_fd);
@@ -49,7 +49,7 @@ u32 nvhost_nvdec::SetNVMAPfd(const std::vector<u8>& input, std::vector<u8>& outp
     return 0;
 }
 
-u32 nvhost_nvdec::Submit(const std::vector<u8>& input, std::vector<u8>& output) {
+u32 nvhost_nvdec::Submit(Common::Span<const u8> input, Common::Span<u8> output) {
     IoctlSubmit params{};
     std::memcpy(&params, input.data(), sizeof(IoctlSubmit));
     LOG_WARNING(Service_NVDRV, "(STUBBED) called");
@@ -57,7 +57,7 @@ u32 nvhost_nvdec::Submit(const std::vector<u8>& input, std::vector<u8>& output)
     return 0;
 }
 
-u32 nvhost_nvdec::GetSyncpoint(const std::vector<u8>& input, std::vector<u8>& output) {
+u32 nvhost_nvdec::GetSyncpoint(Common::Span<const u8> input, Common::Span<u8> output) {
     IoctlGetSyncpoint params{};
     std::memcpy(&params, input.data(), sizeof(IoctlGetSyncpoint));
     LOG_INFO(Service_NVDRV, "called, unknown=0x{:X}", params.unknown);
@@ -66,7 +66,7 @@ u32 nvhost_nvdec::GetSyncpoint(const std::vector<u8>& input, std::vector<u8>& ou
     return 0;
 }
 
-u32 nvhost_nvdec::GetWaitbase(const std::vector<u8>& input, std::vector<u8>& output) {
+u32 nvhost_nvdec::GetWaitbase(Common::Span<const u8> input, Common::Span<u8> output) {
     IoctlGetWaitbase params{};
     std::memcpy(&params, input.data(), sizeof(IoctlGetWaitbase));
     LOG_INFO(Service_NVDRV, "called, unknown=0x{:X}", params.unknown);
@@ -75,7 +75,7 @@ u32 nvhost_nvdec::GetWaitbase(const std::vector<u8>& input, std::vector<u8>& out
     return 0;
 }
 
-u32 nvhost_nvdec::MapBuffer(const std::vector<u8>& input, std::vector<u8>& output) {
+u32 nvhost_nvdec::MapBuffer(Common::Span<const u8> input, Common::Span<u8> output) {
     IoctlMapBuffer params{};
     std::memcpy(&params, input.data(), sizeof(IoctlMapBuffer));
     LOG_WARNING(Service_NVDRV, "(STUBBED) called with address={:08X}{:08X}", params.address_2,
@@ -86,7 +86,7 @@ u32 nvhost_nvdec::MapBuffer(const std::vector<u8>& input, std::vector<u8>& outpu
     return 0;
 }
 
-u32 nvhost_nvdec::MapBufferEx(const std::vector<u8>& input, std::vector<u8>& output) {
+u32 nvhost_nvdec::MapBufferEx(Common::Span<const u8> input, Common::Span<u8> output) {
     IoctlMapBufferEx params{};
     std::memcpy(&params, input.data(), sizeof(IoctlMapBufferEx));
     LOG_WARNING(Service_NVDRV, "(STUBBED) called with address={:08X}{:08X}", params.address_2,
@@ -97,7 +97,7 @@ u32 nvhost_nvdec::MapBufferEx(const std::vector<u8>& input, std::vector<u8>& out
     return 0;
 }
 
-u32 nvhost_nvdec::UnmapBufferEx(const std::vector<u8>& input, std::vector<u8>& output) {
+u32 nvhost_nvdec::UnmapBufferEx(Common::Span<const u8> input, Common::Span<u8> output) {
     IoctlUnmapBufferEx params{};
     std::memcpy(&params, input.data(), sizeof(IoctlUnmapBufferEx));
     LOG_WARNING(Service_NVDRV, "(STUBBED) called");
@@ -28,8 +28,8 @@ VAddr nvmap::GetObjectAddress(u32 handle) const {
     return object->addr;
 }
 
-u32 nvmap::ioctl(Ioctl command, const std::vector<u8>& input, const std::vector<u8>& input2,
-                 std::vector<u8>& output, std::vector<u8>& output2, IoctlCtrl& ctrl,
+u32 nvmap::ioctl(Ioctl command, Common::Span<const u8> input, Common::Span<const u8> input2,
+                 Common::Span<u8> output, Common::Span<u8> output2, IoctlCtrl& ctrl,
                  IoctlVersion version) {
     switch (static_cast<IoctlCommand>(command.raw)) {
     case IoctlCommand::Create:
@@ -50,9 +50,8 @@ u32 nvmap::ioctl(Ioctl command, const std::vector<u8>& input, const std::vector<
     return 0;
 }
 
-u32 nvmap::IocCreate(const std::vector<u8>& input, std::vector<u8>& output) {
-    IocCreateParams params;
-    std::memcpy(&params, input.data(), sizeof(params));
+u32 nvmap::IocCreate(Common::Span<const u8> input, Common::Span<u8> output) {
+    auto params = ReadParams<IocCreateParams>(input);
     LOG_DEBUG(Service_NVDRV, "size=0x{:08X}", params.size);
 
     if (!params.size) {
@@ -71,13 +70,12 @@ u32 nvmap::IocCreate(const std::vector<u8>& input, std::vector<u8>& output) {
 
     params.handle = handle;
 
-    std::memcpy(output.data(), &params, sizeof(params));
+    WriteParams(output, params);
     return 0;
 }
 
-u32 nvmap::IocAlloc(const std::vector<u8>& input, std::vector<u8>& output) {
-    IocAllocParams params;
-    std::memcpy(&params, input.data(), sizeof(params));
+u32 nvmap::IocAlloc(Common::Span<const u8> input, Common::Span<u8> output) {
+    auto params = ReadParams<IocAllocParams>(input);
     LOG_DEBUG(Service_NVDRV, "called, addr={:X}", params.addr);
 
     if (!params.handle) {
@@ -112,13 +110,12 @@ u32 nvmap::IocAlloc(const std::vector<u8>& input, std::vector<u8>& output) {
     object->addr = params.addr;
     object->status = Object::Status::Allocated;
 
-    std::memcpy(output.data(), &params, sizeof(params));
+    WriteParams(output, params);
     return 0;
 }
 
-u32 nvmap::IocGetId(const std::vector<u8>& input, std::vector<u8>& output) {
-    IocGetIdParams params;
-    std::memcpy(&params, input.data(), sizeof(params));
+u32 nvmap::IocGetId(Common::Span<const u8> input, Common::Span<u8> output) {
+    auto params = ReadParams<IocGetIdParams>(input);
 
     LOG_WARNING(Service_NVDRV, "called");
 
@@ -135,13 +132,12 @@ u32 nvmap::IocGetId(const std::vector<u8>& input, std::vector<u8>& output) {
 
     params.id = object->id;
 
-    std::memcpy(output.data(), &params, sizeof(params));
+    WriteParams(output, params);
     return 0;
 }
 
-u32 nvmap::IocFromId(const std::vector<u8>& input, std::vector<u8>& output) {
-    IocFromIdParams params;
-    std::memcpy(&params, input.data(), sizeof(params));
+u32 nvmap::IocFromId(Common::Span<const u8> input, Common::Span<u8> output) {
+    auto params = ReadParams<IocFromIdParams>(input);
 
     LOG_WARNING(Service_NVDRV, "(STUBBED) called");
 
@@ -163,15 +159,14 @@ u32 nvmap::IocFromId(const std::vector<u8>& input, std::vector<u8>& output) {
     // Return the existing handle instead of creating a new one.
     params.handle = itr->first;
 
-    std::memcpy(output.data(), &params, sizeof(params));
+    WriteParams(output, params);
     return 0;
 }
 
-u32 nvmap::IocParam(const std::vector<u8>& input, std::vector<u8>& output) {
+u32 nvmap::IocParam(Common::Span<const u8> input, Common::Span<u8> output) {
     enum class ParamTypes { Size = 1, Alignment = 2, Base = 3, Heap = 4, Kind = 5, Compr = 6 };
 
-    IocParamParams params;
-    std::memcpy(&params, input.data(), sizeof(params));
+    auto params = ReadParams<IocParamParams>(input);
 
     LOG_WARNING(Service_NVDRV, "(STUBBED) called type={}", params.param);
 
@@ -204,19 +199,18 @@ u32 nvmap::IocParam(const std::vector<u8>& input, std::vector<u8>& output) {
         UNIMPLEMENTED();
     }
 
-    std::memcpy(output.data(), &params, sizeof(params));
+    WriteParams(output, params);
     return 0;
 }
 
-u32 nvmap::IocFree(const std::vector<u8>& input, std::vector<u8>& output) {
+u32 nvmap::IocFree(Common::Span<const u8> input, Common::Span<u8> output) {
     // TODO(Subv): These flags are unconfirmed.
     enum FreeFlags {
         Freed = 0,
         NotFreedYet = 1,
     };
 
-    IocFreeParams params;
-    std::memcpy(&params, input.data(), sizeof(params));
+    auto params = ReadParams<IocFreeParams>(input);
 
     LOG_WARNING(Service_NVDRV, "(STUBBED) called");
 
@@ -249,7 +243,7 @@ u32 nvmap::IocFree(const std::vector<u8>& input, std::vector<u8>& output) {
 
     handles.erase(params.handle);
 
-    std::memcpy(output.data(), &params, sizeof(params));
+    WriteParams(output, params);
     return 0;
 }
 
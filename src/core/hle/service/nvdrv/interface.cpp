@@ -2,7 +2,9 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
 #include <cinttypes>
+#include <vector>
 #include "common/logging/log.h"
 #include "core/core.h"
 #include "core/hle/ipc_helpers.h"
@@ -33,75 +35,84 @@ void NVDRV::Open(Kernel::HLERequestContext& ctx) {
     rb.Push<u32>(0);
 }
 
-void NVDRV::IoctlBase(Kernel::HLERequestContext& ctx, IoctlVersion version) {
-    IPC::RequestParser rp{ctx};
-    u32 fd = rp.Pop<u32>();
-    u32 command = rp.Pop<u32>();
-
-    /// Ioctl 3 has 2 outputs, first in the input params, second is the result
-    std::vector<u8> output(ctx.GetWriteBufferSize(0));
-    std::vector<u8> output2;
-    if (version == IoctlVersion::Version3) {
-        output2.resize((ctx.GetWriteBufferSize(1)));
-    }
-
+void NVDRV::IoctlBase(Kernel::HLERequestContext& ctx, u32 fd, u32 command, IoctlVersion version) {
     /// Ioctl2 has 2 inputs. It's used to pass data directly instead of providing a pointer.
     /// KickOfPB uses this
-    auto input = ctx.ReadBuffer(0);
-
-    std::vector<u8> input2;
+    const auto input = ctx.ReadBufferSpan(0, scratch->input);
+    Common::Span<const u8> input2;
     if (version == IoctlVersion::Version2) {
-        input2 = ctx.ReadBuffer(1);
+        input2 = ctx.ReadBufferSpan(1, scratch->input2);
     }
 
     IoctlCtrl ctrl{};
-
-    u32 result = nvdrv->Ioctl(fd, command, input, input2, output, output2, ctrl, version);
+    const u32 result = ExecuteIoctl(ctx, fd, command, input, input2, ctrl, version);
 
     if (ctrl.must_delay) {
         ctrl.fresh_call = false;
-        ctx.SleepClientThread("NVServices::DelayedResponse", ctrl.timeout,
-                              [=](std::shared_ptr<Kernel::Thread> thread,
-                                  Kernel::HLERequestContext& ctx,
-                                  Kernel::ThreadWakeupReason reason) {
-                                  IoctlCtrl ctrl2{ctrl};
-                                  std::vector<u8> tmp_output = output;
-                                  std::vector<u8> tmp_output2 = output2;
-                                  u32 result = nvdrv->Ioctl(fd, command, input, input2, tmp_output,
-                                                            tmp_output2, ctrl2, version);
-                                  ctx.WriteBuffer(tmp_output, 0);
-                                  if (version == IoctlVersion::Version3) {
-                                      ctx.WriteBuffer(tmp_output2, 1);
-                                  }
-                                  IPC::ResponseBuilder rb{ctx, 3};
-                                  rb.Push(RESULT_SUCCESS);
-                                  rb.Push(result);
-                              },
-                              nvdrv->GetEventWriteable(ctrl.event_id));
-    } else {
-        ctx.WriteBuffer(output);
-        if (version == IoctlVersion::Version3) {
-            ctx.WriteBuffer(output2, 1);
-        }
+        // The guest may change its buffers while the thread sleeps, so the retry works on a copy
+        // of the input as it was when the ioctl was issued. Inputs are never written to, outputs
+        // overlapping them are handed out as separate copies, so they still hold that data.
+        std::vector<u8> input_copy(input.begin(), input.end());
+        std::vector<u8> input2_copy(input2.begin(), input2.end());
+        ctx.SleepClientThread(
+            "NVServices::DelayedResponse", ctrl.timeout,
+            [=, input_copy = std::move(input_copy), input2_copy = std::move(input2_copy)](
+                std::shared_ptr<Kernel::Thread> thread, Kernel::HLERequestContext& ctx,
+                Kernel::ThreadWakeupReason reason) {
+                IoctlCtrl ctrl2{ctrl};
+                const u32 result =
+                    ExecuteIoctl(ctx, fd, command, input_copy, input2_copy, ctrl2, version);
+                IPC::ResponseBuilder rb{ctx, 3};
+                rb.Push(RESULT_SUCCESS);
+                rb.Push(result);
+            },
+            nvdrv->GetEventWriteable(ctrl.event_id));
     }
     IPC::ResponseBuilder rb{ctx, 3};
     rb.Push(RESULT_SUCCESS);
     rb.Push(result);
 }
 
-void NVDRV::Ioctl(Kernel::HLERequestContext& ctx) {
+u32 NVDRV::ExecuteIoctl(Kernel::HLERequestContext& ctx, u32 fd, u32 command,
+                        Common::Span<const u8> input, Common::Span<const u8> input2,
+                        IoctlCtrl& ctrl, IoctlVersion version) {
+    /// Ioctl 3 has 2 outputs, first in the input params, second is the result
+    const auto output = ctx.WriteBufferSpan(0, scratch->output);
+    Common::Span<u8> output2;
+    if (version == IoctlVersion::Version3) {
+        output2 = ctx.WriteBufferSpan(1, scratch->output2);
+    }
+
+    // Devices that only fill part of the output expect the rest to be zero. Outputs written in
+    // place are rewritten in full if the ioctl is delayed and executed again.
+    std::fill(output.begin(), output.end(), u8{0});
+    std::fill(output2.begin(), output2.end(), u8{0});
+
+    const u32 result = nvdrv->Ioctl(fd, command, input, input2, output, output2, ctrl, version);
+
+    // Output of a delayed ioctl is only published by the retry.
+    if (!ctrl.must_delay) {
+        ctx.CommitWriteBufferSpan(output, output.size(), 0);
+        if (version == IoctlVersion::Version3) {
+            ctx.CommitWriteBufferSpan(output2, output2.size(), 1);
+        }
+    }
+    return result;
+}
+
+void NVDRV::Ioctl(Kernel::HLERequestContext& ctx, u32 fd, u32 command) {
     LOG_DEBUG(Service_NVDRV, "called");
-    IoctlBase(ctx, IoctlVersion::Version1);
+    IoctlBase(ctx, fd, command, IoctlVersion::Version1);
 }
 
-void NVDRV::Ioctl2(Kernel::HLERequestContext& ctx) {
+void NVDRV::Ioctl2(Kernel::HLERequestContext& ctx, u32 fd, u32 command) {
     LOG_DEBUG(Service_NVDRV, "called");
-    IoctlBase(ctx, IoctlVersion::Version2);
+    IoctlBase(ctx, fd, command, IoctlVersion::Version2);
 }
 
-void NVDRV::Ioctl3(Kernel::HLERequestContext& ctx) {
+void NVDRV::Ioctl3(Kernel::HLERequestContext& ctx, u32 fd, u32 command) {
     LOG_DEBUG(Service_NVDRV, "called");
-    IoctlBase(ctx, IoctlVersion::Version3);
+    IoctlBase(ctx, fd, command, IoctlVersion::Version3);
 }
 
 void NVDRV::Close(Kernel::HLERequestContext& ctx) {
@@ -178,10 +189,10 @@ void NVDRV::DumpGraphicsMemoryInfo(Kernel::HLERequestContext& ctx) {
 }
 
 NVDRV::NVDRV(std::shared_ptr<Module> nvdrv, const char* name)
-    : ServiceFramework(name), nvdrv(std::move(nvdrv)) {
+    : ServiceFramework(name), nvdrv(std::move(nvdrv)), scratch(std::make_unique<IoctlScratch>()) {
     static const FunctionInfo functions[] = {
         {0, &NVDRV::Open, "Open"},
-        {1, &NVDRV::Ioctl, "Ioctl"},
+        {1, Unpack<&NVDRV::Ioctl>, "Ioctl"},
         {2, &NVDRV::Close, "Close"},
         {3, &NVDRV::Initialize, "Initialize"},
         {4, &NVDRV::QueryEvent, "QueryEvent"},
@@ -191,8 +202,8 @@ NVDRV::NVDRV(std::shared_ptr<Module> nvdrv, const char* name)
         {8, &NVDRV::SetClientPID, "SetClientPID"},
         {9, &NVDRV::DumpGraphicsMemoryInfo, "DumpGraphicsMemoryInfo"},
         {10, nullptr, "InitializeDevtools"},
-        {11, &NVDRV::Ioctl2, "Ioctl2"},
-        {12, &NVDRV::Ioctl3, "Ioctl3"},
+        {11, Unpack<&NVDRV::Ioctl2>, "Ioctl2"},
+        {12, Unpack<&NVDRV::Ioctl3>, "Ioctl3"},
         {13, &NVDRV::FinishInitialize, "FinishInitialize"},
     };
     RegisterHandlers(functions);
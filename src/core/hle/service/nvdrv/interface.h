@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
 #include "core/hle/service/nvdrv/nvdrv.h"
 #include "core/hle/service/service.h"
@@ -23,9 +24,9 @@ public:
 
 private:
     void Open(Kernel::HLERequestContext& ctx);
-    void Ioctl(Kernel::HLERequestContext& ctx);
-    void Ioctl2(Kernel::HLERequestContext& ctx);
-    void Ioctl3(Kernel::HLERequestContext& ctx);
+    void Ioctl(Kernel::HLERequestContext& ctx, u32 fd, u32 command);
+    void Ioctl2(Kernel::HLERequestContext& ctx, u32 fd, u32 command);
+    void Ioctl3(Kernel::HLERequestContext& ctx, u32 fd, u32 command);
     void Close(Kernel::HLERequestContext& ctx);
     void Initialize(Kernel::HLERequestContext& ctx);
     void QueryEvent(Kernel::HLERequestContext& ctx);
@@ -33,9 +34,25 @@ private:
     void FinishInitialize(Kernel::HLERequestContext& ctx);
     void GetStatus(Kernel::HLERequestContext& ctx);
     void DumpGraphicsMemoryInfo(Kernel::HLERequestContext& ctx);
-    void IoctlBase(Kernel::HLERequestContext& ctx, IoctlVersion version);
+    void IoctlBase(Kernel::HLERequestContext& ctx, u32 fd, u32 command, IoctlVersion version);
+    u32 ExecuteIoctl(Kernel::HLERequestContext& ctx, u32 fd, u32 command,
+                     Common::Span<const u8> input, Common::Span<const u8> input2, IoctlCtrl& ctrl,
+                     IoctlVersion version);
+
+    /// Largest buffer an ioctl number can describe, as its length field is 14 bits wide.
+    static constexpr std::size_t MaxIoctlBufferSize = 1 << 14;
+
+    /// Space for ioctl buffers that can't be accessed in place in guest memory, reused by every
+    /// ioctl so that they don't allocate.
+    struct IoctlScratch {
+        std::array<u8, MaxIoctlBufferSize> input;
+        std::array<u8, MaxIoctlBufferSize> input2;
+        std::array<u8, MaxIoctlBufferSize> output;
+        std::array<u8, MaxIoctlBufferSize> output2;
+    };
 
     std::shared_ptr<Module> nvdrv;
+    std::unique_ptr<IoctlScratch> scratch;
 
     u64 pid{};
 };
@@ -70,8 +70,8 @@ u32 Module::Open(const std::string& device_name) {
     return fd;
 }
 
-u32 Module::Ioctl(u32 fd, u32 command, const std::vector<u8>& input, const std::vector<u8>& input2,
-                  std::vector<u8>& output, std::vector<u8>& output2, IoctlCtrl& ctrl,
+u32 Module::Ioctl(u32 fd, u32 command, Common::Span<const u8> input, Common::Span<const u8> input2,
+                  Common::Span<u8> output, Common::Span<u8> output2, IoctlCtrl& ctrl,
                   IoctlVersion version) {
     auto itr = open_files.find(fd);
     ASSERT_MSG(itr != open_files.end(), "Tried to talk to an invalid device");
@@ -74,6 +74,7 @@ void BufferQueue::QueueBuffer(u32 slot, BufferTransformFlags transform,
     itr->crop_rect = crop_rect;
     itr->swap_interval = swap_interval;
     itr->multi_fence = multi_fence;
+    ASSERT(queue_sequence.size() < queue_sequence.capacity());
     queue_sequence.push_back(slot);
 }
 
@@ -85,7 +86,7 @@ std::optional<std::reference_wrapper<const BufferQueue::Buffer>> BufferQueue::Ac
         itr = std::find_if(queue.begin(), queue.end(), [&slot](const Buffer& buffer) {
             return buffer.status == Buffer::Status::Queued && buffer.slot == slot;
         });
-        queue_sequence.pop_front();
+        queue_sequence.erase(queue_sequence.begin());
     }
     if (itr == queue.end())
         return {};
@@ -4,9 +4,9 @@
 
 #pragma once
 
-#include <list>
 #include <optional>
 #include <vector>
+#include <boost/container/static_vector.hpp>
 
 #include "common/common_funcs.h"
 #include "common/math_util.h"
@@ -42,6 +42,9 @@ static_assert(sizeof(IGBPBuffer) == 0x16C, "IGBPBuffer has wrong size");
 
 class BufferQueue final {
 public:
+    /// Maximum number of buffer slots of a queue, as in Android's BufferQueue.
+    static constexpr std::size_t MaxBufferSlots = 64;
+
     enum class QueryType {
         NativeWindowWidth = 0,
         NativeWindowHeight = 1,
@@ -102,7 +105,8 @@ private:
     u64 layer_id;
 
     std::vector<Buffer> queue;
-    std::list<u32> queue_sequence;
+    /// Slots in the order they were queued, fixed capacity so queueing never allocates.
+    boost::container::static_vector<u32, MaxBufferSlots> queue_sequence;
     Kernel::EventPair buffer_wait_event;
 };
 
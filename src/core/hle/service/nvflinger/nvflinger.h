@@ -25,6 +25,9 @@ class WritableEvent;
 
 namespace Service::Nvidia {
 class Module;
+namespace Devices {
+class nvdisp_disp0;
+}
 } // namespace Service::Nvidia
 
 namespace Service::VI {
@@ -90,6 +93,8 @@ private:
     const VI::Layer* FindLayer(u64 display_id, u64 layer_id) const;
 
     std::shared_ptr<Nvidia::Module> nvdrv;
+    /// Display device frames are flipped to, looked up once instead of every frame.
+    std::shared_ptr<Nvidia::Devices::nvdisp_disp0> nvdisp;
 
     std::vector<VI::Display> displays;
     std::vector<BufferQueue> buffer_queues;
@@ -3,6 +3,12 @@
 // Refer to the license.txt file included.
 
 #include <algorithm>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <unordered_set>
+#include <utility>
 #include <fmt/format.h>
 #include "common/assert.h"
 #include "common/logging/log.h"
@@ -89,13 +95,87 @@ namespace Service {
     return function_string;
 }
 
+namespace {
+/**
+ * Remembers which interfaces handled calls, so their counters can be listed. An interface is only
+ * added on its first call, keeping the lock out of both interface construction and the dispatch
+ * of later calls. Interfaces hand their counts over when they are destroyed.
+ */
+class CommandStatisticsRegistry {
+public:
+    void Add(ServiceFrameworkBase* service) {
+        std::lock_guard lock{mutex};
+        services.insert(service);
+    }
+
+    void Remove(ServiceFrameworkBase* service) {
+        std::lock_guard lock{mutex};
+        services.erase(service);
+        for (auto& command : service->GetCommandCounters()) {
+            Accumulate(removed_commands, std::move(command));
+        }
+    }
+
+    std::vector<CommandStatistics> GetStatistics() {
+        std::lock_guard lock{mutex};
+        // Interfaces of the same service, e.g. one per session, are reported together.
+        CommandMap commands = removed_commands;
+        for (const ServiceFrameworkBase* service : services) {
+            for (auto& command : service->GetCommandCounters()) {
+                Accumulate(commands, std::move(command));
+            }
+        }
+        std::vector<CommandStatistics> statistics;
+        statistics.reserve(commands.size());
+        for (auto& [key, command] : commands) {
+            statistics.push_back(std::move(command));
+        }
+        return statistics;
+    }
+
+    void Reset() {
+        std::lock_guard lock{mutex};
+        removed_commands.clear();
+        for (ServiceFrameworkBase* service : services) {
+            service->ResetCommandCounters();
+        }
+    }
+
+private:
+    /// Statistics sorted by service name and command id.
+    using CommandMap = std::map<std::pair<std::string, u32>, CommandStatistics>;
+
+    static void Accumulate(CommandMap& commands, CommandStatistics command) {
+        const auto [it, inserted] =
+            commands.try_emplace({command.service_name, command.command_id}, command);
+        if (!inserted) {
+            it->second.num_calls += command.num_calls;
+            it->second.host_time += command.host_time;
+        }
+    }
+
+    std::mutex mutex;
+    std::unordered_set<ServiceFrameworkBase*> services;
+    CommandMap removed_commands;
+};
+
+CommandStatisticsRegistry& GetCommandStatisticsRegistry() {
+    static CommandStatisticsRegistry registry;
+    return registry;
+}
+} // Anonymous namespace
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 ServiceFrameworkBase::ServiceFrameworkBase(const char* service_name, u32 max_sessions,
                                            InvokerFn* handler_invoker)
     : service_name(service_name), max_sessions(max_sessions), handler_invoker(handler_invoker) {}
 
-ServiceFrameworkBase::~ServiceFrameworkBase() = default;
+ServiceFrameworkBase::~ServiceFrameworkBase() {
+    if (is_statistics_registered.load(std::memory_order_relaxed)) {
+        GetCommandStatisticsRegistry().Remove(this);
+    }
+}
 
 void ServiceFrameworkBase::InstallAsService(SM::ServiceManager& service_manager) {
     ASSERT(!port_installed);
@@ -131,9 +211,43 @@ std::shared_ptr<Kernel::ClientPort> ServiceFrameworkBase::CreatePort() {
 void ServiceFrameworkBase::RegisterHandlersBase(const FunctionInfoBase* functions, std::size_t n) {
     handlers.reserve(handlers.size() + n);
     for (std::size_t i = 0; i < n; ++i) {
-        // Usually this array is sorted by id already, so hint to insert at the end
-        handlers.emplace_hint(handlers.cend(), functions[i].expected_header, functions[i]);
+        const FunctionInfoBase* info = &functions[i];
+        // Usually this array is sorted by id already, so this is mostly an insertion at the end
+        const auto it = std::lower_bound(handlers.begin(), handlers.end(), info->expected_header,
+                                         [](const FunctionInfoBase* handler, u32 id) {
+                                             return handler->expected_header < id;
+                                         });
+        if (it != handlers.end() && (*it)->expected_header == info->expected_header) {
+            continue;
+        }
+        handlers.insert(it, info);
+    }
+
+    dense_handler_indices.clear();
+    for (std::size_t index = 0; index < handlers.size(); ++index) {
+        const u32 command = handlers[index]->expected_header;
+        if (command >= MaxDenseCommandId) {
+            break;
+        }
+        dense_handler_indices.resize(command + 1);
+        dense_handler_indices[command] = static_cast<u16>(index + 1);
     }
+    command_counters = std::make_unique<CommandCounters[]>(handlers.size());
+}
+
+std::size_t ServiceFrameworkBase::FindHandler(u32 command) const {
+    if (command < dense_handler_indices.size()) {
+        const u16 index = dense_handler_indices[command];
+        return index == 0 ? handlers.size() : index - 1;
+    }
+    const auto it = std::lower_bound(handlers.begin(), handlers.end(), command,
+                                     [](const FunctionInfoBase* handler, u32 id) {
+                                         return handler->expected_header < id;
+                                     });
+    if (it == handlers.end() || (*it)->expected_header != command) {
+        return handlers.size();
+    }
+    return static_cast<std::size_t>(it - handlers.begin());
 }
 
 void ServiceFrameworkBase::ReportUnimplementedFunction(Kernel::HLERequestContext& ctx,
@@ -155,14 +269,54 @@ void ServiceFrameworkBase::ReportUnimplementedFunction(Kernel::HLERequestContext
 }
 
 void ServiceFrameworkBase::InvokeRequest(Kernel::HLERequestContext& ctx) {
-    auto itr = handlers.find(ctx.GetCommand());
-    const FunctionInfoBase* info = itr == handlers.end() ? nullptr : &itr->second;
-    if (info == nullptr || info->handler_callback == nullptr) {
+    const std::size_t index = FindHandler(ctx.GetCommand());
+    const FunctionInfoBase* info = index < handlers.size() ? handlers[index] : nullptr;
+    if (info == nullptr || (info->handler_callback == nullptr && info->direct_invoker == nullptr)) {
         return ReportUnimplementedFunction(ctx, info);
     }
 
     LOG_TRACE(Service, "{}", MakeFunctionString(info->name, GetServiceName(), ctx.CommandBuffer()));
-    handler_invoker(this, info->handler_callback, ctx);
+
+    const auto start_time = std::chrono::steady_clock::now();
+    if (info->direct_invoker != nullptr) {
+        info->direct_invoker(this, ctx);
+    } else {
+        handler_invoker(this, info->handler_callback, ctx);
+    }
+    const auto host_time = std::chrono::steady_clock::now() - start_time;
+
+    CommandCounters& counters = command_counters[index];
+    counters.num_calls.fetch_add(1, std::memory_order_relaxed);
+    counters.host_time_ns.fetch_add(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(host_time).count(),
+        std::memory_order_relaxed);
+    if (!is_statistics_registered.load(std::memory_order_relaxed) &&
+        !is_statistics_registered.exchange(true, std::memory_order_relaxed)) {
+        GetCommandStatisticsRegistry().Add(this);
+    }
+}
+
+std::vector<CommandStatistics> ServiceFrameworkBase::GetCommandCounters() const {
+    std::vector<CommandStatistics> statistics;
+    for (std::size_t index = 0; index < handlers.size(); ++index) {
+        const CommandCounters& counters = command_counters[index];
+        const u64 num_calls = counters.num_calls.load(std::memory_order_relaxed);
+        if (num_calls == 0) {
+            continue;
+        }
+        const u64 host_time_ns = counters.host_time_ns.load(std::memory_order_relaxed);
+        statistics.push_back({service_name, handlers[index]->expected_header,
+                              handlers[index]->name, num_calls,
+                              std::chrono::nanoseconds{host_time_ns}});
+    }
+    return statistics;
+}
+
+void ServiceFrameworkBase::ResetCommandCounters() {
+    for (std::size_t index = 0; index < handlers.size(); ++index) {
+        command_counters[index].num_calls.store(0, std::memory_order_relaxed);
+        command_counters[index].host_time_ns.store(0, std::memory_order_relaxed);
+    }
 }
 
 ResultCode ServiceFrameworkBase::HandleSyncRequest(Kernel::HLERequestContext& context) {
@@ -196,6 +350,9 @@ ResultCode ServiceFrameworkBase::HandleSyncRequest(Kernel::HLERequestContext& co
 
 /// Initialize ServiceManager
 void Init(std::shared_ptr<SM::ServiceManager>& sm, Core::System& system) {
+    // Statistics are kept per emulation session
+    ResetCommandStatistics();
+
     // NVFlinger needs to be accessed by several services like Vi and AppletOE so we instantiate it
     // here and pass it into the respective InstallInterfaces functions.
     auto nv_flinger = std::make_shared<NVFlinger::NVFlinger>(system);
@@ -261,4 +418,12 @@ void Init(std::shared_ptr<SM::ServiceManager>& sm, Core::System& system) {
 void Shutdown() {
     LOG_DEBUG(Service, "shutdown OK");
 }
+
+std::vector<CommandStatistics> GetCommandStatistics() {
+    return GetCommandStatisticsRegistry().GetStatistics();
+}
+
+void ResetCommandStatistics() {
+    GetCommandStatisticsRegistry().Reset();
+}
 } // namespace Service
@@ -4,9 +4,14 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <cstddef>
+#include <memory>
 #include <string>
-#include <boost/container/flat_map.hpp>
+#include <tuple>
+#include <type_traits>
+#include <vector>
 #include "common/common_types.h"
 #include "core/hle/kernel/hle_ipc.h"
 #include "core/hle/kernel/object.h"
@@ -25,6 +30,12 @@ class ServerSession;
 class HLERequestContext;
 } // namespace Kernel
 
+namespace IPC {
+/// Reads the normal parameters of a request into a tuple, defined in ipc_helpers.h.
+template <typename... Args>
+std::tuple<Args...> PopArguments(Kernel::HLERequestContext& ctx);
+} // namespace IPC
+
 namespace Service {
 
 namespace FileSystem {
@@ -39,6 +50,32 @@ static const int kMaxPortSize = 8; ///< Maximum size of a port name (8 character
 /// Arbitrary default number of maximum connections to an HLE service.
 static const u32 DefaultMaxSessions = 10;
 
+/// Number of calls made to a service command and the host time spent handling them.
+struct CommandStatistics {
+    std::string service_name;
+    u32 command_id;
+    std::string command_name;
+    u64 num_calls;
+    std::chrono::nanoseconds host_time;
+};
+
+/**
+ * Tag used in a FunctionInfo table in place of a plain handler, for handlers that take the normal
+ * parameters of the request as arguments, e.g. `void Read(Kernel::HLERequestContext& ctx, u64
+ * option, s64 offset, s64 length)` registered as `{0, Unpack<&IFile::Read>, "Read"}`.
+ */
+template <auto Handler>
+struct UnpackedHandler {};
+
+template <auto Handler>
+constexpr UnpackedHandler<Handler> Unpack{};
+
+/// Call counter and host time of a command, updated without locks from the handler thread.
+struct CommandCounters {
+    std::atomic<u64> num_calls{};
+    std::atomic<u64> host_time_ns{};
+};
+
 /**
  * This is an non-templated base of ServiceFramework to reduce code bloat and compilation times, it
  * is not meant to be used directly.
@@ -71,6 +108,12 @@ public:
 
     ResultCode HandleSyncRequest(Kernel::HLERequestContext& context) override;
 
+    /// Returns the calls made to each command of this interface and the host time spent in them.
+    std::vector<CommandStatistics> GetCommandCounters() const;
+
+    /// Clears the call counters and host times of this interface.
+    void ResetCommandCounters();
+
 protected:
     /// Member-function pointer type of SyncRequest handlers.
     template <typename Self>
@@ -80,19 +123,28 @@ private:
     template <typename T>
     friend class ServiceFramework;
 
+    using DirectInvokerFn = void(ServiceFrameworkBase* object, Kernel::HLERequestContext& ctx);
+
     struct FunctionInfoBase {
         u32 expected_header;
         HandlerFnP<ServiceFrameworkBase> handler_callback;
         const char* name;
+        /// Invokes the handler without going through a member function pointer, if set.
+        DirectInvokerFn* direct_invoker = nullptr;
     };
 
     using InvokerFn = void(ServiceFrameworkBase* object, HandlerFnP<ServiceFrameworkBase> member,
                            Kernel::HLERequestContext& ctx);
 
+    /// Commands with an id below this are looked up in a flat table instead of a binary search.
+    static constexpr u32 MaxDenseCommandId = 1024;
+
     ServiceFrameworkBase(const char* service_name, u32 max_sessions, InvokerFn* handler_invoker);
     ~ServiceFrameworkBase() override;
 
     void RegisterHandlersBase(const FunctionInfoBase* functions, std::size_t n);
+    /// Returns the index of the handler of a command, or the number of handlers if there is none.
+    std::size_t FindHandler(u32 command) const;
     void ReportUnimplementedFunction(Kernel::HLERequestContext& ctx, const FunctionInfoBase* info);
 
     /// Identifier string used to connect to the service.
@@ -106,7 +158,16 @@ private:
 
     /// Function used to safely up-cast pointers to the derived class before invoking a handler.
     InvokerFn* handler_invoker;
-    boost::container::flat_map<u32, FunctionInfoBase> handlers;
+    /// Registered handlers, sorted by command id. They point into the static function tables.
+    std::vector<const FunctionInfoBase*> handlers;
+    /// Index plus one into handlers for every command id below MaxDenseCommandId that is
+    /// registered, or zero if it isn't.
+    std::vector<u16> dense_handler_indices;
+    /// Counters of each handler, indexed like handlers. Every instance of an interface counts its
+    /// own calls, even though the function tables are shared.
+    std::unique_ptr<CommandCounters[]> command_counters;
+    /// Whether the interface was added to the command statistics, done on its first call.
+    std::atomic<bool> is_statistics_registered{false};
 };
 
 /**
@@ -143,6 +204,19 @@ protected:
                   expected_header,
                   // Type-erase member function pointer by casting it down to the base class.
                   static_cast<HandlerFnP<ServiceFrameworkBase>>(handler_callback), name} {}
+
+        /**
+         * Constructs a FunctionInfo for a function taking the normal parameters of the request as
+         * arguments after the context. The parameters are read in order from the command buffer,
+         * the same way a RequestParser would, before calling the handler.
+         *
+         * @param expected_header request header in the command buffer which will trigger dispatch
+         *     to this handler
+         * @param name human-friendly name for the request. Used mostly for logging purposes.
+         */
+        template <auto Handler>
+        FunctionInfo(u32 expected_header, UnpackedHandler<Handler>, const char* name)
+            : FunctionInfoBase{expected_header, nullptr, name, &UnpackingInvoker<Handler>} {}
     };
 
     /**
@@ -153,7 +227,7 @@ protected:
     explicit ServiceFramework(const char* service_name, u32 max_sessions = DefaultMaxSessions)
         : ServiceFrameworkBase(service_name, max_sessions, Invoker) {}
 
-    /// Registers handlers in the service.
+    /// Registers handlers in the service. The table must be static, handlers keep pointing to it.
     template <std::size_t N>
     void RegisterHandlers(const FunctionInfo (&functions)[N]) {
         RegisterHandlers(functions, N);
@@ -179,6 +253,20 @@ private:
         // Cast back up to our original types and call the member function
         (static_cast<Self*>(object)->*static_cast<HandlerFnP<Self>>(member))(ctx);
     }
+
+    /// Reads the arguments of Handler from the request and calls it, without any type erasure.
+    template <auto Handler>
+    static void UnpackingInvoker(ServiceFrameworkBase* object, Kernel::HLERequestContext& ctx) {
+        InvokeUnpacked(static_cast<Self*>(object), Handler, ctx);
+    }
+
+    template <typename Class, typename... Args>
+    static void InvokeUnpacked(Self* self,
+                               void (Class::*handler)(Kernel::HLERequestContext&, Args...),
+                               Kernel::HLERequestContext& ctx) {
+        std::apply([&](auto&&... args) { (self->*handler)(ctx, args...); },
+                   IPC::PopArguments<std::decay_t<Args>...>(ctx));
+    }
 };
 
 /// Initialize ServiceManager
@@ -187,4 +275,10 @@ void Init(std::shared_ptr<SM::ServiceManager>& sm, Core::System& system);
 /// Shutdown ServiceManager
 void Shutdown();
 
+/// Returns the statistics of every service command that was called, for debugging purposes.
+std::vector<CommandStatistics> GetCommandStatistics();
+
+/// Clears the call counters and host times of all service commands.
+void ResetCommandStatistics();
+
 } // namespace Service
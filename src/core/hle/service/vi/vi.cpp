@@ -15,6 +15,7 @@
 #include "common/common_funcs.h"
 #include "common/logging/log.h"
 #include "common/math_util.h"
+#include "common/span.h"
 #include "common/swap.h"
 #include "core/core_timing.h"
 #include "core/hle/ipc_helpers.h"
@@ -59,21 +60,27 @@ struct DisplayInfo {
 };
 static_assert(sizeof(DisplayInfo) == 0x60, "DisplayInfo has wrong size");
 
+/**
+ * Binder parcel. Requests are deserialized in place from the IPC input buffer and responses are
+ * serialized straight into the IPC output buffer, so transactions don't allocate.
+ */
 class Parcel {
 public:
-    // This default size was chosen arbitrarily.
-    static constexpr std::size_t DefaultBufferSize = 0x40;
-    Parcel() : buffer(DefaultBufferSize) {}
-    explicit Parcel(std::vector<u8> data) : buffer(std::move(data)) {}
+    /// Size of the stack scratch space used when the output buffer isn't contiguous host memory.
+    static constexpr std::size_t ScratchBufferSize = 0x400;
+
+    Parcel() = default;
+    /// Creates a parcel that deserializes from `data` in place, which must outlive the parcel.
+    explicit Parcel(Common::Span<const u8> data) : read_buffer(data) {}
     virtual ~Parcel() = default;
 
     template <typename T>
     T Read() {
         static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable.");
-        ASSERT(read_index + sizeof(T) <= buffer.size());
+        ASSERT(read_index + sizeof(T) <= read_buffer.size());
 
         T val;
-        std::memcpy(&val, buffer.data() + read_index, sizeof(T));
+        std::memcpy(&val, read_buffer.data() + read_index, sizeof(T));
         read_index += sizeof(T);
         read_index = Common::AlignUp(read_index, 4);
         return val;
@@ -82,48 +89,42 @@ public:
     template <typename T>
     T ReadUnaligned() {
         static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable.");
-        ASSERT(read_index + sizeof(T) <= buffer.size());
+        ASSERT(read_index + sizeof(T) <= read_buffer.size());
 
         T val;
-        std::memcpy(&val, buffer.data() + read_index, sizeof(T));
+        std::memcpy(&val, read_buffer.data() + read_index, sizeof(T));
         read_index += sizeof(T);
         return val;
     }
 
-    std::vector<u8> ReadBlock(std::size_t length) {
-        ASSERT(read_index + length <= buffer.size());
-        const u8* const begin = buffer.data() + read_index;
-        const u8* const end = begin + length;
-        std::vector<u8> data(begin, end);
+    /// Returns a view of the next `length` bytes, valid as long as the parcel's input data.
+    Common::Span<const u8> ReadBlock(std::size_t length) {
+        ASSERT(read_index + length <= read_buffer.size());
+        const Common::Span<const u8> data = read_buffer.subspan(read_index, length);
         read_index += length;
         read_index = Common::AlignUp(read_index, 4);
         return data;
     }
 
-    std::u16string ReadInterfaceToken() {
-        u32 unknown = Read<u32_le>();
-        u32 length = Read<u32_le>();
-
-        std::u16string token{};
+    /// Skips the interface token (a length prefixed UTF-16 string) at the start of a request.
+    void SkipInterfaceToken() {
+        [[maybe_unused]] const u32 unknown = Read<u32_le>();
+        const u32 length = Read<u32_le>();
 
-        for (u32 ch = 0; ch < length + 1; ++ch) {
-            token.push_back(ReadUnaligned<u16_le>());
-        }
+        // The token is null terminated, its length doesn't include the terminator.
+        read_index += (length + 1) * sizeof(u16_le);
+        ASSERT(read_index <= read_buffer.size());
 
         read_index = Common::AlignUp(read_index, 4);
-
-        return token;
     }
 
     template <typename T>
     void Write(const T& val) {
         static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable.");
 
-        if (buffer.size() < write_index + sizeof(T)) {
-            buffer.resize(buffer.size() + sizeof(T) + DefaultBufferSize);
+        if (write_index + sizeof(T) <= write_buffer.size()) {
+            std::memcpy(write_buffer.data() + write_index, &val, sizeof(T));
         }
-
-        std::memcpy(buffer.data() + write_index, &val, sizeof(T));
         write_index += sizeof(T);
         write_index = Common::AlignUp(write_index, 4);
     }
@@ -140,17 +141,19 @@ public:
     }
 
     void Deserialize() {
-        ASSERT(buffer.size() > sizeof(Header));
+        ASSERT(read_buffer.size() > sizeof(Header));
 
         Header header{};
-        std::memcpy(&header, buffer.data(), sizeof(Header));
+        std::memcpy(&header, read_buffer.data(), sizeof(Header));
 
         read_index = header.data_offset;
         DeserializeData();
     }
 
-    std::vector<u8> Serialize() {
+    /// Serializes the parcel into `output` and returns the number of bytes written.
+    std::size_t Serialize(Common::Span<u8> output) {
         ASSERT(read_index == 0);
+        write_buffer = output;
         write_index = sizeof(Header);
 
         SerializeData();
@@ -160,9 +163,27 @@ public:
         header.data_offset = sizeof(Header);
         header.objects_size = 4;
         header.objects_offset = sizeof(Header) + header.data_size;
-        std::memcpy(buffer.data(), &header, sizeof(Header));
 
-        return buffer;
+        // Empty objects section.
+        Write<u32_le>(0);
+
+        if (write_index > output.size()) {
+            LOG_CRITICAL(Service_VI, "Parcel of size {} doesn't fit in output buffer of size {}",
+                         write_index, output.size());
+        }
+        if (output.size() >= sizeof(Header)) {
+            std::memcpy(output.data(), &header, sizeof(Header));
+        }
+
+        write_buffer = {};
+        return std::min(write_index, output.size());
+    }
+
+    /// Serializes the parcel into the output buffer of a request and returns its size.
+    std::size_t Serialize(Kernel::HLERequestContext& ctx) {
+        std::array<u8, ScratchBufferSize> scratch;
+        const Common::Span<u8> output = ctx.WriteBufferSpan(0, scratch);
+        return ctx.CommitWriteBufferSpan(output, Serialize(output), 0);
     }
 
 protected:
@@ -179,7 +200,8 @@ private:
     };
     static_assert(sizeof(Header) == 16, "ParcelHeader has wrong size");
 
-    std::vector<u8> buffer;
+    Common::Span<u8> write_buffer;
+    Common::Span<const u8> read_buffer;
     std::size_t read_index = 0;
     std::size_t write_index = 0;
 };
@@ -212,13 +234,13 @@ private:
 
 class IGBPConnectRequestParcel : public Parcel {
 public:
-    explicit IGBPConnectRequestParcel(std::vector<u8> buffer) : Parcel(std::move(buffer)) {
+    explicit IGBPConnectRequestParcel(Common::Span<const u8> buffer) : Parcel(buffer) {
         Deserialize();
     }
     ~IGBPConnectRequestParcel() override = default;
 
     void DeserializeData() override {
-        std::u16string token = ReadInterfaceToken();
+        SkipInterfaceToken();
         data = Read<Data>();
     }
 
@@ -275,14 +297,14 @@ private:
 
 class IGBPSetPreallocatedBufferRequestParcel : public Parcel {
 public:
-    explicit IGBPSetPreallocatedBufferRequestParcel(std::vector<u8> buffer)
-        : Parcel(std::move(buffer)) {
+    explicit IGBPSetPreallocatedBufferRequestParcel(Common::Span<const u8> buffer)
+        : Parcel(buffer) {
         Deserialize();
     }
     ~IGBPSetPreallocatedBufferRequestParcel() override = default;
 
     void DeserializeData() override {
-        std::u16string token = ReadInterfaceToken();
+        SkipInterfaceToken();
         data = Read<Data>();
         buffer = Read<NVFlinger::IGBPBuffer>();
     }
@@ -308,13 +330,13 @@ protected:
 
 class IGBPDequeueBufferRequestParcel : public Parcel {
 public:
-    explicit IGBPDequeueBufferRequestParcel(std::vector<u8> buffer) : Parcel(std::move(buffer)) {
+    explicit IGBPDequeueBufferRequestParcel(Common::Span<const u8> buffer) : Parcel(buffer) {
         Deserialize();
     }
     ~IGBPDequeueBufferRequestParcel() override = default;
 
     void DeserializeData() override {
-        std::u16string token = ReadInterfaceToken();
+        SkipInterfaceToken();
         data = Read<Data>();
     }
 
@@ -349,13 +371,13 @@ protected:
 
 class IGBPRequestBufferRequestParcel : public Parcel {
 public:
-    explicit IGBPRequestBufferRequestParcel(std::vector<u8> buffer) : Parcel(std::move(buffer)) {
+    explicit IGBPRequestBufferRequestParcel(Common::Span<const u8> buffer) : Parcel(buffer) {
         Deserialize();
     }
     ~IGBPRequestBufferRequestParcel() override = default;
 
     void DeserializeData() override {
-        std::u16string token = ReadInterfaceToken();
+        SkipInterfaceToken();
         slot = Read<u32_le>();
     }
 
@@ -381,13 +403,13 @@ protected:
 
 class IGBPQueueBufferRequestParcel : public Parcel {
 public:
-    explicit IGBPQueueBufferRequestParcel(std::vector<u8> buffer) : Parcel(std::move(buffer)) {
+    explicit IGBPQueueBufferRequestParcel(Common::Span<const u8> buffer) : Parcel(buffer) {
         Deserialize();
     }
     ~IGBPQueueBufferRequestParcel() override = default;
 
     void DeserializeData() override {
-        std::u16string token = ReadInterfaceToken();
+        SkipInterfaceToken();
         data = Read<Data>();
     }
 
@@ -444,13 +466,13 @@ private:
 
 class IGBPQueryRequestParcel : public Parcel {
 public:
-    explicit IGBPQueryRequestParcel(std::vector<u8> buffer) : Parcel(std::move(buffer)) {
+    explicit IGBPQueryRequestParcel(Common::Span<const u8> buffer) : Parcel(buffer) {
         Deserialize();
     }
     ~IGBPQueryRequestParcel() override = default;
 
     void DeserializeData() override {
-        std::u16string token = ReadInterfaceToken();
+        SkipInterfaceToken();
         type = Read<u32_le>();
     }
 
@@ -476,10 +498,10 @@ public:
     explicit IHOSBinderDriver(std::shared_ptr<NVFlinger::NVFlinger> nv_flinger)
         : ServiceFramework("IHOSBinderDriver"), nv_flinger(std::move(nv_flinger)) {
         static const FunctionInfo functions[] = {
-            {0, &IHOSBinderDriver::TransactParcel, "TransactParcel"},
+            {0, Unpack<&IHOSBinderDriver::TransactParcel>, "TransactParcel"},
             {1, &IHOSBinderDriver::AdjustRefcount, "AdjustRefcount"},
             {2, &IHOSBinderDriver::GetNativeHandle, "GetNativeHandle"},
-            {3, &IHOSBinderDriver::TransactParcel, "TransactParcelAuto"},
+            {3, Unpack<&IHOSBinderDriver::TransactParcel>, "TransactParcelAuto"},
         };
         RegisterHandlers(functions);
     }
@@ -502,34 +524,33 @@ private:
         SetPreallocatedBuffer = 14
     };
 
-    void TransactParcel(Kernel::HLERequestContext& ctx) {
-        IPC::RequestParser rp{ctx};
-        const u32 id = rp.Pop<u32>();
-        const auto transaction = static_cast<TransactionId>(rp.Pop<u32>());
-        const u32 flags = rp.Pop<u32>();
-
+    void TransactParcel(Kernel::HLERequestContext& ctx, u32 id, TransactionId transaction,
+                        u32 flags) {
         LOG_DEBUG(Service_VI, "called. id=0x{:08X} transaction={:X}, flags=0x{:08X}", id,
                   static_cast<u32>(transaction), flags);
 
         auto& buffer_queue = nv_flinger->FindBufferQueue(id);
 
+        std::array<u8, Parcel::ScratchBufferSize> input_scratch;
+        const Common::Span<const u8> input = ctx.ReadBufferSpan(0, input_scratch);
+
         if (transaction == TransactionId::Connect) {
-            IGBPConnectRequestParcel request{ctx.ReadBuffer()};
+            IGBPConnectRequestParcel request{input};
             IGBPConnectResponseParcel response{
                 static_cast<u32>(static_cast<u32>(DisplayResolution::UndockedWidth) *
                                  Settings::values.resolution_factor),
                 static_cast<u32>(static_cast<u32>(DisplayResolution::UndockedHeight) *
                                  Settings::values.resolution_factor)};
-            ctx.WriteBuffer(response.Serialize());
+            response.Serialize(ctx);
         } else if (transaction == TransactionId::SetPreallocatedBuffer) {
-            IGBPSetPreallocatedBufferRequestParcel request{ctx.ReadBuffer()};
+            IGBPSetPreallocatedBufferRequestParcel request{input};
 
             buffer_queue.SetPreallocatedBuffer(request.data.slot, request.buffer);
 
             IGBPSetPreallocatedBufferResponseParcel response{};
-            ctx.WriteBuffer(response.Serialize());
+            response.Serialize(ctx);
         } else if (transaction == TransactionId::DequeueBuffer) {
-            IGBPDequeueBufferRequestParcel request{ctx.ReadBuffer()};
+            IGBPDequeueBufferRequestParcel request{input};
             const u32 width{request.data.width};
             const u32 height{request.data.height};
             auto result = buffer_queue.DequeueBuffer(width, height);
@@ -537,7 +558,7 @@ private:
             if (result) {
                 // Buffer is available
                 IGBPDequeueBufferResponseParcel response{result->first, *result->second};
-                ctx.WriteBuffer(response.Serialize());
+                response.Serialize(ctx);
             } else {
                 // Wait the current thread until a buffer becomes available
                 ctx.SleepClientThread(
@@ -550,44 +571,42 @@ private:
                         ASSERT_MSG(result != std::nullopt, "Could not dequeue buffer.");
 
                         IGBPDequeueBufferResponseParcel response{result->first, *result->second};
-                        ctx.WriteBuffer(response.Serialize());
+                        response.Serialize(ctx);
                         IPC::ResponseBuilder rb{ctx, 2};
                         rb.Push(RESULT_SUCCESS);
                     },
                     buffer_queue.GetWritableBufferWaitEvent());
             }
         } else if (transaction == TransactionId::RequestBuffer) {
-            IGBPRequestBufferRequestParcel request{ctx.ReadBuffer()};
+            IGBPRequestBufferRequestParcel request{input};
 
             auto& buffer = buffer_queue.RequestBuffer(request.slot);
 
             IGBPRequestBufferResponseParcel response{buffer};
-            ctx.WriteBuffer(response.Serialize());
+            response.Serialize(ctx);
         } else if (transaction == TransactionId::QueueBuffer) {
-            IGBPQueueBufferRequestParcel request{ctx.ReadBuffer()};
+            IGBPQueueBufferRequestParcel request{input};
 
             buffer_queue.QueueBuffer(request.data.slot, request.data.transform,
                                      request.data.GetCropRect(), request.data.swap_interval,
                                      request.data.multi_fence);
 
             IGBPQueueBufferResponseParcel response{1280, 720};
-            ctx.WriteBuffer(response.Serialize());
+            response.Serialize(ctx);
         } else if (transaction == TransactionId::Query) {
-            IGBPQueryRequestParcel request{ctx.ReadBuffer()};
+            IGBPQueryRequestParcel request{input};
 
             const u32 value =
                 buffer_queue.Query(static_cast<NVFlinger::BufferQueue::QueryType>(request.type));
 
             IGBPQueryResponseParcel response{value};
-            ctx.WriteBuffer(response.Serialize());
+            response.Serialize(ctx);
         } else if (transaction == TransactionId::CancelBuffer) {
             LOG_CRITICAL(Service_VI, "(STUBBED) called, transaction=CancelBuffer");
         } else if (transaction == TransactionId::Disconnect ||
                    transaction == TransactionId::DetachBuffer) {
-            const auto buffer = ctx.ReadBuffer();
-
             IGBPEmptyResponseParcel response{};
-            ctx.WriteBuffer(response.Serialize());
+            response.Serialize(ctx);
         } else {
             ASSERT_MSG(false, "Unimplemented");
         }
@@ -1063,7 +1082,7 @@ private:
         NativeWindow native_window{*buffer_queue_id};
         IPC::ResponseBuilder rb{ctx, 4};
         rb.Push(RESULT_SUCCESS);
-        rb.Push<u64>(ctx.WriteBuffer(native_window.Serialize()));
+        rb.Push<u64>(native_window.Serialize(ctx));
     }
 
     void CreateStrayLayer(Kernel::HLERequestContext& ctx) {
@@ -1094,7 +1113,7 @@ private:
         IPC::ResponseBuilder rb{ctx, 6};
         rb.Push(RESULT_SUCCESS);
         rb.Push(*layer_id);
-        rb.Push<u64>(ctx.WriteBuffer(native_window.Serialize()));
+        rb.Push<u64>(native_window.Serialize(ctx));
     }
 
     void DestroyStrayLayer(Kernel::HLERequestContext& ctx) {
@@ -30,6 +30,11 @@ struct Memory::Impl {
     void SetCurrentPageTable(Kernel::Process& process) {
         current_page_table = &process.VMManager().page_table;
 
+        // The CPU cores only exist while the system is powered on.
+        if (!system.IsPoweredOn()) {
+            return;
+        }
+
         const std::size_t address_space_width = process.VMManager().GetAddressSpaceWidth();
 
         system.ArmInterface(0).PageTableChanged(*current_page_table, address_space_width);
@@ -158,6 +163,27 @@ struct Memory::Impl {
         return nullptr;
     }
 
+    u8* GetContiguousPointer(const VAddr vaddr, const std::size_t size) {
+        const auto& page_table = system.CurrentProcess()->VMManager().page_table;
+        const std::size_t first_page = vaddr >> PAGE_BITS;
+        const std::size_t last_page = (vaddr + size - 1) >> PAGE_BITS;
+        if (size == 0 || last_page < first_page || last_page >= page_table.pointers.size()) {
+            return nullptr;
+        }
+
+        // Rasterizer cached pages are excluded, as accesses to them have to flush or invalidate
+        // the GPU caches.
+        u8* const base = page_table.pointers[first_page];
+        for (std::size_t page = first_page; page <= last_page; ++page) {
+            if (page_table.attributes[page] != Common::PageType::Memory ||
+                page_table.pointers[page] != base + (page - first_page) * PAGE_SIZE) {
+                return nullptr;
+            }
+        }
+
+        return base + (vaddr & PAGE_MASK);
+    }
+
     u8 Read8(const VAddr addr) {
         return Read<u8>(addr);
     }
@@ -633,6 +659,10 @@ const u8* Memory::GetPointer(VAddr vaddr) const {
     return impl->GetPointer(vaddr);
 }
 
+u8* Memory::GetContiguousPointer(VAddr vaddr, std::size_t size) {
+    return impl->GetContiguousPointer(vaddr, size);
+}
+
 u8 Memory::Read8(const VAddr addr) {
     return impl->Read8(addr);
 }
@@ -159,6 +159,19 @@ public:
      */
     const u8* GetPointer(VAddr vaddr) const;
 
+    /**
+     * Gets a pointer to a range of the current process' address space, if the whole range can be
+     * accessed directly through it.
+     *
+     * @param vaddr Virtual address of the start of the range.
+     * @param size  Size of the range, in bytes.
+     *
+     * @returns The pointer to the start of the range, if every page within it is regular memory
+     *          and the pages are adjacent in host memory. Otherwise nullptr is returned, and the
+     *          range has to be accessed through ReadBlock and WriteBlock.
+     */
+    u8* GetContiguousPointer(VAddr vaddr, std::size_t size);
+
     /**
      * Reads an 8-bit unsigned value from the current process' address space
      * at the given virtual address.
@@ -409,6 +409,10 @@ struct Values {
 
     // Core
     bool use_multi_core;
+    // Ticks each CPU core runs before yielding to the others, unless an event is due earlier.
+    u32 cpu_timeslice;
+    // Runs the guest's memcpy, memset and similar routines on the host instead of in the JIT.
+    bool use_host_routines;
 
     // Data Storage
     bool use_virtual_sd;
@@ -419,6 +423,8 @@ struct Values {
     NANDSystemSize nand_system_size;
     NANDUserSize nand_user_size;
     SDMCSize sdmc_size;
+    // Memory budget for decrypted NCA sectors, in MiB. Zero disables the cache.
+    u32 decrypted_sector_cache_size;
 
     // Renderer
     RendererBackend renderer_backend;
@@ -0,0 +1,123 @@
+// Copyright 2019 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <array>
+#include <random>
+#include <vector>
+#include <catch2/catch.hpp>
+#include "common/common_types.h"
+#include "common/intrusive_priority_queue.h"
+
+namespace Common {
+
+namespace {
+struct Waiter {
+    u32 priority = 0;
+    u32 sequence = 0;
+    IntrusivePriorityQueueNode<Waiter> node;
+};
+
+using WaiterQueue = IntrusivePriorityQueue<Waiter, &Waiter::node>;
+} // Anonymous namespace
+
+TEST_CASE("IntrusivePriorityQueue: Ordering", "[common]") {
+    std::array<Waiter, 6> waiters{};
+    WaiterQueue queue;
+    REQUIRE(queue.empty());
+    REQUIRE(queue.front() == nullptr);
+
+    queue.add(waiters[0], 44);
+    queue.add(waiters[1], 44);
+    queue.add(waiters[2], 12);
+    queue.add(waiters[3], 63);
+    queue.add(waiters[4], 44, false);
+    queue.add(waiters[5], 0);
+    REQUIRE(queue.size() == 6);
+    REQUIRE(waiters[4].node.IsLinked());
+
+    queue.remove(waiters[0]);
+    REQUIRE(!waiters[0].node.IsLinked());
+    REQUIRE(queue.size() == 5);
+
+    REQUIRE(queue.pop_front() == &waiters[5]);
+    REQUIRE(queue.pop_front() == &waiters[2]);
+    REQUIRE(queue.pop_front() == &waiters[4]);
+    REQUIRE(queue.pop_front() == &waiters[1]);
+    REQUIRE(queue.pop_front() == &waiters[3]);
+    REQUIRE(queue.pop_front() == nullptr);
+    REQUIRE(queue.empty());
+
+    // Removing the last element of a priority level keeps the next level reachable.
+    queue.add(waiters[0], 5);
+    queue.add(waiters[1], 5);
+    queue.add(waiters[2], 7);
+    queue.remove(waiters[1]);
+    queue.add(waiters[3], 6);
+    REQUIRE(queue.pop_front() == &waiters[0]);
+    REQUIRE(queue.pop_front() == &waiters[3]);
+    REQUIRE(queue.pop_front() == &waiters[2]);
+}
+
+TEST_CASE("IntrusivePriorityQueue: Stress with thousands of waiters", "[common]") {
+    constexpr std::size_t num_waiters = 4096;
+    std::vector<Waiter> waiters(num_waiters);
+    std::vector<Waiter*> reference;
+    WaiterQueue queue;
+    std::mt19937 rng(42);
+    u32 sequence = 0;
+
+    // The reference keeps waiters sorted by priority, then by insertion order.
+    const auto add = [&](Waiter& waiter) {
+        waiter.priority = rng() % 64;
+        waiter.sequence = sequence++;
+        queue.add(waiter, waiter.priority);
+        const auto pos = std::upper_bound(reference.begin(), reference.end(), &waiter,
+                                          [](const Waiter* lhs, const Waiter* rhs) {
+                                              return lhs->priority < rhs->priority;
+                                          });
+        reference.insert(pos, &waiter);
+    };
+
+    for (auto& waiter : waiters) {
+        add(waiter);
+    }
+    REQUIRE(queue.size() == num_waiters);
+
+    for (int round = 0; round < 64; ++round) {
+        // Time out random waiters, as if their wait had expired.
+        for (int i = 0; i < 64; ++i) {
+            Waiter& waiter = waiters[rng() % num_waiters];
+            if (!waiter.node.IsLinked()) {
+                continue;
+            }
+            queue.remove(waiter);
+            reference.erase(std::find(reference.begin(), reference.end(), &waiter));
+        }
+
+        // Wake a few of the highest priority waiters, as a signal with a small count would.
+        const std::size_t num_to_wake = std::min<std::size_t>(rng() % 32, reference.size());
+        for (std::size_t i = 0; i < num_to_wake; ++i) {
+            REQUIRE(queue.pop_front() == reference.front());
+            reference.erase(reference.begin());
+        }
+
+        // Waiters that were woken up or timed out wait again.
+        for (auto& waiter : waiters) {
+            if (!waiter.node.IsLinked() && rng() % 2 == 0) {
+                add(waiter);
+            }
+        }
+        REQUIRE(queue.size() == reference.size());
+    }
+
+    // Waking everyone returns the waiters in priority order, and in insertion order within the
+    // same priority.
+    for (Waiter* expected : reference) {
+        REQUIRE(queue.pop_front() == expected);
+    }
+    REQUIRE(queue.empty());
+}
+
+} // namespace Common
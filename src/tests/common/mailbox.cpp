@@ -0,0 +1,76 @@
+// Copyright 2019 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <array>
+#include <thread>
+#include <vector>
+#include <catch2/catch.hpp>
+#include "common/common_types.h"
+#include "common/mailbox.h"
+
+namespace Common {
+
+namespace {
+
+struct Message {
+    std::size_t producer;
+    u64 sequence;
+};
+
+} // Anonymous namespace
+
+TEST_CASE("Mailbox: Drains messages in push order", "[common]") {
+    Mailbox<u64> mailbox;
+    REQUIRE(mailbox.Empty());
+
+    for (u64 i = 0; i < 16; ++i) {
+        mailbox.Push(i);
+    }
+    REQUIRE(!mailbox.Empty());
+
+    std::vector<u64> drained;
+    mailbox.Drain([&](u64 value) { drained.push_back(value); });
+    REQUIRE(mailbox.Empty());
+    REQUIRE(drained.size() == 16);
+    for (u64 i = 0; i < 16; ++i) {
+        REQUIRE(drained[i] == i);
+    }
+}
+
+TEST_CASE("Mailbox: Concurrent producers", "[common]") {
+    constexpr std::size_t NUM_PRODUCERS = 4;
+    constexpr u64 NUM_MESSAGES = 100000;
+
+    Mailbox<Message> mailbox;
+    std::array<u64, NUM_PRODUCERS> next_sequence{};
+    bool in_order = true;
+    const auto consume = [&](Message message) {
+        in_order &= message.sequence == next_sequence[message.producer];
+        ++next_sequence[message.producer];
+    };
+
+    std::vector<std::thread> producers;
+    for (std::size_t producer = 0; producer < NUM_PRODUCERS; ++producer) {
+        producers.emplace_back([&mailbox, producer] {
+            for (u64 i = 0; i < NUM_MESSAGES; ++i) {
+                mailbox.Push(producer, i);
+            }
+        });
+    }
+    // Drain while the producers are still pushing.
+    for (int i = 0; i < 1000; ++i) {
+        mailbox.Drain(consume);
+    }
+    for (auto& thread : producers) {
+        thread.join();
+    }
+    mailbox.Drain(consume);
+
+    REQUIRE(in_order);
+    for (const u64 count : next_sequence) {
+        REQUIRE(count == NUM_MESSAGES);
+    }
+}
+
+} // namespace Common
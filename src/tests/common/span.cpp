@@ -0,0 +1,42 @@
+// Copyright 2019 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <array>
+#include <vector>
+#include <catch2/catch.hpp>
+#include "common/common_types.h"
+#include "common/span.h"
+
+namespace Common {
+
+TEST_CASE("Span: Construction and slicing", "[common]") {
+    std::vector<u8> vector{1, 2, 3, 4, 5};
+    const Span<u8> span{vector};
+    REQUIRE(span.data() == vector.data());
+    REQUIRE(span.size() == vector.size());
+
+    span[0] = 9;
+    REQUIRE(vector[0] == 9);
+
+    const Span<const u8> const_span{span};
+    REQUIRE(const_span.data() == vector.data());
+    const Span<const u8> const_subspan = span.subspan(1);
+    REQUIRE(const_subspan.data() == vector.data() + 1);
+
+    REQUIRE(span.subspan(3).size() == 2);
+    REQUIRE(span.subspan(3)[0] == 4);
+    REQUIRE(span.subspan(1, 2).size() == 2);
+    REQUIRE(*span.subspan(1, 2).begin() == 2);
+    REQUIRE(span.first(4).end() == vector.data() + 4);
+    REQUIRE(span.subspan(5).empty());
+
+    const std::array<u32, 2> array{0x11223344, 0x55667788};
+    const Span<const u32> array_span{array};
+    REQUIRE(array_span.size_bytes() == 8);
+    REQUIRE(array_span[1] == 0x55667788);
+
+    REQUIRE(Span<u8>{}.empty());
+}
+
+} // namespace Common
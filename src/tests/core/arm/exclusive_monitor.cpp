@@ -0,0 +1,77 @@
+// Copyright 2019 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <memory>
+#include <vector>
+#include <catch2/catch.hpp>
+#include "common/common_types.h"
+#include "core/arm/exclusive_monitor.h"
+#include "core/core.h"
+#include "core/core_cpu.h"
+#include "core/hle/kernel/kernel.h"
+#include "core/hle/kernel/process.h"
+#include "core/memory.h"
+
+namespace Core {
+
+namespace {
+constexpr VAddr GUEST_BASE = 0x10000000;
+constexpr std::size_t NUM_CORES = 2;
+
+/// A page of host memory mapped at GUEST_BASE in the current process.
+class GuestMemory {
+public:
+    GuestMemory()
+        : system{System::GetInstance()},
+          process{Kernel::Process::Create(system, "ExclusiveMonitor",
+                                          Kernel::Process::ProcessType::Userland)},
+          backing(Memory::PAGE_SIZE) {
+        system.Memory().MapMemoryRegion(process->VMManager().page_table, GUEST_BASE,
+                                        backing.size(), backing.data());
+        system.Kernel().MakeCurrentProcess(process.get());
+    }
+
+    ~GuestMemory() {
+        system.Kernel().MakeCurrentProcess(nullptr);
+        system.Memory().UnmapRegion(process->VMManager().page_table, GUEST_BASE, backing.size());
+    }
+
+    System& system;
+    std::shared_ptr<Kernel::Process> process;
+    std::vector<u8> backing;
+};
+} // Anonymous namespace
+
+TEST_CASE("ExclusiveMonitor: Exclusive writes fail when memory changed", "[core][arm]") {
+    GuestMemory guest;
+    auto& memory = guest.system.Memory();
+    const auto monitor = Cpu::MakeExclusiveMonitor(memory, NUM_CORES);
+    if (!monitor) {
+        return;
+    }
+    memory.Write32(GUEST_BASE, 1);
+
+    SECTION("Untouched memory is written") {
+        REQUIRE(monitor->ExclusiveRead32(0, GUEST_BASE) == 1);
+        REQUIRE(monitor->ExclusiveWrite32(0, GUEST_BASE, 2));
+        REQUIRE(memory.Read32(GUEST_BASE) == 2);
+    }
+
+    SECTION("A plain store between the read and the write fails the write") {
+        REQUIRE(monitor->ExclusiveRead32(0, GUEST_BASE) == 1);
+        memory.Write32(GUEST_BASE, 3);
+        REQUIRE(!monitor->ExclusiveWrite32(0, GUEST_BASE, 2));
+        REQUIRE(memory.Read32(GUEST_BASE) == 3);
+    }
+
+    SECTION("An exclusive write of another core fails the write") {
+        REQUIRE(monitor->ExclusiveRead32(0, GUEST_BASE) == 1);
+        REQUIRE(monitor->ExclusiveRead32(1, GUEST_BASE) == 1);
+        REQUIRE(monitor->ExclusiveWrite32(1, GUEST_BASE, 4));
+        REQUIRE(!monitor->ExclusiveWrite32(0, GUEST_BASE, 2));
+        REQUIRE(memory.Read32(GUEST_BASE) == 4);
+    }
+}
+
+} // namespace Core
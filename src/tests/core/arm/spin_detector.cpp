@@ -0,0 +1,70 @@
+// Copyright 2019 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <array>
+#include <catch2/catch.hpp>
+#include "common/common_types.h"
+#include "core/arm/spin_detector.h"
+
+namespace Core {
+
+namespace {
+constexpr u64 HINT_PC = 0x80004000;
+constexpr u64 STACK = 0x7FFFF000;
+} // Anonymous namespace
+
+TEST_CASE("SpinDetector: Loops without progress are detected", "[core][arm]") {
+    SpinDetector detector;
+    std::array<u64, 31> registers{};
+    registers[0] = 0x12345678;
+
+    // The first hit only records the state, every repeat counts as an iteration.
+    for (u32 i = 0; i < SpinDetector::DETECTION_ITERATIONS; ++i) {
+        REQUIRE(!detector.OnHint(HINT_PC, registers, STACK));
+    }
+    REQUIRE(detector.OnHint(HINT_PC, registers, STACK));
+
+    // Detection starts over after reporting a spin.
+    REQUIRE(!detector.OnHint(HINT_PC, registers, STACK));
+}
+
+TEST_CASE("SpinDetector: Loops that make progress are not detected", "[core][arm]") {
+    SpinDetector detector;
+    std::array<u64, 31> registers{};
+
+    SECTION("A register changes every iteration") {
+        for (u32 i = 0; i < SpinDetector::DETECTION_ITERATIONS * 4; ++i) {
+            registers[3] = i;
+            REQUIRE(!detector.OnHint(HINT_PC, registers, STACK));
+        }
+    }
+
+    SECTION("The stack pointer changes every iteration") {
+        for (u32 i = 0; i < SpinDetector::DETECTION_ITERATIONS * 4; ++i) {
+            REQUIRE(!detector.OnHint(HINT_PC, registers, STACK - i * 16));
+        }
+    }
+
+    SECTION("Hints at different addresses alternate") {
+        for (u32 i = 0; i < SpinDetector::DETECTION_ITERATIONS * 4; ++i) {
+            REQUIRE(!detector.OnHint(HINT_PC + (i % 2) * 4, registers, STACK));
+        }
+    }
+}
+
+TEST_CASE("SpinDetector: Progress restarts the count", "[core][arm]") {
+    SpinDetector detector;
+    std::array<u64, 31> registers{};
+    for (u32 i = 0; i < SpinDetector::DETECTION_ITERATIONS - 1; ++i) {
+        REQUIRE(!detector.OnHint(HINT_PC, registers, STACK));
+    }
+
+    registers[30] = 1;
+    for (u32 i = 0; i < SpinDetector::DETECTION_ITERATIONS; ++i) {
+        REQUIRE(!detector.OnHint(HINT_PC, registers, STACK));
+    }
+    REQUIRE(detector.OnHint(HINT_PC, registers, STACK));
+}
+
+} // namespace Core
@@ -9,6 +9,7 @@
 #include <cstdlib>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "common/file_util.h"
 #include "core/core.h"
@@ -154,3 +155,100 @@ TEST_CASE("Core::Timing[PredictableLateness]", "[core]") {
     AdvanceAndCheck(core_timing, 0, 0, 10, -10); // (100 - 10)
     AdvanceAndCheck(core_timing, 1, 1, 50, -50);
 }
+
+TEST_CASE("Core::Timing[EventDueCallback]", "[core]") {
+    ScopeInit guard;
+    auto& core_timing = guard.core_timing;
+
+    std::shared_ptr<Core::Timing::EventType> empty_callback =
+        Core::Timing::CreateEvent("empty_callback", EmptyCallback);
+
+    std::vector<u64> halted_contexts;
+    core_timing.SetEventDueCallback([&](u64 context) { halted_contexts.push_back(context); });
+
+    // Enter slice 0
+    core_timing.ResetRun();
+    core_timing.SwitchContext(2);
+
+    // Events after the end of the running slice don't need to stop the context.
+    core_timing.ScheduleEvent(MAX_SLICE_LENGTH * 2, empty_callback);
+    REQUIRE(halted_contexts.empty());
+
+    core_timing.ScheduleEvent(500, empty_callback);
+    REQUIRE(halted_contexts == std::vector<u64>{2});
+    REQUIRE(500 == core_timing.GetDowncount());
+
+    core_timing.ScheduleEvent(800, empty_callback);
+    REQUIRE(halted_contexts.size() == 1);
+}
+
+TEST_CASE("Core::Timing[SliceLength]", "[core]") {
+    Core::Timing::CoreTiming core_timing;
+    core_timing.SetMaxSliceLength(MAX_SLICE_LENGTH * 10);
+    core_timing.Initialize();
+
+    std::shared_ptr<Core::Timing::EventType> empty_callback =
+        Core::Timing::CreateEvent("empty_callback", EmptyCallback);
+
+    core_timing.ResetRun();
+    REQUIRE(MAX_SLICE_LENGTH * 10 == core_timing.GetDowncount());
+
+    // Events due before the end of the slice still shorten it.
+    core_timing.ScheduleEvent(MAX_SLICE_LENGTH, empty_callback);
+    REQUIRE(MAX_SLICE_LENGTH == core_timing.GetDowncount());
+
+    core_timing.Shutdown();
+}
+
+TEST_CASE("Core::Timing[CoreEvents]", "[core]") {
+    ScopeInit guard;
+    auto& core_timing = guard.core_timing;
+
+    std::shared_ptr<Core::Timing::EventType> cb_a =
+        Core::Timing::CreateEvent("callbackA", CallbackTemplate<0>);
+    std::shared_ptr<Core::Timing::EventType> cb_b =
+        Core::Timing::CreateEvent("callbackB", CallbackTemplate<1>);
+    std::shared_ptr<Core::Timing::EventType> cb_c =
+        Core::Timing::CreateEvent("callbackC", CallbackTemplate<2>);
+    std::shared_ptr<Core::Timing::EventType> cb_d =
+        Core::Timing::CreateEvent("callbackD", CallbackTemplate<3>);
+
+    // Core events run in time order with the global ones, whatever core they were posted to.
+    core_timing.ScheduleCoreEvent(2, 300, cb_a, CB_IDS[0]);
+    core_timing.ScheduleEvent(200, cb_b, CB_IDS[1]);
+    core_timing.ScheduleCoreEvent(1, 100, cb_c, CB_IDS[2]);
+
+    // Cancelled wakeups never run.
+    core_timing.ScheduleCoreEvent(3, 150, cb_d, CB_IDS[3]);
+    core_timing.UnscheduleCoreEvent(3, cb_d, CB_IDS[3]);
+
+    // Enter slice 0, the posted requests are applied when timing is updated.
+    core_timing.ResetRun();
+    REQUIRE(100 == core_timing.GetDowncount());
+
+    AdvanceAndCheck(core_timing, 2, 0);
+    AdvanceAndCheck(core_timing, 1, 1);
+    AdvanceAndCheck(core_timing, 0, 2);
+}
+
+TEST_CASE("Core::Timing[CoreEventsDuringSlice]", "[core]") {
+    ScopeInit guard;
+    auto& core_timing = guard.core_timing;
+
+    std::shared_ptr<Core::Timing::EventType> cb_a =
+        Core::Timing::CreateEvent("callbackA", CallbackTemplate<0>);
+
+    // Enter slice 0
+    core_timing.ResetRun();
+
+    // Requests posted while a slice runs count their cycles from the time they are posted and
+    // end the slice early.
+    core_timing.SwitchContext(0);
+    core_timing.AddTicks(400);
+    const u64 scheduled_at = core_timing.GetTicks();
+    core_timing.ScheduleCoreEvent(1, 100, cb_a, CB_IDS[0]);
+    REQUIRE(100 == core_timing.GetDowncount());
+
+    AdvanceAndCheck(core_timing, 0, 0);
+    REQUIRE(core_timing.GetTicks() == scheduled_at + 100);
+}
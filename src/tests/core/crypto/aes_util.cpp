@@ -0,0 +1,195 @@
+// Copyright 2019 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <numeric>
+#include <random>
+#include <vector>
+#include <catch2/catch.hpp>
+#include "core/crypto/aes_util.h"
+#include "core/crypto/key_manager.h"
+
+namespace Core::Crypto {
+namespace {
+constexpr std::size_t XTS_SECTOR_SIZE = 0x4000;
+
+template <std::size_t Size>
+std::array<u8, Size> MakeKey(u8 seed) {
+    std::array<u8, Size> key;
+    std::iota(key.begin(), key.end(), seed);
+    return key;
+}
+
+std::vector<u8> MakeData(std::size_t size) {
+    std::mt19937 rng(0x1234);
+    std::vector<u8> data(size);
+    for (auto& byte : data) {
+        byte = static_cast<u8>(rng());
+    }
+    return data;
+}
+
+// Reference CTR built on top of ECB, which never uses the accelerated path.
+std::vector<u8> ReferenceCTR(const Key128& key, std::array<u8, 0x10> ctr,
+                             const std::vector<u8>& in) {
+    AESCipher<Key128> ecb(key, Mode::ECB);
+    std::vector<u8> out(in.size());
+    for (std::size_t offset = 0; offset < in.size(); offset += 0x10) {
+        std::array<u8, 0x10> keystream;
+        ecb.Transcode(ctr.data(), ctr.size(), keystream.data(), Op::Encrypt);
+        for (std::size_t i = 0; i < 0x10 && offset + i < in.size(); ++i) {
+            out[offset + i] = in[offset + i] ^ keystream[i];
+        }
+        for (std::size_t i = ctr.size(); i-- > 0;) {
+            if (++ctr[i] != 0) {
+                break;
+            }
+        }
+    }
+    return out;
+}
+
+// Reference XTS decryption of whole sectors with Nintendo's big-endian tweak, built on ECB.
+std::vector<u8> ReferenceXTSDecrypt(const Key256& key, std::size_t sector_id,
+                                    const std::vector<u8>& in) {
+    Key128 data_key;
+    Key128 tweak_key;
+    std::memcpy(data_key.data(), key.data(), data_key.size());
+    std::memcpy(tweak_key.data(), key.data() + data_key.size(), tweak_key.size());
+    AESCipher<Key128> data_cipher(data_key, Mode::ECB);
+    AESCipher<Key128> tweak_cipher(tweak_key, Mode::ECB);
+
+    std::vector<u8> out(in.size());
+    for (std::size_t sector = 0; sector < in.size(); sector += XTS_SECTOR_SIZE) {
+        std::array<u8, 0x10> tweak{};
+        auto id = sector_id++;
+        for (std::size_t i = tweak.size(); i-- > 0;) {
+            tweak[i] = static_cast<u8>(id);
+            id >>= 8;
+        }
+        tweak_cipher.Transcode(tweak.data(), tweak.size(), tweak.data(), Op::Encrypt);
+
+        for (std::size_t offset = sector; offset < sector + XTS_SECTOR_SIZE; offset += 0x10) {
+            std::array<u8, 0x10> block;
+            for (std::size_t i = 0; i < block.size(); ++i) {
+                block[i] = in[offset + i] ^ tweak[i];
+            }
+            data_cipher.Transcode(block.data(), block.size(), block.data(), Op::Decrypt);
+            for (std::size_t i = 0; i < block.size(); ++i) {
+                out[offset + i] = block[i] ^ tweak[i];
+            }
+
+            // Multiply the tweak by alpha in GF(2^128), little-endian.
+            u8 carry = 0;
+            for (auto& byte : tweak) {
+                const u8 next_carry = byte >> 7;
+                byte = static_cast<u8>((byte << 1) | carry);
+                carry = next_carry;
+            }
+            if (carry != 0) {
+                tweak[0] ^= 0x87;
+            }
+        }
+    }
+    return out;
+}
+} // Anonymous namespace
+
+TEST_CASE("AESCipher: CTR matches reference", "[core][crypto]") {
+    const auto key = MakeKey<0x10>(0x00);
+    const auto data = MakeData(0x1000 + 0x15);
+    std::array<u8, 0x10> iv;
+    iv.fill(0xFF); // Exercises carry propagation across the whole counter.
+    iv[0] = 0x12;
+
+    AESCipher<Key128> cipher(key, Mode::CTR);
+    cipher.SetIV({iv.begin(), iv.end()});
+    std::vector<u8> out(data.size());
+    cipher.Transcode(data.data(), data.size(), out.data(), Op::Decrypt);
+
+    REQUIRE(out == ReferenceCTR(key, iv, data));
+
+    // Lengths that are not a multiple of the pipeline width or the block size.
+    for (const std::size_t length : {1, 0x10, 0x11, 0x70, 0x90}) {
+        const std::vector<u8> part(data.begin(), data.begin() + length);
+        std::vector<u8> part_out(length);
+        cipher.SetIV({iv.begin(), iv.end()});
+        cipher.Transcode(part.data(), part.size(), part_out.data(), Op::Decrypt);
+        REQUIRE(part_out == ReferenceCTR(key, iv, part));
+    }
+}
+
+TEST_CASE("AESCipher: XTS known answer", "[core][crypto]") {
+    // IEEE P1619 test vector 1, whose tweak of zero is the same in Nintendo's encoding.
+    const Key256 key{};
+    const std::array<u8, 0x20> plaintext{};
+    constexpr std::array<u8, 0x20> ciphertext{
+        0x91, 0x7c, 0xf6, 0x9e, 0xbd, 0x68, 0xb2, 0xec, 0x9b, 0x9f, 0xe9,
+        0xa3, 0xea, 0xdd, 0xa6, 0x92, 0xcd, 0x43, 0xd2, 0xf5, 0x95, 0x98,
+        0xed, 0x85, 0x8c, 0x02, 0xc2, 0x65, 0x2f, 0xbf, 0x92, 0x2e,
+    };
+
+    AESCipher<Key256> cipher(key, Mode::XTS);
+    std::array<u8, 0x20> out;
+    cipher.XTSTranscode(plaintext.data(), plaintext.size(), out.data(), 0, out.size(),
+                        Op::Encrypt);
+    REQUIRE(out == ciphertext);
+
+    cipher.XTSTranscode(ciphertext.data(), ciphertext.size(), out.data(), 0, out.size(),
+                        Op::Decrypt);
+    REQUIRE(out == plaintext);
+}
+
+TEST_CASE("AESCipher: XTS matches reference", "[core][crypto]") {
+    const auto key = MakeKey<0x20>(0x40);
+    const auto data = MakeData(XTS_SECTOR_SIZE * 3);
+    constexpr std::size_t sector_id = 0x1234FF;
+
+    AESCipher<Key256> cipher(key, Mode::XTS);
+    std::vector<u8> out(data.size());
+    cipher.XTSTranscode(data.data(), data.size(), out.data(), sector_id, XTS_SECTOR_SIZE,
+                        Op::Decrypt);
+    REQUIRE(out == ReferenceXTSDecrypt(key, sector_id, data));
+
+    std::vector<u8> round_trip(data.size());
+    cipher.XTSTranscode(out.data(), out.size(), round_trip.data(), sector_id, XTS_SECTOR_SIZE,
+                        Op::Encrypt);
+    REQUIRE(round_trip == data);
+}
+
+// Not run by default. Invoke with `tests "[benchmark]"` to print decryption throughput over a
+// synthetic NCA section.
+TEST_CASE("AESCipher: NCA section throughput", "[.][benchmark][crypto]") {
+    constexpr std::size_t section_size = 0x4000000;
+    constexpr std::size_t read_size = 0x40000;
+    const auto data = MakeData(section_size);
+    std::vector<u8> out(read_size);
+
+    const auto measure = [&](const char* name, auto&& transcode) {
+        const auto start = std::chrono::steady_clock::now();
+        for (std::size_t offset = 0; offset < section_size; offset += read_size) {
+            transcode(data.data() + offset, offset);
+        }
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        WARN(name << ": " << section_size / elapsed.count() / 0x100000 << " MiB/s");
+    };
+
+    AESCipher<Key128> ctr(MakeKey<0x10>(0x00), Mode::CTR);
+    std::vector<u8> iv(0x10);
+    measure("CTR", [&](const u8* src, std::size_t offset) {
+        iv[0xF] = static_cast<u8>(offset >> 4);
+        ctr.SetIV(iv);
+        ctr.Transcode(src, read_size, out.data(), Op::Decrypt);
+    });
+
+    AESCipher<Key256> xts(MakeKey<0x20>(0x40), Mode::XTS);
+    measure("XTS", [&](const u8* src, std::size_t offset) {
+        xts.XTSTranscode(src, read_size, out.data(), offset / XTS_SECTOR_SIZE, XTS_SECTOR_SIZE,
+                         Op::Decrypt);
+    });
+}
+
+} // namespace Core::Crypto
@@ -0,0 +1,86 @@
+// Copyright 2019 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <random>
+#include <vector>
+#include <catch2/catch.hpp>
+#include "common/hex_util.h"
+#include "core/crypto/partition_data_manager.h"
+
+namespace Core::Crypto {
+
+namespace {
+// SHA-256 of the bytes 0x00..0x0F.
+const std::array<u8, 0x20> KEY_HASH =
+    Common::HexStringToArray<0x20>(
+        "BE45CB2605BF36BEBDE684841A28F0FD43C69850A3DCE5FEDBA69928EE3A8991");
+
+std::array<u8, 0x10> MakeKey() {
+    std::array<u8, 0x10> key{};
+    for (std::size_t i = 0; i < key.size(); ++i) {
+        key[i] = static_cast<u8>(i);
+    }
+    return key;
+}
+
+// Mix of random data and low entropy runs, resembling code and data of a real binary.
+std::vector<u8> MakeBinary(std::size_t size) {
+    std::mt19937 rng(1234);
+    std::vector<u8> binary(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        binary[i] = (i / 0x1000) % 2 == 0 ? static_cast<u8>(rng()) : static_cast<u8>(i % 4);
+    }
+    return binary;
+}
+} // Anonymous namespace
+
+TEST_CASE("PartitionDataManager: FindKeyFromHex16", "[core][crypto]") {
+    const auto key = MakeKey();
+
+    SECTION("Key at an unaligned offset") {
+        auto binary = MakeBinary(0x300000);
+        std::memcpy(binary.data() + 0x1ABCDF, key.data(), key.size());
+        REQUIRE(FindKeyFromHex16(binary, KEY_HASH) == key);
+    }
+
+    SECTION("Key at the very end") {
+        auto binary = MakeBinary(0x300000);
+        std::memcpy(binary.data() + binary.size() - key.size(), key.data(), key.size());
+        REQUIRE(FindKeyFromHex16(binary, KEY_HASH) == key);
+    }
+
+    SECTION("Key inside a low entropy region") {
+        auto binary = MakeBinary(0x300000);
+        std::memcpy(binary.data() + 0x1800, key.data(), key.size());
+        REQUIRE(FindKeyFromHex16(binary, KEY_HASH) == key);
+    }
+
+    SECTION("Key absent") {
+        const auto binary = MakeBinary(0x300000);
+        REQUIRE(FindKeyFromHex16(binary, KEY_HASH) == std::array<u8, 0x10>{});
+    }
+
+    SECTION("Binary shorter than a key") {
+        const std::vector<u8> binary(0xF);
+        REQUIRE(FindKeyFromHex16(binary, KEY_HASH) == std::array<u8, 0x10>{});
+    }
+}
+
+TEST_CASE("PartitionDataManager: Key scan throughput", "[.][benchmark][crypto]") {
+    const auto key = MakeKey();
+    auto binary = MakeBinary(0x1000000);
+    std::memcpy(binary.data() + binary.size() - key.size(), key.data(), key.size());
+
+    const auto start = std::chrono::steady_clock::now();
+    REQUIRE(FindKeyFromHex16(binary, KEY_HASH) == key);
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    WARN("Scanned " << binary.size() / 0x100000 << " MiB in " << elapsed.count() << " s ("
+                    << binary.size() / elapsed.count() / 0x100000 << " MiB/s)");
+}
+
+} // namespace Core::Crypto
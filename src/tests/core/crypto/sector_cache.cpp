@@ -0,0 +1,64 @@
+// Copyright 2019 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <array>
+#include <vector>
+#include <catch2/catch.hpp>
+#include "core/crypto/sector_cache.h"
+
+namespace Core::Crypto {
+
+TEST_CASE("SectorCache: Lookup and partial reads", "[core][crypto]") {
+    SectorCache cache;
+    const u64 id = cache.AllocateID();
+    REQUIRE(cache.AllocateID() != id);
+
+    std::vector<u8> sector(SectorCache::SECTOR_SIZE);
+    for (std::size_t i = 0; i < sector.size(); ++i) {
+        sector[i] = static_cast<u8>(i);
+    }
+
+    std::array<u8, 0x10> out{};
+    REQUIRE(!cache.Read(id, 3, out.data(), 0, out.size()));
+
+    cache.Insert(id, 3, sector.data(), sector.size());
+    REQUIRE(cache.Read(id, 3, out.data(), 0x105, out.size()));
+    REQUIRE(out[0] == 0x05);
+    REQUIRE(out[0xF] == 0x14);
+
+    // Same sector index of another layer is a different entry.
+    REQUIRE(!cache.Read(id + 1, 3, out.data(), 0, out.size()));
+
+    // Reads past the end of a short final sector miss.
+    cache.Insert(id, 4, sector.data(), 0x20);
+    REQUIRE(cache.Read(id, 4, out.data(), 0x10, 0x10));
+    REQUIRE(!cache.Read(id, 4, out.data(), 0x18, 0x10));
+}
+
+TEST_CASE("SectorCache: Eviction follows capacity", "[core][crypto]") {
+    // Sixteen shards of two sectors each.
+    SectorCache cache(SectorCache::SECTOR_SIZE * 32);
+    const u64 id = cache.AllocateID();
+    const std::vector<u8> sector(SectorCache::SECTOR_SIZE, 0xAB);
+    u8 out = 0;
+
+    for (u64 i = 0; i < 64; ++i) {
+        cache.Insert(id, i, sector.data(), sector.size());
+    }
+    for (u64 i = 0; i < 32; ++i) {
+        REQUIRE(!cache.Read(id, i, &out, 0, 1));
+    }
+    for (u64 i = 32; i < 64; ++i) {
+        REQUIRE(cache.Read(id, i, &out, 0, 1));
+        REQUIRE(out == 0xAB);
+    }
+
+    cache.SetCapacity(0);
+    REQUIRE(!cache.IsEnabled());
+    REQUIRE(!cache.Read(id, 63, &out, 0, 1));
+    cache.Insert(id, 63, sector.data(), sector.size());
+    REQUIRE(!cache.Read(id, 63, &out, 0, 1));
+}
+
+} // namespace Core::Crypto
@@ -0,0 +1,69 @@
+// Copyright 2019 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <string>
+#include <vector>
+#include <catch2/catch.hpp>
+#include "common/common_paths.h"
+#include "common/common_types.h"
+#include "common/file_util.h"
+#include "core/file_sys/vfs_real.h"
+
+namespace FileSys {
+
+namespace {
+/// Writes a file of the given size filled with a byte pattern next to the test binary.
+class TemporaryFile {
+public:
+    TemporaryFile(const std::string& name, std::size_t size)
+        : path(FileUtil::GetCurrentDir().value_or(".") + DIR_SEP + name), contents(size) {
+        std::iota(contents.begin(), contents.end(), u8{1});
+        FileUtil::IOFile file(path, "wb");
+        REQUIRE(file.WriteBytes(contents.data(), contents.size()) == contents.size());
+    }
+
+    ~TemporaryFile() {
+        FileUtil::Delete(path);
+    }
+
+    std::string path;
+    std::vector<u8> contents;
+};
+} // Anonymous namespace
+
+TEST_CASE("RealVfsFile: Read-only game images are mapped once", "[core][file_sys]") {
+    const TemporaryFile image("vfs_real_test.nca", 0x3000);
+    RealVfsFilesystem filesystem;
+
+    const auto file = filesystem.OpenFile(image.path, Mode::Read);
+    REQUIRE(file != nullptr);
+    const u8* const pointer = file->GetPointer(0x100, 0x1F00);
+    REQUIRE(pointer != nullptr);
+    REQUIRE(std::equal(pointer, pointer + 0x100, image.contents.begin() + 0x1F00));
+    REQUIRE(file->GetPointer(0x100, 0x2F80) == nullptr);
+
+    // Other opens of the same path share the mapping.
+    const auto other = filesystem.OpenFile(image.path, Mode::Read);
+    REQUIRE(other->GetPointer(0x100, 0x1F00) == pointer);
+
+    std::array<u8, 0x200> buffer{};
+    REQUIRE(file->Read(buffer.data(), buffer.size(), 0x2E00) == buffer.size());
+    REQUIRE(std::equal(buffer.begin(), buffer.end(), image.contents.begin() + 0x2E00));
+}
+
+TEST_CASE("RealVfsFile: Other file types are read through the file", "[core][file_sys]") {
+    const TemporaryFile data("vfs_real_test.bin", 0x3000);
+    RealVfsFilesystem filesystem;
+    const auto file = filesystem.OpenFile(data.path, Mode::Read);
+    REQUIRE(file->GetPointer(0x10, 0) == nullptr);
+
+    std::array<u8, 0x200> buffer{};
+    REQUIRE(file->Read(buffer.data(), buffer.size(), 0x1000) == buffer.size());
+    REQUIRE(std::equal(buffer.begin(), buffer.end(), data.contents.begin() + 0x1000));
+}
+
+} // namespace FileSys
@@ -0,0 +1,107 @@
+// Copyright 2019 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <cstring>
+#include <memory>
+#include <numeric>
+#include <vector>
+#include <catch2/catch.hpp>
+#include "common/common_types.h"
+#include "core/core.h"
+#include "core/hle/host_routines.h"
+#include "core/hle/kernel/process.h"
+#include "core/memory.h"
+
+namespace HLE {
+
+namespace {
+constexpr VAddr GUEST_BASE = 0x10000000;
+constexpr std::size_t NUM_PAGES = 4;
+
+/// Host memory mapped at GUEST_BASE in the page table of a new process.
+class GuestMemory {
+public:
+    GuestMemory()
+        : system{Core::System::GetInstance()},
+          process{Kernel::Process::Create(system, "HostRoutines",
+                                          Kernel::Process::ProcessType::Userland)},
+          backing(NUM_PAGES * Memory::PAGE_SIZE) {
+        std::iota(backing.begin(), backing.end(), u8{0});
+        system.Memory().MapMemoryRegion(process->VMManager().page_table, GUEST_BASE,
+                                        backing.size(), backing.data());
+    }
+
+    ~GuestMemory() {
+        system.Memory().UnmapRegion(process->VMManager().page_table, GUEST_BASE, backing.size());
+    }
+
+    u8* Pointer(VAddr address) {
+        return backing.data() + (address - GUEST_BASE);
+    }
+
+    Core::System& system;
+    std::shared_ptr<Kernel::Process> process;
+    std::vector<u8> backing;
+};
+} // Anonymous namespace
+
+TEST_CASE("HostRoutines: Memmove handles overlap in both directions", "[core][hle]") {
+    GuestMemory memory;
+    HostRoutines routines{memory.system};
+    // Larger than a page, so the copy takes several chunks.
+    constexpr u64 size = Memory::PAGE_SIZE + 0x800;
+
+    SECTION("Destination after the source") {
+        const VAddr src = GUEST_BASE + 0x100;
+        const VAddr dest = src + 0x10;
+        std::vector<u8> expected(memory.backing);
+        std::memmove(expected.data() + 0x110, expected.data() + 0x100, size);
+
+        REQUIRE(routines.Memmove(*memory.process, dest, src, size) == dest);
+        REQUIRE(memory.backing == expected);
+    }
+
+    SECTION("Destination before the source") {
+        const VAddr dest = GUEST_BASE + 0x100;
+        const VAddr src = dest + 0x10;
+        std::vector<u8> expected(memory.backing);
+        std::memmove(expected.data() + 0x100, expected.data() + 0x110, size);
+
+        REQUIRE(routines.Memmove(*memory.process, dest, src, size) == dest);
+        REQUIRE(memory.backing == expected);
+    }
+}
+
+TEST_CASE("HostRoutines: Memcmp compares bytes as unsigned", "[core][hle]") {
+    GuestMemory memory;
+    HostRoutines routines{memory.system};
+    const VAddr lhs = GUEST_BASE;
+    const VAddr rhs = GUEST_BASE + 2 * Memory::PAGE_SIZE;
+    constexpr u64 size = Memory::PAGE_SIZE + 0x10;
+    std::memcpy(memory.Pointer(rhs), memory.Pointer(lhs), size);
+    REQUIRE(routines.Memcmp(*memory.process, lhs, rhs, size) == 0);
+
+    // The difference sits in the second chunk, a signed comparison would flip the result.
+    *memory.Pointer(lhs + Memory::PAGE_SIZE + 4) = 0x01;
+    *memory.Pointer(rhs + Memory::PAGE_SIZE + 4) = 0xFF;
+    REQUIRE(routines.Memcmp(*memory.process, lhs, rhs, size) < 0);
+    REQUIRE(routines.Memcmp(*memory.process, rhs, lhs, size) > 0);
+
+    // Bytes past the compared size are ignored.
+    REQUIRE(routines.Memcmp(*memory.process, lhs, rhs, Memory::PAGE_SIZE + 4) == 0);
+}
+
+TEST_CASE("HostRoutines: Strlen crosses page boundaries", "[core][hle]") {
+    GuestMemory memory;
+    HostRoutines routines{memory.system};
+    const VAddr string = GUEST_BASE + Memory::PAGE_SIZE - 5;
+    std::memset(memory.Pointer(string), 'a', 15);
+    *memory.Pointer(string + 15) = 0;
+    REQUIRE(routines.Strlen(*memory.process, string) == 15);
+
+    *memory.Pointer(string) = 0;
+    REQUIRE(routines.Strlen(*memory.process, string) == 0);
+}
+
+} // namespace HLE
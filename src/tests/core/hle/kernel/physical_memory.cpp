@@ -0,0 +1,58 @@
+// Copyright 2019 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <vector>
+#include <catch2/catch.hpp>
+#include "common/common_types.h"
+#include "core/hle/kernel/physical_memory.h"
+
+namespace Kernel {
+
+TEST_CASE("PhysicalMemory: New memory is zero filled", "[core][kernel]") {
+    const auto is_zero = [](u8 value) { return value == 0; };
+    PhysicalMemory memory(0x3000);
+    REQUIRE(memory.size() == 0x3000);
+    REQUIRE(std::all_of(memory.begin(), memory.end(), is_zero));
+
+    std::fill(memory.begin(), memory.end(), u8{0xAA});
+    memory.resize(0x1000);
+    memory.resize(0x2000);
+    REQUIRE(memory[0xFFF] == 0xAA);
+    REQUIRE(std::all_of(memory.begin() + 0x1000, memory.end(), is_zero));
+}
+
+TEST_CASE("PhysicalMemory: Insert keeps the contents", "[core][kernel]") {
+    PhysicalMemory memory;
+    const std::vector<u8> head{1, 2, 3};
+    const std::vector<u8> tail(0x5000, 4);
+    memory.insert(memory.end(), tail.begin(), tail.end());
+    memory.insert(memory.begin(), head.begin(), head.end());
+
+    REQUIRE(memory.size() == head.size() + tail.size());
+    REQUIRE(std::equal(head.begin(), head.end(), memory.begin()));
+    REQUIRE(std::equal(tail.begin(), tail.end(), memory.begin() + head.size()));
+}
+
+TEST_CASE("PhysicalMemory: Reserved memory is committed on demand", "[core][kernel]") {
+    // Reserving far more than what is used must not take host memory.
+    auto reserved = PhysicalMemory::Reserve(0x100000000);
+    REQUIRE(reserved.has_value());
+    PhysicalMemory& arena = *reserved;
+    REQUIRE(arena.size() == 0x100000000);
+    u8* const base = arena.data();
+
+    REQUIRE(arena.Commit(0x80000000, 0x2000));
+    arena[0x80000000] = 1;
+    arena[0x80001FFF] = 2;
+    REQUIRE(arena[0x80000000] == 1);
+
+    // Decommitted pages read as zero, the block never moves.
+    arena.Decommit(0x80000000, 0x1000);
+    REQUIRE(arena[0x80000000] == 0);
+    REQUIRE(arena[0x80001FFF] == 2);
+    REQUIRE(arena.data() == base);
+}
+
+} // namespace Kernel
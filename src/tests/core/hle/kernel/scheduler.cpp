@@ -0,0 +1,151 @@
+// Copyright 2019 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <array>
+#include <memory>
+#include <catch2/catch.hpp>
+#include "common/common_types.h"
+#include "core/arm/arm_interface.h"
+#include "core/core.h"
+#include "core/hle/kernel/scheduler.h"
+#include "core/hle/kernel/thread.h"
+
+namespace Kernel {
+
+namespace {
+/// CPU that only holds a thread context, so the registers the scheduler loads can be inspected.
+class TestCpu final : public Core::ARM_Interface {
+public:
+    explicit TestCpu(Core::System& system) : ARM_Interface{system} {}
+
+    void Run() override {}
+    void Step() override {}
+    void ClearInstructionCache() override {}
+    void PageTableChanged(Common::PageTable&, std::size_t) override {}
+    void SetPC(u64 addr) override {
+        context.pc = addr;
+    }
+    u64 GetPC() const override {
+        return context.pc;
+    }
+    u64 GetReg(int index) const override {
+        return context.cpu_registers[index];
+    }
+    void SetReg(int index, u64 value) override {
+        context.cpu_registers[index] = value;
+    }
+    u128 GetVectorReg(int index) const override {
+        return context.vector_registers[index];
+    }
+    void SetVectorReg(int index, u128 value) override {
+        context.vector_registers[index] = value;
+    }
+    u32 GetPSTATE() const override {
+        return context.pstate;
+    }
+    void SetPSTATE(u32 pstate) override {
+        context.pstate = pstate;
+    }
+    VAddr GetTlsAddress() const override {
+        return tls_address;
+    }
+    void SetTlsAddress(VAddr address) override {
+        tls_address = address;
+    }
+    u64 GetTPIDR_EL0() const override {
+        return context.tpidr;
+    }
+    void SetTPIDR_EL0(u64 value) override {
+        context.tpidr = value;
+    }
+
+    void SaveGeneralContext(ThreadContext& ctx) override {
+        ctx.cpu_registers = context.cpu_registers;
+        ctx.sp = context.sp;
+        ctx.pc = context.pc;
+        ctx.pstate = context.pstate;
+    }
+    void LoadGeneralContext(const ThreadContext& ctx) override {
+        context.cpu_registers = ctx.cpu_registers;
+        context.sp = ctx.sp;
+        context.pc = ctx.pc;
+        context.pstate = ctx.pstate;
+    }
+    void SaveVectorContext(ThreadContext& ctx) override {
+        ctx.vector_registers = context.vector_registers;
+        ctx.fpcr = context.fpcr;
+        ctx.fpsr = context.fpsr;
+    }
+    void LoadVectorContext(const ThreadContext& ctx) override {
+        context.vector_registers = ctx.vector_registers;
+        context.fpcr = ctx.fpcr;
+        context.fpsr = ctx.fpsr;
+    }
+
+    void ClearExclusiveState() override {}
+    void PrepareReschedule() override {}
+    void NotifyEventDue() override {}
+
+    ThreadContext context{};
+    VAddr tls_address = 0;
+};
+
+/// One test CPU and scheduler per core, registered with the global scheduler of the system.
+struct TestCores {
+    explicit TestCores(Core::System& system) {
+        for (std::size_t core = 0; core < cpus.size(); ++core) {
+            cpus[core] = std::make_unique<TestCpu>(system);
+            schedulers[core] = std::make_unique<Scheduler>(system, *cpus[core], core);
+        }
+    }
+
+    void Reschedule(std::size_t core) {
+        Core::System::GetInstance().GlobalScheduler().SelectThread(core);
+        schedulers[core]->TryDoContextSwitch();
+    }
+
+    std::array<std::unique_ptr<TestCpu>, GlobalScheduler::NUM_CPU_CORES> cpus;
+    std::array<std::unique_ptr<Scheduler>, GlobalScheduler::NUM_CPU_CORES> schedulers;
+};
+} // Anonymous namespace
+
+TEST_CASE("Scheduler: Vector state follows a thread to another core", "[core][kernel]") {
+    auto& system = Core::System::GetInstance();
+    TestCores cores{system};
+
+    const auto thread = std::make_shared<Thread>(system.Kernel());
+    thread->GetContext().vector_registers[0] = {1, 2};
+    thread->SetStatus(ThreadStatus::Ready);
+
+    cores.Reschedule(0);
+    REQUIRE(cores.schedulers[0]->GetCurrentThread() == thread.get());
+    REQUIRE(cores.cpus[0]->context.vector_registers[0] == u128{1, 2});
+
+    // The thread changes a vector register and waits. Core 0 idles and keeps the vector state.
+    cores.cpus[0]->context.vector_registers[0] = {3, 4};
+    thread->SetStatus(ThreadStatus::WaitSleep);
+    cores.Reschedule(0);
+    REQUIRE(cores.schedulers[0]->GetCurrentThread() == nullptr);
+    REQUIRE(thread->GetContext().vector_registers[0] == u128{1, 2});
+
+    // It resumes on core 1, which has to get the vector state from core 0.
+    thread->ChangeCore(1, 0b10);
+    thread->SetStatus(ThreadStatus::Ready);
+    cores.Reschedule(1);
+    REQUIRE(cores.schedulers[1]->GetCurrentThread() == thread.get());
+    REQUIRE(cores.cpus[1]->context.vector_registers[0] == u128{3, 4});
+    REQUIRE(cores.schedulers[0]->GetContextSwitchStatistics().vector_saves == 1);
+
+    // Switching back to the thread on the core that holds its vector state skips the load.
+    thread->SetStatus(ThreadStatus::WaitSleep);
+    cores.Reschedule(1);
+    thread->SetStatus(ThreadStatus::Ready);
+    cores.Reschedule(1);
+    REQUIRE(cores.schedulers[1]->GetContextSwitchStatistics().lazy_vector_switches == 1);
+
+    thread->SetStatus(ThreadStatus::WaitSleep);
+    cores.Reschedule(1);
+}
+
+} // namespace Kernel
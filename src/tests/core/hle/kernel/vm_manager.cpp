@@ -0,0 +1,157 @@
+// Copyright 2019 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <chrono>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <vector>
+#include <catch2/catch.hpp>
+#include "common/common_types.h"
+#include "core/core.h"
+#include "core/hle/kernel/physical_memory.h"
+#include "core/hle/kernel/vm_manager.h"
+#include "core/memory.h"
+
+namespace Kernel {
+
+namespace {
+
+constexpr std::size_t NUM_PAGES = 4096;
+
+/// Maps NUM_PAGES pages with alternating permissions so that every page becomes its own VMA.
+VAddr MapAlternatingPages(VMManager& vm_manager) {
+    const VAddr base = vm_manager.GetASLRRegionBaseAddress();
+    auto block = std::make_shared<PhysicalMemory>(NUM_PAGES * Memory::PAGE_SIZE);
+    for (std::size_t page = 0; page < NUM_PAGES; ++page) {
+        const VMAPermission perm = page % 2 == 0 ? VMAPermission::Read : VMAPermission::ReadWrite;
+        const auto result =
+            vm_manager.MapMemoryBlock(base + page * Memory::PAGE_SIZE, block,
+                                      page * Memory::PAGE_SIZE, Memory::PAGE_SIZE,
+                                      MemoryState::Heap, perm);
+        REQUIRE(result.Succeeded());
+    }
+    return base;
+}
+
+bool ContainsAddress(const VMManager& vm_manager, VAddr address) {
+    const auto vma = vm_manager.FindVMA(address);
+    return vm_manager.IsValidHandle(vma) && vma->second.StartAddress() <= address &&
+           address <= vma->second.EndAddress();
+}
+
+} // Anonymous namespace
+
+TEST_CASE("VMManager: FindVMA across map and unmap", "[core][kernel]") {
+    VMManager vm_manager{Core::System::GetInstance()};
+    const VAddr base = MapAlternatingPages(vm_manager);
+
+    for (std::size_t page = 0; page < NUM_PAGES; ++page) {
+        const VAddr address = base + page * Memory::PAGE_SIZE;
+        REQUIRE(vm_manager.FindVMA(address)->second.base == address);
+        REQUIRE(vm_manager.FindVMA(address + Memory::PAGE_SIZE - 1)->second.base == address);
+    }
+    REQUIRE(ContainsAddress(vm_manager, base - 1));
+    REQUIRE(ContainsAddress(vm_manager, base + NUM_PAGES * Memory::PAGE_SIZE));
+    REQUIRE(!vm_manager.IsValidHandle(
+        vm_manager.FindVMA(vm_manager.GetAddressSpaceEndAddress())));
+
+    // Every fourth page becomes free, only the first one merges with the free space before it.
+    for (std::size_t page = 0; page < NUM_PAGES; page += 4) {
+        REQUIRE(vm_manager.UnmapRange(base + page * Memory::PAGE_SIZE, Memory::PAGE_SIZE)
+                    .IsSuccess());
+    }
+    for (std::size_t page = 0; page < NUM_PAGES; ++page) {
+        const VAddr address = base + page * Memory::PAGE_SIZE;
+        const auto vma = vm_manager.FindVMA(address);
+        REQUIRE(ContainsAddress(vm_manager, address));
+        REQUIRE((vma->second.type == VMAType::Free) == (page % 4 == 0));
+    }
+
+    // Unmapping the remaining pages merges the whole address space back into a single VMA.
+    for (std::size_t page = 0; page < NUM_PAGES; ++page) {
+        if (page % 4 != 0) {
+            REQUIRE(vm_manager.UnmapRange(base + page * Memory::PAGE_SIZE, Memory::PAGE_SIZE)
+                        .IsSuccess());
+        }
+    }
+    for (std::size_t page = 0; page < NUM_PAGES; page += 7) {
+        const auto vma = vm_manager.FindVMA(base + page * Memory::PAGE_SIZE);
+        REQUIRE(vma->second.base == 0);
+        REQUIRE(vma->second.size == vm_manager.GetAddressSpaceSize());
+    }
+}
+
+TEST_CASE("VMManager: Lookup throughput", "[.][benchmark][kernel]") {
+    constexpr int num_iterations = 100;
+    VMManager vm_manager{Core::System::GetInstance()};
+    const VAddr base = MapAlternatingPages(vm_manager);
+    u64 checksum = 0;
+
+    // Baseline, the same VMAs in a plain tree looked up the way FindVMA did without the index.
+    std::map<VAddr, VirtualMemoryArea> tree;
+    for (auto vma = vm_manager.FindVMA(0); vm_manager.IsValidHandle(vma); ++vma) {
+        tree.emplace(vma->first, vma->second);
+    }
+
+    // Pages are visited in a scattered order, so that no lookup benefits from locality.
+    std::vector<VAddr> addresses(NUM_PAGES);
+    for (std::size_t page = 0; page < NUM_PAGES; ++page) {
+        addresses[page] = base + (page * 2654435761ULL % NUM_PAGES) * Memory::PAGE_SIZE;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < num_iterations; ++i) {
+        for (const VAddr address : addresses) {
+            checksum += std::prev(tree.upper_bound(address))->second.size;
+        }
+    }
+    const std::chrono::duration<double, std::nano> tree_lookup =
+        std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < num_iterations; ++i) {
+        for (const VAddr address : addresses) {
+            checksum += vm_manager.FindVMA(address)->second.size;
+        }
+    }
+    const std::chrono::duration<double, std::nano> index_lookup =
+        std::chrono::steady_clock::now() - start;
+
+    // svcQueryMemory over every VMA of the region.
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < num_iterations; ++i) {
+        for (const VAddr address : addresses) {
+            checksum += vm_manager.QueryMemory(address).permission;
+        }
+    }
+    const std::chrono::duration<double, std::nano> query =
+        std::chrono::steady_clock::now() - start;
+
+    // Map and unmap churn in the middle of the region, the pattern MapPhysicalMemory and transfer
+    // memory produce.
+    auto block = std::make_shared<PhysicalMemory>(Memory::PAGE_SIZE);
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < num_iterations; ++i) {
+        for (std::size_t page = 0; page < NUM_PAGES; page += 2) {
+            const VAddr address = base + page * Memory::PAGE_SIZE;
+            REQUIRE(vm_manager.UnmapRange(address, Memory::PAGE_SIZE).IsSuccess());
+            checksum += vm_manager
+                            .MapMemoryBlock(address, block, 0, Memory::PAGE_SIZE,
+                                            MemoryState::Heap, VMAPermission::Read)
+                            .Succeeded();
+        }
+    }
+    const std::chrono::duration<double, std::nano> churn =
+        std::chrono::steady_clock::now() - start;
+
+    constexpr double num_lookups = num_iterations * NUM_PAGES;
+    REQUIRE(checksum != 0);
+    WARN("VMManager with " << NUM_PAGES << " VMAs: FindVMA " << index_lookup.count() / num_lookups
+                           << " ns (tree baseline " << tree_lookup.count() / num_lookups
+                           << " ns), QueryMemory " << query.count() / num_lookups
+                           << " ns, unmap+map " << churn.count() / (num_lookups / 2) << " ns");
+}
+
+} // namespace Kernel
@@ -0,0 +1,95 @@
+// Copyright 2019 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <catch2/catch.hpp>
+#include "core/hle/lock.h"
+
+namespace HLE {
+
+TEST_CASE("ProfiledMutex: Uncontended acquisitions", "[core][hle]") {
+    ResetLockStatistics();
+    ProfiledMutex<std::mutex> mutex{LockDomain::Scheduler};
+    for (int i = 0; i < 4; ++i) {
+        std::lock_guard lock{mutex};
+    }
+    REQUIRE(mutex.try_lock());
+    mutex.unlock();
+
+    const LockStatistics statistics = GetLockStatistics(LockDomain::Scheduler);
+    REQUIRE(statistics.acquisitions == 5);
+    REQUIRE(statistics.contentions == 0);
+    REQUIRE(statistics.wait_time.count() == 0);
+}
+
+namespace {
+
+/// Mutex whose first try_lock fails, as if another thread held it, and whose blocking lock only
+/// returns once the clock has moved.
+class ContendedMutex {
+public:
+    void lock() {
+        const auto begin = std::chrono::steady_clock::now();
+        while (std::chrono::steady_clock::now() == begin) {
+        }
+        held = true;
+    }
+
+    bool try_lock() {
+        if (!contended_once) {
+            contended_once = true;
+            return false;
+        }
+        if (held) {
+            return false;
+        }
+        held = true;
+        return true;
+    }
+
+    void unlock() {
+        held = false;
+    }
+
+private:
+    bool contended_once = false;
+    bool held = false;
+};
+
+} // Anonymous namespace
+
+TEST_CASE("ProfiledMutex: Contended acquisitions record wait time", "[core][hle]") {
+    ResetLockStatistics();
+    ProfiledMutex<ContendedMutex> mutex{LockDomain::Scheduler};
+
+    mutex.lock();
+    mutex.unlock();
+    {
+        std::lock_guard lock{mutex};
+    }
+
+    const LockStatistics statistics = GetLockStatistics(LockDomain::Scheduler);
+    REQUIRE(statistics.acquisitions == 2);
+    REQUIRE(statistics.contentions == 1);
+    REQUIRE(statistics.wait_time.count() > 0);
+    REQUIRE(GetLockStatistics(LockDomain::Kernel).contentions == 0);
+}
+
+TEST_CASE("ProfiledMutex: Held mutex is not acquired by other threads", "[core][hle]") {
+    ResetLockStatistics();
+    ProfiledMutex<std::mutex> mutex{LockDomain::Scheduler};
+
+    mutex.lock();
+    bool acquired = true;
+    std::thread prober([&] { acquired = mutex.try_lock(); });
+    prober.join();
+    mutex.unlock();
+
+    REQUIRE(!acquired);
+    REQUIRE(GetLockStatistics(LockDomain::Scheduler).acquisitions == 1);
+}
+
+} // namespace HLE
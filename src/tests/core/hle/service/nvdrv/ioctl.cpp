@@ -0,0 +1,390 @@
+// Copyright 2019 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <initializer_list>
+#include <memory>
+#include <vector>
+#include <catch2/catch.hpp>
+#include "common/alignment.h"
+#include "common/common_funcs.h"
+#include "common/common_types.h"
+#include "common/span.h"
+#include "core/core.h"
+#include "core/frontend/emu_window.h"
+#include "core/hle/ipc.h"
+#include "core/hle/ipc_helpers.h"
+#include "core/hle/kernel/handle_table.h"
+#include "core/hle/kernel/hle_ipc.h"
+#include "core/hle/kernel/kernel.h"
+#include "core/hle/kernel/process.h"
+#include "core/hle/kernel/server_session.h"
+#include "core/hle/service/nvdrv/devices/nvdevice.h"
+#include "core/hle/service/nvdrv/devices/nvhost_gpu.h"
+#include "core/hle/service/nvdrv/interface.h"
+#include "core/hle/service/nvdrv/nvdata.h"
+#include "core/hle/service/nvdrv/nvdrv.h"
+#include "core/memory.h"
+#include "video_core/dma_pusher.h"
+#include "video_core/gpu.h"
+#include "video_core/rasterizer_interface.h"
+#include "video_core/renderer_base.h"
+
+namespace Service::Nvidia::Devices {
+
+namespace {
+// Raw ioctl numbers of the nvhost_gpu commands used below.
+constexpr nvdevice::Ioctl SetClientDataCommand{0x40084714};
+constexpr nvdevice::Ioctl GetClientDataCommand{0x80084715};
+constexpr nvdevice::Ioctl ZCullBindCommand{0xC010480B};
+
+u32 CallIoctl(nvdevice& device, nvdevice::Ioctl command, Common::Span<const u8> input,
+              Common::Span<u8> output) {
+    IoctlCtrl ctrl{};
+    const u32 result = device.ioctl(command, input, {}, output, {}, ctrl, IoctlVersion::Version1);
+    REQUIRE(!ctrl.must_delay);
+    return result;
+}
+
+std::array<u8, 16> MakeZCullBindParams() {
+    std::array<u8, 16> params{};
+    const u64 gpu_va = 0x123456789A;
+    const u32 mode = 2;
+    std::memcpy(params.data(), &gpu_va, sizeof(gpu_va));
+    std::memcpy(params.data() + 8, &mode, sizeof(mode));
+    return params;
+}
+} // Anonymous namespace
+
+TEST_CASE("nvdevice: Ioctl parameters are clamped to the buffers", "[core][nvdrv]") {
+    const std::array<u8, 12> input{1, 0, 0, 0, 2, 0, 0, 0, 3, 0, 0, 0};
+    struct Params {
+        u32 a;
+        u32 b;
+    };
+
+    const auto params = ReadParams<Params>(input);
+    REQUIRE(params.a == 1);
+    REQUIRE(params.b == 2);
+
+    const auto short_params = ReadParams<Params>(Common::Span<const u8>{input.data(), 4});
+    REQUIRE(short_params.a == 1);
+    REQUIRE(short_params.b == 0);
+    REQUIRE(ReadParams<Params>({}).a == 0);
+
+    std::array<u8, 12> output{};
+    output.fill(0xFF);
+    WriteParams(Common::Span<u8>{output.data(), 6}, Params{0x11111111, 0x22222222});
+    REQUIRE(output[3] == 0x11);
+    REQUIRE(output[5] == 0x22);
+    REQUIRE(output[6] == 0xFF);
+
+    WriteParams(output, Params{0x33333333, 0x44444444});
+    REQUIRE(output[7] == 0x44);
+    REQUIRE(output[8] == 0xFF);
+}
+
+TEST_CASE("nvhost_gpu: Client data round trips through the device", "[core][nvdrv]") {
+    nvhost_gpu gpu{Core::System::GetInstance(), nullptr};
+    const u64 data = 0x1122334455667788;
+    std::array<u8, sizeof(u64)> input{};
+    std::memcpy(input.data(), &data, sizeof(data));
+    REQUIRE(CallIoctl(gpu, SetClientDataCommand, input, {}) == 0);
+
+    std::array<u8, sizeof(u64)> output{};
+    REQUIRE(CallIoctl(gpu, GetClientDataCommand, {}, output) == 0);
+    REQUIRE(output == input);
+
+    // Outputs shorter than the parameters only receive what fits.
+    std::array<u8, 12> short_output{};
+    short_output.fill(0xFF);
+    REQUIRE(CallIoctl(gpu, GetClientDataCommand, {}, Common::Span<u8>{short_output.data(), 4}) ==
+            0);
+    REQUIRE(short_output[0] == 0x88);
+    REQUIRE(short_output[3] == 0x55);
+    REQUIRE(short_output[4] == 0xFF);
+}
+
+TEST_CASE("nvhost_gpu: ZCullBind writes its parameters back", "[core][nvdrv]") {
+    nvhost_gpu gpu{Core::System::GetInstance(), nullptr};
+    const auto input = MakeZCullBindParams();
+    std::array<u8, 16> output{};
+    REQUIRE(CallIoctl(gpu, ZCullBindCommand, input, output) == 0);
+    REQUIRE(output == input);
+
+    // A short input reads as zero past its end.
+    std::array<u8, 16> short_output{};
+    short_output.fill(0xFF);
+    REQUIRE(CallIoctl(gpu, ZCullBindCommand, Common::Span<const u8>{input.data(), 8},
+                      short_output) == 0);
+    REQUIRE(std::equal(input.begin(), input.begin() + 8, short_output.begin()));
+    REQUIRE(short_output[8] == 0);
+}
+
+} // namespace Service::Nvidia::Devices
+
+namespace Service::Nvidia {
+
+namespace {
+constexpr VAddr GUEST_BASE = 0x10000000;
+constexpr std::size_t NUM_PAGES = 4;
+constexpr u32 NUM_ENTRIES = 16;
+
+// Command ids of the NVDRV ioctl commands.
+constexpr u32 IoctlCommandId = 1;
+constexpr u32 Ioctl2CommandId = 11;
+constexpr u32 Ioctl3CommandId = 12;
+
+// Raw ioctl numbers of SubmitGPFIFO and KickoffPB, both with 24 bytes of parameters.
+constexpr u32 SubmitGpfifoCommand = 0xC0184808;
+constexpr u32 KickoffPbCommand = 0xC018481B;
+
+/// Parameters of SubmitGPFIFO and KickoffPB.
+struct SubmitGpfifoParams {
+    u64 address;
+    u32 num_entries;
+    u32 flags;
+    Fence fence_out;
+};
+static_assert(sizeof(SubmitGpfifoParams) == 24, "SubmitGpfifoParams has the wrong size");
+
+constexpr u32 ParamsSize = sizeof(SubmitGpfifoParams);
+constexpr u32 EntriesSize = NUM_ENTRIES * sizeof(Tegra::CommandListHeader);
+
+class NullRasterizer final : public VideoCore::RasterizerInterface {
+public:
+    bool DrawBatch(bool is_indexed) override {
+        return true;
+    }
+    bool DrawMultiBatch(bool is_indexed) override {
+        return true;
+    }
+    void Clear() override {}
+    void DispatchCompute(GPUVAddr code_addr) override {}
+    void FlushAll() override {}
+    void FlushRegion(CacheAddr addr, u64 size) override {}
+    void InvalidateRegion(CacheAddr addr, u64 size) override {}
+    void FlushAndInvalidateRegion(CacheAddr addr, u64 size) override {}
+    void FlushCommands() override {}
+    void TickFrame() override {}
+};
+
+class NullWindow final : public Core::Frontend::EmuWindow {
+public:
+    void MakeCurrent() override {}
+    void DoneCurrent() override {}
+    void SwapBuffers() override {}
+    void PollEvents() override {}
+    bool IsShown() const override {
+        return false;
+    }
+    void RetrieveVulkanHandlers(void* get_instance_proc_addr, void* instance,
+                                void* surface) const override {}
+};
+
+class NullRenderer final : public VideoCore::RendererBase {
+public:
+    explicit NullRenderer(Core::Frontend::EmuWindow& window) : RendererBase{window} {
+        rasterizer = std::make_unique<NullRasterizer>();
+    }
+
+    void SwapBuffers(const Tegra::FramebufferConfig* framebuffer) override {}
+    bool Init() override {
+        return true;
+    }
+    void ShutDown() override {}
+};
+
+/// GPU that counts the command list entries pushed to it and drops them.
+class NullGpu final : public Tegra::GPU {
+public:
+    NullGpu(Core::System& system, VideoCore::RendererBase& renderer)
+        : GPU{system, renderer, false} {}
+
+    void WaitIdle() const override {}
+    void Start() override {}
+    void PushGPUEntries(Tegra::CommandList&& entries) override {
+        num_entries += entries.size();
+    }
+    void SwapBuffers(const Tegra::FramebufferConfig* framebuffer) override {}
+    void FlushRegion(CacheAddr addr, u64 size) override {}
+    void InvalidateRegion(CacheAddr addr, u64 size) override {}
+    void FlushAndInvalidateRegion(CacheAddr addr, u64 size) override {}
+
+    u64 num_entries = 0;
+
+protected:
+    void TriggerCpuInterrupt(u32 syncpoint_id, u32 value) const override {}
+};
+
+/// NVDRV with /dev/nvhost-gpu open, for a process whose buffers are mapped at GUEST_BASE.
+class NvdrvEnvironment {
+public:
+    NvdrvEnvironment()
+        : system{Core::System::GetInstance()}, renderer{window},
+          process{Kernel::Process::Create(system, "NVDRV", Kernel::Process::ProcessType::Userland)},
+          backing(NUM_PAGES * Memory::PAGE_SIZE), module{std::make_shared<Module>(system)},
+          nvdrv{module, "nvdrv"},
+          session{std::make_shared<Kernel::ServerSession>(system.Kernel())} {
+        auto null_gpu = std::make_unique<NullGpu>(system, renderer);
+        gpu = null_gpu.get();
+        system.SetGPU(std::move(null_gpu));
+
+        system.Memory().MapMemoryRegion(process->VMManager().page_table, GUEST_BASE,
+                                        backing.size(), backing.data());
+        system.Kernel().MakeCurrentProcess(process.get());
+        fd = module->Open("/dev/nvhost-gpu");
+    }
+
+    ~NvdrvEnvironment() {
+        module->Close(fd);
+        system.Kernel().MakeCurrentProcess(nullptr);
+        system.Memory().UnmapRegion(process->VMManager().page_table, GUEST_BASE, backing.size());
+        system.SetGPU(nullptr);
+    }
+
+    u8* Pointer(VAddr address) {
+        return backing.data() + (address - GUEST_BASE);
+    }
+
+    Core::System& system;
+    NullWindow window;
+    NullRenderer renderer;
+    NullGpu* gpu = nullptr;
+    std::shared_ptr<Kernel::Process> process;
+    std::vector<u8> backing;
+    std::shared_ptr<Module> module;
+    NVDRV nvdrv;
+    std::shared_ptr<Kernel::ServerSession> session;
+    u32 fd = 0;
+};
+
+struct GuestBuffer {
+    VAddr address;
+    u32 size;
+};
+
+IPC::BufferDescriptorABW MakeDescriptor(const GuestBuffer& buffer) {
+    IPC::BufferDescriptorABW descriptor{};
+    descriptor.address_bits_0_31 = static_cast<u32>(buffer.address);
+    descriptor.size_bits_0_31 = buffer.size;
+    return descriptor;
+}
+
+/// Builds the request a guest sends for an NVDRV ioctl command, with type A input buffers and
+/// type B output buffers.
+std::array<u32, IPC::COMMAND_BUFFER_LENGTH> MakeIoctlRequest(
+    u32 command_id, u32 fd, u32 command, std::initializer_list<GuestBuffer> inputs,
+    std::initializer_list<GuestBuffer> outputs) {
+    std::array<u32, IPC::COMMAND_BUFFER_LENGTH> cmd_buf{};
+    IPC::CommandHeader header{};
+    header.type.Assign(IPC::CommandType::Request);
+    header.num_buf_a_descriptors.Assign(static_cast<u32>(inputs.size()));
+    header.num_buf_b_descriptors.Assign(static_cast<u32>(outputs.size()));
+    header.data_size.Assign(16);
+    std::memcpy(cmd_buf.data(), &header, sizeof(header));
+
+    std::size_t index = sizeof(header) / sizeof(u32);
+    for (const GuestBuffer& buffer : inputs) {
+        const auto descriptor = MakeDescriptor(buffer);
+        std::memcpy(&cmd_buf[index], &descriptor, sizeof(descriptor));
+        index += sizeof(descriptor) / sizeof(u32);
+    }
+    for (const GuestBuffer& buffer : outputs) {
+        const auto descriptor = MakeDescriptor(buffer);
+        std::memcpy(&cmd_buf[index], &descriptor, sizeof(descriptor));
+        index += sizeof(descriptor) / sizeof(u32);
+    }
+
+    // The payload starts after the padding that aligns it to 16 bytes.
+    index = Common::AlignUp(index, 4);
+    cmd_buf[index] = Common::MakeMagic('S', 'F', 'C', 'I');
+    cmd_buf[index + 2] = command_id;
+    cmd_buf[index + 4] = fd;
+    cmd_buf[index + 5] = command;
+    return cmd_buf;
+}
+
+/// Handles an ioctl the way NVDRV used to, copying every buffer into a freshly allocated vector.
+void CopyingIoctl(Module& module, Kernel::HLERequestContext& ctx, IoctlVersion version) {
+    IPC::RequestParser rp{ctx};
+    const u32 fd = rp.Pop<u32>();
+    const u32 command = rp.Pop<u32>();
+
+    std::vector<u8> output(ctx.GetWriteBufferSize(0));
+    std::vector<u8> output2;
+    if (version == IoctlVersion::Version3) {
+        output2.resize(ctx.GetWriteBufferSize(1));
+    }
+    const std::vector<u8> input = ctx.ReadBuffer(0);
+    std::vector<u8> input2;
+    if (version == IoctlVersion::Version2) {
+        input2 = ctx.ReadBuffer(1);
+    }
+
+    IoctlCtrl ctrl{};
+    const u32 result = module.Ioctl(fd, command, input, input2, output, output2, ctrl, version);
+    ctx.WriteBuffer(output);
+    if (version == IoctlVersion::Version3) {
+        ctx.WriteBuffer(output2, 1);
+    }
+    IPC::ResponseBuilder rb{ctx, 3};
+    rb.Push(RESULT_SUCCESS);
+    rb.Push(result);
+}
+} // Anonymous namespace
+
+TEST_CASE("NVDRV: SubmitGPFIFO throughput", "[.][benchmark][nvdrv]") {
+    constexpr int num_iterations = 100000;
+    NvdrvEnvironment env;
+
+    // Games pass the same buffer for the parameters and their results.
+    const GuestBuffer params{GUEST_BASE, ParamsSize + EntriesSize};
+    const GuestBuffer kickoff_params{GUEST_BASE, ParamsSize};
+    const GuestBuffer entries{GUEST_BASE + Memory::PAGE_SIZE, EntriesSize};
+    const GuestBuffer output2{GUEST_BASE + 2 * Memory::PAGE_SIZE, 0x10};
+    SubmitGpfifoParams submit{};
+    submit.num_entries = NUM_ENTRIES;
+    std::memcpy(env.Pointer(GUEST_BASE), &submit, sizeof(submit));
+
+    const auto benchmark = [&](const char* name, IoctlVersion version, u32 command_id,
+                               u32 command, std::initializer_list<GuestBuffer> inputs,
+                               std::initializer_list<GuestBuffer> outputs) {
+        auto request = MakeIoctlRequest(command_id, env.fd, command, inputs, outputs);
+        Kernel::HandleTable handle_table;
+        const auto run = [&](auto&& handle) {
+            const u64 num_entries = env.gpu->num_entries;
+            const auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < num_iterations; ++i) {
+                Kernel::HLERequestContext ctx{env.session, nullptr};
+                ctx.PopulateFromIncomingCommandBuffer(handle_table, request.data());
+                handle(ctx);
+            }
+            const std::chrono::duration<double, std::nano> time =
+                std::chrono::steady_clock::now() - start;
+            REQUIRE(env.gpu->num_entries - num_entries == u64{NUM_ENTRIES} * num_iterations);
+            return time.count() / num_iterations;
+        };
+
+        // The copying path skips the service dispatch, which only adds to the current path.
+        const double copied = run([&](Kernel::HLERequestContext& ctx) {
+            CopyingIoctl(*env.module, ctx, version);
+        });
+        const double in_place =
+            run([&](Kernel::HLERequestContext& ctx) { env.nvdrv.InvokeRequest(ctx); });
+        WARN(name << ": " << copied << " ns with copied buffers, " << in_place << " ns in place");
+    };
+
+    benchmark("Ioctl SubmitGPFIFO", IoctlVersion::Version1, IoctlCommandId, SubmitGpfifoCommand,
+              {params}, {params});
+    benchmark("Ioctl2 KickoffPB", IoctlVersion::Version2, Ioctl2CommandId, KickoffPbCommand,
+              {kickoff_params, entries}, {kickoff_params});
+    benchmark("Ioctl3 SubmitGPFIFO", IoctlVersion::Version3, Ioctl3CommandId, SubmitGpfifoCommand,
+              {params}, {params, output2});
+}
+
+} // namespace Service::Nvidia
@@ -0,0 +1,141 @@
+// Copyright 2019 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <vector>
+#include <catch2/catch.hpp>
+#include "common/common_funcs.h"
+#include "common/common_types.h"
+#include "core/core.h"
+#include "core/hle/ipc.h"
+#include "core/hle/kernel/handle_table.h"
+#include "core/hle/kernel/hle_ipc.h"
+#include "core/hle/kernel/server_session.h"
+#include "core/hle/service/service.h"
+
+namespace Service {
+
+namespace {
+struct Pair {
+    u32 low;
+    u32 high;
+};
+
+struct Arguments {
+    u32 value;
+    u64 wide_value;
+    bool flag;
+    Pair pair;
+};
+
+class TestService final : public ServiceFramework<TestService> {
+public:
+    explicit TestService(const char* name) : ServiceFramework{name} {
+        // clang-format off
+        static const FunctionInfo functions[] = {
+            {0, &TestService::Ping, "Ping"},
+            {3, Unpack<&TestService::Combine>, "Combine"},
+            // Above MaxDenseCommandId, found through the binary search.
+            {5000, &TestService::Ping, "PingHigh"},
+        };
+        // clang-format on
+        RegisterHandlers(functions);
+    }
+
+    u32 num_pings = 0;
+    std::optional<Arguments> arguments;
+
+private:
+    void Ping(Kernel::HLERequestContext& ctx) {
+        ++num_pings;
+    }
+
+    void Combine(Kernel::HLERequestContext& ctx, u32 value, u64 wide_value, bool flag,
+                 Pair pair) {
+        arguments = Arguments{value, wide_value, flag, pair};
+    }
+};
+
+/// Sends a request with the given command id and normal parameters to the service.
+void Invoke(ServiceFrameworkBase& service, u32 command, const std::vector<u32>& parameters = {}) {
+    std::array<u32, IPC::COMMAND_BUFFER_LENGTH> cmd_buf{};
+    IPC::CommandHeader header{};
+    header.type.Assign(IPC::CommandType::Request);
+    header.data_size.Assign(16);
+    std::memcpy(cmd_buf.data(), &header, sizeof(header));
+    // The payload starts after the padding that aligns it to 16 bytes.
+    cmd_buf[4] = Common::MakeMagic('S', 'F', 'C', 'I');
+    cmd_buf[6] = command;
+    std::copy(parameters.begin(), parameters.end(), cmd_buf.begin() + 8);
+
+    auto& kernel = Core::System::GetInstance().Kernel();
+    Kernel::HandleTable handle_table;
+    Kernel::HLERequestContext ctx{std::make_shared<Kernel::ServerSession>(kernel), nullptr};
+    REQUIRE(ctx.PopulateFromIncomingCommandBuffer(handle_table, cmd_buf.data()).IsSuccess());
+    REQUIRE(ctx.GetCommand() == command);
+    service.InvokeRequest(ctx);
+}
+
+u64 GetCalls(const ServiceFrameworkBase& service, u32 command) {
+    for (const auto& statistics : service.GetCommandCounters()) {
+        if (statistics.command_id == command) {
+            return statistics.num_calls;
+        }
+    }
+    return 0;
+}
+} // Anonymous namespace
+
+TEST_CASE("ServiceFramework: Commands dispatch to their handlers", "[core][service]") {
+    TestService service{"test"};
+    Invoke(service, 0);
+    REQUIRE(service.num_pings == 1);
+    Invoke(service, 5000);
+    REQUIRE(service.num_pings == 2);
+    REQUIRE(GetCalls(service, 0) == 1);
+    REQUIRE(GetCalls(service, 5000) == 1);
+}
+
+TEST_CASE("ServiceFramework: Unpacked handlers read their parameters in order", "[core][service]") {
+    TestService service{"test"};
+    Invoke(service, 3, {7, 0x89ABCDEF, 0x01234567, 1, 0x11, 0x22});
+    REQUIRE(service.arguments.has_value());
+    REQUIRE(service.arguments->value == 7);
+    REQUIRE(service.arguments->wide_value == 0x0123456789ABCDEF);
+    REQUIRE(service.arguments->flag);
+    REQUIRE(service.arguments->pair.low == 0x11);
+    REQUIRE(service.arguments->pair.high == 0x22);
+    REQUIRE(service.num_pings == 0);
+}
+
+TEST_CASE("ServiceFramework: Interfaces count their own calls", "[core][service]") {
+    ResetCommandStatistics();
+    {
+        TestService first{"test:a"};
+        TestService second{"test:a"};
+        TestService other{"test:b"};
+        Invoke(first, 0);
+        Invoke(first, 0);
+        Invoke(second, 0);
+        Invoke(other, 0);
+        REQUIRE(GetCalls(first, 0) == 2);
+        REQUIRE(GetCalls(second, 0) == 1);
+        REQUIRE(GetCalls(other, 0) == 1);
+    }
+
+    // Interfaces of a service are reported together, also once they are destroyed.
+    const auto statistics = GetCommandStatistics();
+    REQUIRE(statistics.size() == 2);
+    REQUIRE(statistics[0].service_name == "test:a");
+    REQUIRE(statistics[0].command_name == "Ping");
+    REQUIRE(statistics[0].num_calls == 3);
+    REQUIRE(statistics[1].service_name == "test:b");
+    REQUIRE(statistics[1].num_calls == 1);
+}
+
+} // namespace Service
@@ -0,0 +1,128 @@
+// Copyright 2019 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <vector>
+#include <catch2/catch.hpp>
+#include "common/common_types.h"
+#include "video_core/engines/fermi_2d.h"
+
+namespace Tegra::Engines {
+
+namespace {
+using Regs = Fermi2D::Regs;
+
+constexpr u32 BYTES_PER_PIXEL = 2;
+
+Regs::Surface MakeSurface(u32 width, u32 height) {
+    Regs::Surface surface{};
+    surface.linear.Assign(1);
+    surface.width = width;
+    surface.height = height;
+    surface.pitch = width * BYTES_PER_PIXEL;
+    return surface;
+}
+
+/// Returns a linear image where each texel holds its own coordinates.
+std::vector<u8> MakeImage(const Regs::Surface& surface) {
+    std::vector<u8> image(surface.pitch * surface.height);
+    for (u32 y = 0; y < surface.height; ++y) {
+        for (u32 x = 0; x < surface.width; ++x) {
+            image[y * surface.pitch + x * BYTES_PER_PIXEL] = static_cast<u8>(x);
+            image[y * surface.pitch + x * BYTES_PER_PIXEL + 1] = static_cast<u8>(y);
+        }
+    }
+    return image;
+}
+
+Fermi2D::Config MakeConfig(Common::Rectangle<u32> src_rect, Common::Rectangle<u32> dst_rect) {
+    Fermi2D::Config config{};
+    config.operation = Fermi2D::Operation::SrcCopy;
+    config.filter = Fermi2D::Filter::PointSample;
+    config.src_rect = src_rect;
+    config.dst_rect = dst_rect;
+    return config;
+}
+
+void Blit(const Fermi2D::Config& config, const Regs::Surface& src, const std::vector<u8>& src_data,
+          const Regs::Surface& dst, std::vector<u8>& dst_data) {
+    Fermi2D::BlitPixels(config, BYTES_PER_PIXEL, src, src_data.data(), src.pitch, dst,
+                        dst_data.data(), dst.pitch);
+}
+
+/// Returns the source coordinates stored in a destination texel.
+std::pair<u32, u32> TexelAt(const Regs::Surface& surface, const std::vector<u8>& data, u32 x,
+                            u32 y) {
+    const std::size_t offset = y * surface.pitch + x * BYTES_PER_PIXEL;
+    return {data[offset], data[offset + 1]};
+}
+} // Anonymous namespace
+
+TEST_CASE("Fermi2D: Software blit copies an unscaled rectangle", "[video_core]") {
+    const Regs::Surface src = MakeSurface(16, 16);
+    Regs::Surface dst = MakeSurface(12, 12);
+    dst.pitch = 32;
+    const std::vector<u8> src_data = MakeImage(src);
+    std::vector<u8> dst_data(dst.pitch * dst.height, 0xFF);
+
+    Blit(MakeConfig({3, 5, 8, 9}, {1, 2, 6, 6}), src, src_data, dst, dst_data);
+
+    for (u32 y = 0; y < dst.height; ++y) {
+        for (u32 x = 0; x < dst.width; ++x) {
+            const bool inside = x >= 1 && x < 6 && y >= 2 && y < 6;
+            const std::pair<u32, u32> expected =
+                inside ? std::pair<u32, u32>{x + 2, y + 3} : std::pair<u32, u32>{0xFF, 0xFF};
+            REQUIRE(TexelAt(dst, dst_data, x, y) == expected);
+        }
+    }
+    // Bytes past the width in each row are left untouched.
+    REQUIRE(dst_data[3 * dst.pitch + dst.width * BYTES_PER_PIXEL] == 0xFF);
+}
+
+TEST_CASE("Fermi2D: Software blit picks the nearest texel when scaling", "[video_core]") {
+    const Regs::Surface src = MakeSurface(8, 8);
+    const Regs::Surface dst = MakeSurface(8, 8);
+    const std::vector<u8> src_data = MakeImage(src);
+    std::vector<u8> dst_data(dst.pitch * dst.height);
+
+    SECTION("Upscale") {
+        Blit(MakeConfig({2, 2, 4, 4}, {0, 0, 8, 8}), src, src_data, dst, dst_data);
+        for (u32 y = 0; y < 8; ++y) {
+            for (u32 x = 0; x < 8; ++x) {
+                REQUIRE(TexelAt(dst, dst_data, x, y) == std::pair<u32, u32>{2 + x / 4, 2 + y / 4});
+            }
+        }
+    }
+
+    SECTION("Downscale") {
+        Blit(MakeConfig({0, 0, 8, 8}, {0, 0, 4, 2}), src, src_data, dst, dst_data);
+        for (u32 y = 0; y < 2; ++y) {
+            for (u32 x = 0; x < 4; ++x) {
+                REQUIRE(TexelAt(dst, dst_data, x, y) == std::pair<u32, u32>{x * 2, y * 4});
+            }
+        }
+        REQUIRE(TexelAt(dst, dst_data, 4, 0) == std::pair<u32, u32>{0, 0});
+        REQUIRE(TexelAt(dst, dst_data, 0, 2) == std::pair<u32, u32>{0, 0});
+    }
+}
+
+TEST_CASE("Fermi2D: Software blit clips to the surface sizes", "[video_core]") {
+    const Regs::Surface src = MakeSurface(4, 4);
+    const Regs::Surface dst = MakeSurface(6, 6);
+    const std::vector<u8> src_data = MakeImage(src);
+    std::vector<u8> dst_data(dst.pitch * dst.height, 0xFF);
+
+    // The rectangles overhang both the source and the destination surfaces.
+    Blit(MakeConfig({2, 2, 6, 6}, {3, 3, 7, 7}), src, src_data, dst, dst_data);
+
+    for (u32 y = 0; y < dst.height; ++y) {
+        for (u32 x = 0; x < dst.width; ++x) {
+            const bool inside = x >= 3 && x < 5 && y >= 3 && y < 5;
+            const std::pair<u32, u32> expected =
+                inside ? std::pair<u32, u32>{x - 1, y - 1} : std::pair<u32, u32>{0xFF, 0xFF};
+            REQUIRE(TexelAt(dst, dst_data, x, y) == expected);
+        }
+    }
+}
+
+} // namespace Tegra::Engines
@@ -0,0 +1,183 @@
+// Copyright 2019 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <cstring>
+#include <vector>
+#include <catch2/catch.hpp>
+#include "common/common_types.h"
+#include "video_core/engines/maxwell_dma.h"
+#include "video_core/textures/decoders.h"
+
+namespace Tegra::Engines {
+
+namespace {
+using Regs = MaxwellDMA::Regs;
+
+// 80 elements of 4 bytes span five GOBs per row, and 48 rows span three blocks of 16 rows.
+constexpr u32 WIDTH = 80;
+constexpr u32 HEIGHT = 48;
+constexpr u32 BLOCK_HEIGHT = 1;
+constexpr u32 BYTES_PER_ELEMENT = 4;
+
+Regs::Parameters MakeParameters(u32 depth, u32 pos_x, u32 pos_y, u32 pos_z) {
+    Regs::Parameters params{};
+    params.block_height.Assign(BLOCK_HEIGHT);
+    params.size_x = WIDTH;
+    params.size_y = HEIGHT;
+    params.size_z = depth;
+    params.pos_x.Assign(pos_x);
+    params.pos_y.Assign(pos_y);
+    params.pos_z = pos_z;
+    return params;
+}
+
+std::size_t LayerSize() {
+    return Texture::CalculateSize(true, BYTES_PER_ELEMENT, WIDTH, HEIGHT, 1, BLOCK_HEIGHT, 0);
+}
+
+/// Returns a block linear surface holding a different byte pattern for each seed.
+std::vector<u8> MakeTiledSurface(u32 depth, u8 seed) {
+    std::vector<u8> surface(LayerSize() * depth);
+    for (std::size_t i = 0; i < surface.size(); ++i) {
+        surface[i] = static_cast<u8>(i * 7 + (i >> 8) * 31 + seed);
+    }
+    return surface;
+}
+
+/// Deswizzles a layer of a block linear surface with the texture decoder.
+std::vector<u8> ToLinear(std::vector<u8>& surface, u32 layer) {
+    std::vector<u8> linear(WIDTH * HEIGHT * BYTES_PER_ELEMENT);
+    Texture::CopySwizzledData(WIDTH, HEIGHT, 1, BYTES_PER_ELEMENT, BYTES_PER_ELEMENT,
+                              surface.data() + LayerSize() * layer, linear.data(), true,
+                              BLOCK_HEIGHT, 0, 1);
+    return linear;
+}
+
+/// Copies a rectangle between two linear images of the test surface size.
+void CopyRect(const std::vector<u8>& src, u32 src_x, u32 src_y, std::vector<u8>& dst, u32 dst_x,
+              u32 dst_y, u32 width, u32 height) {
+    constexpr u32 pitch = WIDTH * BYTES_PER_ELEMENT;
+    for (u32 y = 0; y < height; ++y) {
+        std::memcpy(dst.data() + (dst_y + y) * pitch + dst_x * BYTES_PER_ELEMENT,
+                    src.data() + (src_y + y) * pitch + src_x * BYTES_PER_ELEMENT,
+                    width * BYTES_PER_ELEMENT);
+    }
+}
+} // Anonymous namespace
+
+TEST_CASE("MaxwellDMA: Bytes per pixel decode the minus one fields", "[video_core]") {
+    Regs regs{};
+    regs.exec.enable_swizzle.Assign(1);
+    REQUIRE(regs.swizzle_config.SrcBytePerPixel() == 1);
+    REQUIRE(regs.swizzle_config.DstBytePerPixel() == 1);
+    REQUIRE(!regs.HasComponentRemap());
+
+    regs.swizzle_config.component_size.Assign(1);
+    regs.swizzle_config.src_num_components.Assign(3);
+    regs.swizzle_config.dst_num_components.Assign(1);
+    REQUIRE(regs.swizzle_config.SrcBytePerPixel() == 8);
+    REQUIRE(regs.swizzle_config.DstBytePerPixel() == 4);
+    REQUIRE(regs.SrcBytesPerElement() == 8);
+    REQUIRE(regs.DstBytesPerElement() == 4);
+    REQUIRE(regs.HasComponentRemap());
+}
+
+TEST_CASE("MaxwellDMA: Subrect unswizzle steps over whole rows of blocks", "[video_core]") {
+    // The rectangle starts in the second row of blocks and ends in the third one.
+    constexpr u32 pos_x = 13;
+    constexpr u32 pos_y = 21;
+    constexpr u32 width = 30;
+    constexpr u32 height = 20;
+    std::vector<u8> surface = MakeTiledSurface(1, 0);
+    const std::vector<u8> linear = ToLinear(surface, 0);
+    std::vector<u8> expected;
+    for (u32 y = pos_y; y < pos_y + height; ++y) {
+        const auto line = linear.begin() + (y * WIDTH + pos_x) * BYTES_PER_ELEMENT;
+        expected.insert(expected.end(), line, line + width * BYTES_PER_ELEMENT);
+    }
+
+    std::vector<u8> elements(width * height * BYTES_PER_ELEMENT);
+    Texture::UnswizzleSubrect(width, height, width * BYTES_PER_ELEMENT, WIDTH, BYTES_PER_ELEMENT,
+                              surface.data(), elements.data(), BLOCK_HEIGHT, pos_x, pos_y);
+    REQUIRE(elements == expected);
+}
+
+TEST_CASE("MaxwellDMA: Tiled to tiled copies", "[video_core]") {
+    constexpr u32 width = 21;
+    constexpr u32 height = 19;
+    Regs regs{};
+    regs.exec.enable_2d.Assign(1);
+    regs.x_count = width;
+    regs.y_count = height;
+    regs.src_params = MakeParameters(1, 40, 17, 0);
+    regs.dst_params = MakeParameters(2, 3, 26, 1);
+
+    std::vector<u8> src = MakeTiledSurface(1, 1);
+    std::vector<u8> dst = MakeTiledSurface(2, 2);
+    std::vector<u8> expected = ToLinear(dst, 1);
+    CopyRect(ToLinear(src, 0), 40, 17, expected, 3, 26, width, height);
+    const std::vector<u8> untouched_layer = ToLinear(dst, 0);
+
+    std::vector<u8> elements(width * height * BYTES_PER_ELEMENT);
+    MaxwellDMA::ReadTiledElements(regs, regs.src_params, BYTES_PER_ELEMENT, src.data(),
+                                  elements.data());
+    MaxwellDMA::WriteTiledElements(regs, regs.dst_params, BYTES_PER_ELEMENT, dst.data(),
+                                   elements.data());
+
+    REQUIRE(ToLinear(dst, 1) == expected);
+    REQUIRE(ToLinear(dst, 0) == untouched_layer);
+}
+
+TEST_CASE("MaxwellDMA: Component remap", "[video_core]") {
+    Regs regs{};
+    regs.exec.enable_swizzle.Assign(1);
+    regs.const0 = 0x11223344;
+    regs.const1 = 0x55667788;
+    std::vector<u8> dst;
+
+    SECTION("Byte components") {
+        regs.swizzle_config.src_num_components.Assign(3);
+        regs.swizzle_config.dst_num_components.Assign(3);
+        regs.swizzle_config.component0.Assign(Regs::ComponentMode::Src2);
+        regs.swizzle_config.component1.Assign(Regs::ComponentMode::Const0);
+        regs.swizzle_config.component2.Assign(Regs::ComponentMode::Zero);
+        regs.swizzle_config.component3.Assign(Regs::ComponentMode::Src0);
+        REQUIRE(regs.HasComponentRemap());
+
+        MaxwellDMA::RemapComponents(regs, {1, 2, 3, 4, 5, 6, 7, 8}, dst);
+        REQUIRE(dst == std::vector<u8>{3, 0x44, 0, 1, 7, 0x44, 0, 5});
+    }
+
+    SECTION("Wider destination elements") {
+        regs.swizzle_config.component_size.Assign(1);
+        regs.swizzle_config.src_num_components.Assign(1);
+        regs.swizzle_config.dst_num_components.Assign(2);
+        regs.swizzle_config.component0.Assign(Regs::ComponentMode::Src1);
+        regs.swizzle_config.component1.Assign(Regs::ComponentMode::Const1);
+        // Only two source components exist, the third one reads as zero.
+        regs.swizzle_config.component2.Assign(Regs::ComponentMode::Src3);
+        REQUIRE(regs.SrcBytesPerElement() == 4);
+        REQUIRE(regs.DstBytesPerElement() == 6);
+
+        MaxwellDMA::RemapComponents(regs, {1, 2, 3, 4}, dst);
+        REQUIRE(dst == std::vector<u8>{3, 4, 0x88, 0x77, 0, 0});
+    }
+
+    SECTION("Component counts above four are clamped") {
+        regs.swizzle_config.src_num_components.Assign(7);
+        regs.swizzle_config.dst_num_components.Assign(5);
+        regs.swizzle_config.component1.Assign(Regs::ComponentMode::Src1);
+        regs.swizzle_config.component2.Assign(Regs::ComponentMode::Src2);
+        regs.swizzle_config.component3.Assign(Regs::ComponentMode::Src3);
+        REQUIRE(regs.SrcBytesPerElement() == 4);
+        REQUIRE(regs.DstBytesPerElement() == 4);
+        REQUIRE(!regs.HasComponentRemap());
+
+        regs.swizzle_config.component0.Assign(Regs::ComponentMode::Src3);
+        MaxwellDMA::RemapComponents(regs, {1, 2, 3, 4}, dst);
+        REQUIRE(dst == std::vector<u8>{4, 2, 3, 4});
+    }
+}
+
+} // namespace Tegra::Engines
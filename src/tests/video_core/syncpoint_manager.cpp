@@ -0,0 +1,80 @@
+// Copyright 2019 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <thread>
+#include <vector>
+#include <catch2/catch.hpp>
+#include "common/common_types.h"
+#include "video_core/syncpoint_manager.h"
+
+namespace Tegra {
+
+TEST_CASE("SyncpointManager: Waits are satisfied by increments", "[video_core]") {
+    SyncpointManager manager;
+    std::vector<u32> signalled;
+
+    REQUIRE(manager.RegisterWait(1, 2, [&] { signalled.push_back(2); }));
+    REQUIRE(manager.RegisterWait(1, 1, [&] { signalled.push_back(1); }));
+    // Registering the same wait again keeps the first callback
+    REQUIRE(manager.RegisterWait(1, 1, [&] { signalled.push_back(100); }));
+
+    manager.Increment(0);
+    REQUIRE(signalled.empty());
+
+    manager.Increment(1);
+    REQUIRE(signalled == std::vector<u32>{1});
+
+    manager.Increment(1);
+    REQUIRE(signalled == std::vector<u32>{1, 2});
+    REQUIRE(manager.GetValue(1) == 2);
+
+    // Already reached thresholds are reported instead of registered
+    REQUIRE_FALSE(manager.RegisterWait(1, 2, [&] { signalled.push_back(200); }));
+    manager.Increment(1);
+    REQUIRE(signalled.size() == 2);
+
+    const auto stats = manager.GetStatistics();
+    REQUIRE(stats.num_waits == 2);
+    REQUIRE(stats.num_immediate_waits == 1);
+    REQUIRE(stats.total_wait_time >= stats.max_wait_time);
+
+    manager.ResetStatistics();
+    REQUIRE(manager.GetStatistics().num_waits == 0);
+}
+
+TEST_CASE("SyncpointManager: Waits can be cancelled", "[video_core]") {
+    SyncpointManager manager;
+    bool signalled = false;
+
+    REQUIRE(manager.RegisterWait(3, 1, [&] { signalled = true; }));
+    REQUIRE(manager.CancelWait(3, 1));
+    REQUIRE_FALSE(manager.CancelWait(3, 1));
+
+    manager.Increment(3);
+    REQUIRE_FALSE(signalled);
+    REQUIRE(manager.GetStatistics().num_cancelled_waits == 1);
+}
+
+TEST_CASE("SyncpointManager: Host waits are woken by other threads", "[video_core]") {
+    constexpr u32 num_increments = 1000;
+    SyncpointManager manager;
+    u32 num_signalled = 0;
+    for (u32 threshold = 1; threshold <= num_increments; threshold += 100) {
+        REQUIRE(manager.RegisterWait(5, threshold, [&] { ++num_signalled; }));
+    }
+
+    std::thread gpu_thread{[&] {
+        for (u32 i = 0; i < num_increments; ++i) {
+            manager.Increment(5);
+        }
+    }};
+    manager.WaitHost(5, num_increments);
+    REQUIRE(manager.GetValue(5) == num_increments);
+    gpu_thread.join();
+
+    REQUIRE(num_signalled == 10);
+    REQUIRE(manager.GetStatistics().num_waits == 10);
+}
+
+} // namespace Tegra
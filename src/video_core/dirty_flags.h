@@ -0,0 +1,78 @@
+// Copyright 2019 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include "common/common_types.h"
+
+namespace VideoCommon::Dirty {
+
+/**
+ * Flags tracking which groups of Maxwell3D state changed since a backend last consumed them.
+ * Register writes that change a value set the flags the register is mapped to, and the backends
+ * clear a flag once they have synchronized the state it covers.
+ */
+enum : u8 {
+    NullEntry = 0,
+
+    RenderTargets,
+    ColorBuffer0,
+    ColorBuffer1,
+    ColorBuffer2,
+    ColorBuffer3,
+    ColorBuffer4,
+    ColorBuffer5,
+    ColorBuffer6,
+    ColorBuffer7,
+    ZetaBuffer,
+
+    VertexFormats,
+    VertexArrays,
+    VertexArray0,
+    VertexArray31 = VertexArray0 + 31,
+    VertexInstances,
+    VertexInstance0,
+    VertexInstance31 = VertexInstance0 + 31,
+
+    Shaders,
+
+    Viewports,
+    Scissors,
+    CullMode,
+    PrimitiveRestart,
+    DepthTest,
+    StencilTest,
+    ColorMask,
+    BlendState,
+    PolygonOffset,
+    DepthBoundsValues,
+
+    // Fixed function state groups, for backends that bake them into pipeline objects
+    InputAssembly,
+    Tessellation,
+    RasterizerState,
+    DepthStencilState,
+    ColorBlending,
+
+    NumFlags,
+};
+
+/// Maps the registers of a block to a flag.
+template <typename Table>
+void FillBlock(Table& table, std::size_t begin, std::size_t num, u8 flag) {
+    const auto it = std::begin(table) + begin;
+    std::fill(it, it + num, flag);
+}
+
+/// Maps the registers of a block to two flags, using the first two tables.
+template <typename Tables>
+void FillBlock(Tables& tables, std::size_t begin, std::size_t num, u8 flag_a, u8 flag_b) {
+    FillBlock(tables[0], begin, num, flag_a);
+    FillBlock(tables[1], begin, num, flag_b);
+}
+
+} // namespace VideoCommon::Dirty
@@ -2,15 +2,19 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
+#include <cstring>
 #include "common/assert.h"
 #include "common/logging/log.h"
 #include "video_core/engines/fermi_2d.h"
 #include "video_core/memory_manager.h"
 #include "video_core/rasterizer_interface.h"
+#include "video_core/textures/decoders.h"
 
 namespace Tegra::Engines {
 
-Fermi2D::Fermi2D(VideoCore::RasterizerInterface& rasterizer) : rasterizer{rasterizer} {}
+Fermi2D::Fermi2D(VideoCore::RasterizerInterface& rasterizer, MemoryManager& memory_manager)
+    : rasterizer{rasterizer}, memory_manager{memory_manager} {}
 
 void Fermi2D::CallMethod(const GPU::MethodCall& method_call) {
     ASSERT_MSG(method_call.method < Regs::NUM_REGS,
@@ -81,9 +85,102 @@ void Fermi2D::HandleSurfaceCopy() {
     copy_config.src_rect = src_rect;
     copy_config.dst_rect = dst_rect;
 
-    if (!rasterizer.AccelerateSurfaceCopy(regs.src, regs.dst, copy_config)) {
-        UNIMPLEMENTED();
+    if (rasterizer.AccelerateSurfaceCopy(regs.src, regs.dst, copy_config)) {
+        ++statistics.accelerated_blits;
+        return;
     }
+    ++statistics.cpu_fallbacks;
+    SoftwareBlit(copy_config);
+}
+
+void Fermi2D::SoftwareBlit(const Config& config) {
+    const u32 bytes_per_pixel = RenderTargetBytesPerPixel(regs.src.format);
+    if (bytes_per_pixel != RenderTargetBytesPerPixel(regs.dst.format)) {
+        UNIMPLEMENTED_MSG("Unimplemented blit conversion from format {} to {}",
+                          static_cast<u32>(regs.src.format), static_cast<u32>(regs.dst.format));
+        return;
+    }
+    const u32 src_pitch = regs.src.linear ? regs.src.pitch : regs.src.width * bytes_per_pixel;
+    const u32 dst_pitch = regs.dst.linear ? regs.dst.pitch : regs.dst.width * bytes_per_pixel;
+    ReadSurface(regs.src, bytes_per_pixel, src_pitch, src_buffer);
+    ReadSurface(regs.dst, bytes_per_pixel, dst_pitch, dst_buffer);
+
+    BlitPixels(config, bytes_per_pixel, regs.src, src_buffer.data(), src_pitch, regs.dst,
+               dst_buffer.data(), dst_pitch);
+
+    WriteSurface(regs.dst, bytes_per_pixel, dst_pitch, dst_buffer);
+}
+
+void Fermi2D::BlitPixels(const Config& config, u32 bytes_per_pixel, const Regs::Surface& src,
+                         const u8* src_data, u32 src_pitch, const Regs::Surface& dst, u8* dst_data,
+                         u32 dst_pitch) {
+    // Linear filtering is not emulated, texels are picked from the nearest source coordinate.
+    const auto& src_rect = config.src_rect;
+    const auto& dst_rect = config.dst_rect;
+    const u32 src_width = src_rect.GetWidth();
+    const u32 src_height = src_rect.GetHeight();
+    const u32 dst_width = dst_rect.GetWidth();
+    const u32 dst_height = dst_rect.GetHeight();
+    const u32 dst_right = std::min(dst_rect.right, dst.width);
+    const u32 dst_bottom = std::min(dst_rect.bottom, dst.height);
+    for (u32 y = dst_rect.top; y < dst_bottom; ++y) {
+        const u32 src_y = src_rect.top + static_cast<u32>(static_cast<u64>(y - dst_rect.top) *
+                                                          src_height / dst_height);
+        if (src_y >= src.height) {
+            break;
+        }
+        const u8* const src_line = src_data + static_cast<std::size_t>(src_y) * src_pitch;
+        u8* const dst_line = dst_data + static_cast<std::size_t>(y) * dst_pitch;
+        for (u32 x = dst_rect.left; x < dst_right; ++x) {
+            const u32 src_x = src_rect.left + static_cast<u32>(static_cast<u64>(x - dst_rect.left) *
+                                                               src_width / dst_width);
+            if (src_x >= src.width) {
+                break;
+            }
+            std::memcpy(dst_line + x * bytes_per_pixel, src_line + src_x * bytes_per_pixel,
+                        bytes_per_pixel);
+        }
+    }
+}
+
+void Fermi2D::ReadSurface(const Regs::Surface& surface, u32 bytes_per_pixel, u32 pitch,
+                          std::vector<u8>& buffer) {
+    const std::size_t size = static_cast<std::size_t>(pitch) * surface.height;
+    if (buffer.size() < size) {
+        buffer.resize(size);
+    }
+    if (surface.linear) {
+        memory_manager.ReadBlock(surface.Address(), buffer.data(), size);
+        return;
+    }
+    const std::size_t swizzled_size =
+        Texture::CalculateSize(true, bytes_per_pixel, surface.width, surface.height, 1,
+                               surface.BlockHeight(), surface.BlockDepth());
+    if (swizzle_buffer.size() < swizzled_size) {
+        swizzle_buffer.resize(swizzled_size);
+    }
+    memory_manager.ReadBlock(surface.Address(), swizzle_buffer.data(), swizzled_size);
+    Texture::CopySwizzledData(surface.width, surface.height, 1, bytes_per_pixel, bytes_per_pixel,
+                              swizzle_buffer.data(), buffer.data(), true, surface.BlockHeight(),
+                              surface.BlockDepth(), 1);
+}
+
+void Fermi2D::WriteSurface(const Regs::Surface& surface, u32 bytes_per_pixel, u32 pitch,
+                           std::vector<u8>& buffer) {
+    if (surface.linear) {
+        memory_manager.WriteBlock(surface.Address(), buffer.data(),
+                                  static_cast<std::size_t>(pitch) * surface.height);
+        return;
+    }
+    // The swizzle buffer still holds the destination surface from ReadSurface, texels outside of
+    // the width are preserved.
+    const std::size_t swizzled_size =
+        Texture::CalculateSize(true, bytes_per_pixel, surface.width, surface.height, 1,
+                               surface.BlockHeight(), surface.BlockDepth());
+    Texture::CopySwizzledData(surface.width, surface.height, 1, bytes_per_pixel, bytes_per_pixel,
+                              swizzle_buffer.data(), buffer.data(), false,
+                              surface.BlockHeight(), surface.BlockDepth(), 1);
+    memory_manager.WriteBlock(surface.Address(), swizzle_buffer.data(), swizzled_size);
 }
 
 } // namespace Tegra::Engines
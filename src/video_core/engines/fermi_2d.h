@@ -6,6 +6,7 @@
 
 #include <array>
 #include <cstddef>
+#include <vector>
 #include "common/bit_field.h"
 #include "common/common_funcs.h"
 #include "common/common_types.h"
@@ -33,7 +34,7 @@ namespace Tegra::Engines {
 
 class Fermi2D final {
 public:
-    explicit Fermi2D(VideoCore::RasterizerInterface& rasterizer);
+    explicit Fermi2D(VideoCore::RasterizerInterface& rasterizer, MemoryManager& memory_manager);
     ~Fermi2D() = default;
 
     /// Write the value to the register identified by method.
@@ -143,12 +144,40 @@ public:
         Common::Rectangle<u32> dst_rect;
     };
 
+    struct Statistics {
+        u64 accelerated_blits = 0; ///< Blits executed by the rasterizer.
+        u64 cpu_fallbacks = 0;     ///< Blits the rasterizer rejected and were done on the CPU.
+    } statistics;
+
+    /// Copies the nearest source texel into each texel of the destination rectangle, clipped to
+    /// the surface sizes. Both buffers are linear with rows of the given pitch in bytes.
+    static void BlitPixels(const Config& config, u32 bytes_per_pixel, const Regs::Surface& src,
+                           const u8* src_data, u32 src_pitch, const Regs::Surface& dst,
+                           u8* dst_data, u32 dst_pitch);
+
 private:
     VideoCore::RasterizerInterface& rasterizer;
 
+    MemoryManager& memory_manager;
+
+    std::vector<u8> src_buffer;
+    std::vector<u8> dst_buffer;
+    std::vector<u8> swizzle_buffer;
+
     /// Performs the copy from the source surface to the destination surface as configured in the
     /// registers.
     void HandleSurfaceCopy();
+
+    /// Performs a nearest filtered blit on the CPU, used when the rasterizer can't execute it.
+    void SoftwareBlit(const Config& config);
+
+    /// Reads a surface from guest memory into a linear buffer with rows of pitch bytes.
+    void ReadSurface(const Regs::Surface& surface, u32 bytes_per_pixel, u32 pitch,
+                     std::vector<u8>& buffer);
+
+    /// Writes a linear buffer with rows of pitch bytes back to the surface in guest memory.
+    void WriteSurface(const Regs::Surface& surface, u32 bytes_per_pixel, u32 pitch,
+                      std::vector<u8>& buffer);
 };
 
 #define ASSERT_REG_POSITION(field_name, position)                                                  \
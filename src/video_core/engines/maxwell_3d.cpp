@@ -4,6 +4,7 @@
 
 #include <cinttypes>
 #include <cstring>
+#include <iterator>
 #include "common/assert.h"
 #include "core/core.h"
 #include "core/core_timing.h"
@@ -99,162 +100,142 @@ void Maxwell3D::InitializeRegisterDefaults() {
     mme_inline[MAXWELL3D_REG_INDEX(index_array.count)] = true;
 }
 
-#define DIRTY_REGS_POS(field_name) static_cast<u8>(offsetof(Maxwell3D::DirtyRegs, field_name))
-
 void Maxwell3D::InitDirtySettings() {
-    const auto set_block = [this](std::size_t start, std::size_t range, u8 position) {
-        const auto start_itr = dirty_pointers.begin() + start;
-        const auto end_itr = start_itr + range;
-        std::fill(start_itr, end_itr, position);
-    };
-    dirty.regs.fill(true);
-
-    // Init Render Targets
-    constexpr u32 registers_per_rt = sizeof(regs.rt[0]) / sizeof(u32);
-    constexpr u32 rt_start_reg = MAXWELL3D_REG_INDEX(rt);
-    constexpr u32 rt_end_reg = rt_start_reg + registers_per_rt * 8;
-    u8 rt_dirty_reg = DIRTY_REGS_POS(render_target);
-    for (u32 rt_reg = rt_start_reg; rt_reg < rt_end_reg; rt_reg += registers_per_rt) {
-        set_block(rt_reg, registers_per_rt, rt_dirty_reg);
-        ++rt_dirty_reg;
-    }
-    constexpr u32 depth_buffer_flag = DIRTY_REGS_POS(depth_buffer);
-    dirty_pointers[MAXWELL3D_REG_INDEX(zeta_enable)] = depth_buffer_flag;
-    dirty_pointers[MAXWELL3D_REG_INDEX(zeta_width)] = depth_buffer_flag;
-    dirty_pointers[MAXWELL3D_REG_INDEX(zeta_height)] = depth_buffer_flag;
-    constexpr u32 registers_in_zeta = sizeof(regs.zeta) / sizeof(u32);
-    constexpr u32 zeta_reg = MAXWELL3D_REG_INDEX(zeta);
-    set_block(zeta_reg, registers_in_zeta, depth_buffer_flag);
-
-    // Init Vertex Arrays
-    constexpr u32 vertex_array_start = MAXWELL3D_REG_INDEX(vertex_array);
-    constexpr u32 vertex_array_size = sizeof(regs.vertex_array[0]) / sizeof(u32);
-    constexpr u32 vertex_array_end = vertex_array_start + vertex_array_size * Regs::NumVertexArrays;
-    u8 va_dirty_reg = DIRTY_REGS_POS(vertex_array);
-    u8 vi_dirty_reg = DIRTY_REGS_POS(vertex_instance);
-    for (u32 vertex_reg = vertex_array_start; vertex_reg < vertex_array_end;
-         vertex_reg += vertex_array_size) {
-        set_block(vertex_reg, 3, va_dirty_reg);
-        // The divisor concerns vertex array instances
-        dirty_pointers[static_cast<std::size_t>(vertex_reg) + 3] = vi_dirty_reg;
-        ++va_dirty_reg;
-        ++vi_dirty_reg;
-    }
-    constexpr u32 vertex_limit_start = MAXWELL3D_REG_INDEX(vertex_array_limit);
-    constexpr u32 vertex_limit_size = sizeof(regs.vertex_array_limit[0]) / sizeof(u32);
-    constexpr u32 vertex_limit_end = vertex_limit_start + vertex_limit_size * Regs::NumVertexArrays;
-    va_dirty_reg = DIRTY_REGS_POS(vertex_array);
-    for (u32 vertex_reg = vertex_limit_start; vertex_reg < vertex_limit_end;
-         vertex_reg += vertex_limit_size) {
-        set_block(vertex_reg, vertex_limit_size, va_dirty_reg);
-        va_dirty_reg++;
-    }
-    constexpr u32 vertex_instance_start = MAXWELL3D_REG_INDEX(instanced_arrays);
-    constexpr u32 vertex_instance_size =
-        sizeof(regs.instanced_arrays.is_instanced[0]) / sizeof(u32);
-    constexpr u32 vertex_instance_end =
-        vertex_instance_start + vertex_instance_size * Regs::NumVertexArrays;
-    vi_dirty_reg = DIRTY_REGS_POS(vertex_instance);
-    for (u32 vertex_reg = vertex_instance_start; vertex_reg < vertex_instance_end;
-         vertex_reg += vertex_instance_size) {
-        set_block(vertex_reg, vertex_instance_size, vi_dirty_reg);
-        vi_dirty_reg++;
-    }
-    set_block(MAXWELL3D_REG_INDEX(vertex_attrib_format), regs.vertex_attrib_format.size(),
-              DIRTY_REGS_POS(vertex_attrib_format));
-
-    // Init Shaders
-    constexpr u32 shader_registers_count =
-        sizeof(regs.shader_config[0]) * Regs::MaxShaderProgram / sizeof(u32);
-    set_block(MAXWELL3D_REG_INDEX(shader_config[0]), shader_registers_count,
-              DIRTY_REGS_POS(shaders));
-
-    // State
-
-    // Viewport
-    constexpr u8 viewport_dirty_reg = DIRTY_REGS_POS(viewport);
-    constexpr u32 viewport_start = MAXWELL3D_REG_INDEX(viewports);
-    constexpr u32 viewport_size = sizeof(regs.viewports) / sizeof(u32);
-    set_block(viewport_start, viewport_size, viewport_dirty_reg);
-    constexpr u32 view_volume_start = MAXWELL3D_REG_INDEX(view_volume_clip_control);
-    constexpr u32 view_volume_size = sizeof(regs.view_volume_clip_control) / sizeof(u32);
-    set_block(view_volume_start, view_volume_size, viewport_dirty_reg);
-
-    // Viewport transformation
-    constexpr u32 viewport_trans_start = MAXWELL3D_REG_INDEX(viewport_transform);
-    constexpr u32 viewport_trans_size = sizeof(regs.viewport_transform) / sizeof(u32);
-    set_block(viewport_trans_start, viewport_trans_size, DIRTY_REGS_POS(viewport_transform));
-
-    // Cullmode
-    constexpr u32 cull_mode_start = MAXWELL3D_REG_INDEX(cull);
-    constexpr u32 cull_mode_size = sizeof(regs.cull) / sizeof(u32);
-    set_block(cull_mode_start, cull_mode_size, DIRTY_REGS_POS(cull_mode));
-
-    // Screen y control
-    dirty_pointers[MAXWELL3D_REG_INDEX(screen_y_control)] = DIRTY_REGS_POS(screen_y_control);
-
-    // Primitive Restart
-    constexpr u32 primitive_restart_start = MAXWELL3D_REG_INDEX(primitive_restart);
-    constexpr u32 primitive_restart_size = sizeof(regs.primitive_restart) / sizeof(u32);
-    set_block(primitive_restart_start, primitive_restart_size, DIRTY_REGS_POS(primitive_restart));
-
-    // Depth Test
-    constexpr u8 depth_test_dirty_reg = DIRTY_REGS_POS(depth_test);
-    dirty_pointers[MAXWELL3D_REG_INDEX(depth_test_enable)] = depth_test_dirty_reg;
-    dirty_pointers[MAXWELL3D_REG_INDEX(depth_write_enabled)] = depth_test_dirty_reg;
-    dirty_pointers[MAXWELL3D_REG_INDEX(depth_test_func)] = depth_test_dirty_reg;
-
-    // Stencil Test
-    constexpr u32 stencil_test_dirty_reg = DIRTY_REGS_POS(stencil_test);
-    dirty_pointers[MAXWELL3D_REG_INDEX(stencil_enable)] = stencil_test_dirty_reg;
-    dirty_pointers[MAXWELL3D_REG_INDEX(stencil_front_func_func)] = stencil_test_dirty_reg;
-    dirty_pointers[MAXWELL3D_REG_INDEX(stencil_front_func_ref)] = stencil_test_dirty_reg;
-    dirty_pointers[MAXWELL3D_REG_INDEX(stencil_front_func_mask)] = stencil_test_dirty_reg;
-    dirty_pointers[MAXWELL3D_REG_INDEX(stencil_front_op_fail)] = stencil_test_dirty_reg;
-    dirty_pointers[MAXWELL3D_REG_INDEX(stencil_front_op_zfail)] = stencil_test_dirty_reg;
-    dirty_pointers[MAXWELL3D_REG_INDEX(stencil_front_op_zpass)] = stencil_test_dirty_reg;
-    dirty_pointers[MAXWELL3D_REG_INDEX(stencil_front_mask)] = stencil_test_dirty_reg;
-    dirty_pointers[MAXWELL3D_REG_INDEX(stencil_two_side_enable)] = stencil_test_dirty_reg;
-    dirty_pointers[MAXWELL3D_REG_INDEX(stencil_back_func_func)] = stencil_test_dirty_reg;
-    dirty_pointers[MAXWELL3D_REG_INDEX(stencil_back_func_ref)] = stencil_test_dirty_reg;
-    dirty_pointers[MAXWELL3D_REG_INDEX(stencil_back_func_mask)] = stencil_test_dirty_reg;
-    dirty_pointers[MAXWELL3D_REG_INDEX(stencil_back_op_fail)] = stencil_test_dirty_reg;
-    dirty_pointers[MAXWELL3D_REG_INDEX(stencil_back_op_zfail)] = stencil_test_dirty_reg;
-    dirty_pointers[MAXWELL3D_REG_INDEX(stencil_back_op_zpass)] = stencil_test_dirty_reg;
-    dirty_pointers[MAXWELL3D_REG_INDEX(stencil_back_mask)] = stencil_test_dirty_reg;
-
-    // Color Mask
-    constexpr u8 color_mask_dirty_reg = DIRTY_REGS_POS(color_mask);
-    dirty_pointers[MAXWELL3D_REG_INDEX(color_mask_common)] = color_mask_dirty_reg;
-    set_block(MAXWELL3D_REG_INDEX(color_mask), sizeof(regs.color_mask) / sizeof(u32),
-              color_mask_dirty_reg);
-    // Blend State
-    constexpr u8 blend_state_dirty_reg = DIRTY_REGS_POS(blend_state);
-    set_block(MAXWELL3D_REG_INDEX(blend_color), sizeof(regs.blend_color) / sizeof(u32),
-              blend_state_dirty_reg);
-    dirty_pointers[MAXWELL3D_REG_INDEX(independent_blend_enable)] = blend_state_dirty_reg;
-    set_block(MAXWELL3D_REG_INDEX(blend), sizeof(regs.blend) / sizeof(u32), blend_state_dirty_reg);
-    set_block(MAXWELL3D_REG_INDEX(independent_blend), sizeof(regs.independent_blend) / sizeof(u32),
-              blend_state_dirty_reg);
-
-    // Scissor State
-    constexpr u8 scissor_test_dirty_reg = DIRTY_REGS_POS(scissor_test);
-    set_block(MAXWELL3D_REG_INDEX(scissor_test), sizeof(regs.scissor_test) / sizeof(u32),
-              scissor_test_dirty_reg);
-
-    // Polygon Offset
-    constexpr u8 polygon_offset_dirty_reg = DIRTY_REGS_POS(polygon_offset);
-    dirty_pointers[MAXWELL3D_REG_INDEX(polygon_offset_fill_enable)] = polygon_offset_dirty_reg;
-    dirty_pointers[MAXWELL3D_REG_INDEX(polygon_offset_line_enable)] = polygon_offset_dirty_reg;
-    dirty_pointers[MAXWELL3D_REG_INDEX(polygon_offset_point_enable)] = polygon_offset_dirty_reg;
-    dirty_pointers[MAXWELL3D_REG_INDEX(polygon_offset_units)] = polygon_offset_dirty_reg;
-    dirty_pointers[MAXWELL3D_REG_INDEX(polygon_offset_factor)] = polygon_offset_dirty_reg;
-    dirty_pointers[MAXWELL3D_REG_INDEX(polygon_offset_clamp)] = polygon_offset_dirty_reg;
-
-    // Depth bounds
-    constexpr u8 depth_bounds_values_dirty_reg = DIRTY_REGS_POS(depth_bounds_values);
-    dirty_pointers[MAXWELL3D_REG_INDEX(depth_bounds[0])] = depth_bounds_values_dirty_reg;
-    dirty_pointers[MAXWELL3D_REG_INDEX(depth_bounds[1])] = depth_bounds_values_dirty_reg;
+    using namespace VideoCommon::Dirty;
+    auto& tables = dirty.tables;
+    constexpr auto size_in_regs = [](std::size_t size) { return size / sizeof(u32); };
+
+    // Render targets
+    constexpr std::size_t rt_size = size_in_regs(sizeof(regs.rt[0]));
+    for (std::size_t rt = 0; rt < Regs::NumRenderTargets; ++rt) {
+        FillBlock(tables, MAXWELL3D_REG_INDEX(rt) + rt * rt_size, rt_size,
+                  static_cast<u8>(ColorBuffer0 + rt), RenderTargets);
+    }
+    FillBlock(tables[0], MAXWELL3D_REG_INDEX(rt_control), size_in_regs(sizeof(regs.rt_control)),
+              RenderTargets);
+    FillBlock(tables[1], MAXWELL3D_REG_INDEX(rt_control), size_in_regs(sizeof(regs.rt_control)),
+              ColorBlending);
+    tables[0][MAXWELL3D_REG_INDEX(framebuffer_srgb)] = RenderTargets;
+    FillBlock(tables, MAXWELL3D_REG_INDEX(zeta), size_in_regs(sizeof(regs.zeta)), ZetaBuffer,
+              RenderTargets);
+    for (const std::size_t reg : {MAXWELL3D_REG_INDEX(zeta_enable), MAXWELL3D_REG_INDEX(zeta_width),
+                                  MAXWELL3D_REG_INDEX(zeta_height)}) {
+        FillBlock(tables, reg, 1, ZetaBuffer, RenderTargets);
+    }
+
+    // Vertex arrays, the divisor register is part of the instancing state
+    constexpr std::size_t array_size = size_in_regs(sizeof(regs.vertex_array[0]));
+    constexpr std::size_t limit_size = size_in_regs(sizeof(regs.vertex_array_limit[0]));
+    constexpr std::size_t instance_size =
+        size_in_regs(sizeof(regs.instanced_arrays.is_instanced[0]));
+    for (std::size_t index = 0; index < Regs::NumVertexArrays; ++index) {
+        const auto array_flag = static_cast<u8>(VertexArray0 + index);
+        const auto instance_flag = static_cast<u8>(VertexInstance0 + index);
+        const std::size_t array_reg = MAXWELL3D_REG_INDEX(vertex_array) + index * array_size;
+        FillBlock(tables, array_reg, 3, array_flag, VertexArrays);
+        FillBlock(tables, array_reg + 3, 1, instance_flag, VertexInstances);
+        FillBlock(tables, MAXWELL3D_REG_INDEX(vertex_array_limit) + index * limit_size, limit_size,
+                  array_flag, VertexArrays);
+        FillBlock(tables, MAXWELL3D_REG_INDEX(instanced_arrays) + index * instance_size,
+                  instance_size, instance_flag, VertexInstances);
+    }
+    FillBlock(tables[0], MAXWELL3D_REG_INDEX(vertex_attrib_format),
+              regs.vertex_attrib_format.size(), VertexFormats);
+
+    // Shaders, enabling geometry shaders changes the number of viewports in use
+    FillBlock(tables[0], MAXWELL3D_REG_INDEX(shader_config),
+              size_in_regs(sizeof(regs.shader_config)), Shaders);
+    constexpr auto geometry_index = static_cast<std::size_t>(Regs::ShaderProgram::Geometry);
+    tables[1][MAXWELL3D_REG_INDEX(shader_config[geometry_index])] = Viewports;
+    tables[2][MAXWELL3D_REG_INDEX(shader_config[geometry_index])] = Scissors;
+
+    // Viewports
+    FillBlock(tables[0], MAXWELL3D_REG_INDEX(viewports), size_in_regs(sizeof(regs.viewports)),
+              Viewports);
+    FillBlock(tables[0], MAXWELL3D_REG_INDEX(view_volume_clip_control),
+              size_in_regs(sizeof(regs.view_volume_clip_control)), Viewports);
+    FillBlock(tables, MAXWELL3D_REG_INDEX(viewport_transform),
+              size_in_regs(sizeof(regs.viewport_transform)), Viewports, RasterizerState);
+    FillBlock(tables, MAXWELL3D_REG_INDEX(screen_y_control), 1, Viewports, RasterizerState);
+    FillBlock(tables, MAXWELL3D_REG_INDEX(depth_mode), 1, Viewports, RasterizerState);
+    FillBlock(tables[0], MAXWELL3D_REG_INDEX(scissor_test), size_in_regs(sizeof(regs.scissor_test)),
+              Scissors);
+
+    // Rasterizer
+    FillBlock(tables, MAXWELL3D_REG_INDEX(cull), size_in_regs(sizeof(regs.cull)), CullMode,
+              RasterizerState);
+    for (const std::size_t reg : {MAXWELL3D_REG_INDEX(polygon_offset_point_enable),
+                                  MAXWELL3D_REG_INDEX(polygon_offset_line_enable),
+                                  MAXWELL3D_REG_INDEX(polygon_offset_fill_enable)}) {
+        FillBlock(tables, reg, 1, PolygonOffset, RasterizerState);
+    }
+    for (const std::size_t reg : {MAXWELL3D_REG_INDEX(polygon_offset_units),
+                                  MAXWELL3D_REG_INDEX(polygon_offset_factor),
+                                  MAXWELL3D_REG_INDEX(polygon_offset_clamp)}) {
+        tables[0][reg] = PolygonOffset;
+    }
+
+    // Input assembly and tessellation
+    FillBlock(tables, MAXWELL3D_REG_INDEX(draw.vertex_begin_gl), 1, InputAssembly,
+              RasterizerState);
+    FillBlock(tables, MAXWELL3D_REG_INDEX(primitive_restart),
+              size_in_regs(sizeof(regs.primitive_restart)), PrimitiveRestart, InputAssembly);
+    tables[0][MAXWELL3D_REG_INDEX(point_size)] = InputAssembly;
+    tables[0][MAXWELL3D_REG_INDEX(patch_vertices)] = Tessellation;
+    tables[0][MAXWELL3D_REG_INDEX(tess_mode)] = Tessellation;
+
+    // Depth and stencil
+    for (const std::size_t reg :
+         {MAXWELL3D_REG_INDEX(depth_test_enable), MAXWELL3D_REG_INDEX(depth_write_enabled),
+          MAXWELL3D_REG_INDEX(depth_test_func)}) {
+        FillBlock(tables, reg, 1, DepthTest, DepthStencilState);
+    }
+    tables[1][MAXWELL3D_REG_INDEX(depth_bounds_enable)] = DepthStencilState;
+    FillBlock(tables[0], MAXWELL3D_REG_INDEX(depth_bounds), std::size(regs.depth_bounds),
+              DepthBoundsValues);
+    for (const std::size_t reg :
+         {MAXWELL3D_REG_INDEX(stencil_enable), MAXWELL3D_REG_INDEX(stencil_two_side_enable),
+          MAXWELL3D_REG_INDEX(stencil_front_func_func), MAXWELL3D_REG_INDEX(stencil_front_op_fail),
+          MAXWELL3D_REG_INDEX(stencil_front_op_zfail), MAXWELL3D_REG_INDEX(stencil_front_op_zpass),
+          MAXWELL3D_REG_INDEX(stencil_back_func_func), MAXWELL3D_REG_INDEX(stencil_back_op_fail),
+          MAXWELL3D_REG_INDEX(stencil_back_op_zfail), MAXWELL3D_REG_INDEX(stencil_back_op_zpass)}) {
+        FillBlock(tables, reg, 1, StencilTest, DepthStencilState);
+    }
+    // References and masks are dynamic state, they don't change the depth stencil state
+    for (const std::size_t reg :
+         {MAXWELL3D_REG_INDEX(stencil_front_func_ref), MAXWELL3D_REG_INDEX(stencil_front_func_mask),
+          MAXWELL3D_REG_INDEX(stencil_front_mask), MAXWELL3D_REG_INDEX(stencil_back_func_ref),
+          MAXWELL3D_REG_INDEX(stencil_back_func_mask), MAXWELL3D_REG_INDEX(stencil_back_mask)}) {
+        tables[0][reg] = StencilTest;
+    }
+
+    // Blending, the color mask count depends on whether blending is independent
+    FillBlock(tables, MAXWELL3D_REG_INDEX(color_mask_common), 1, ColorMask, ColorBlending);
+    FillBlock(tables, MAXWELL3D_REG_INDEX(color_mask), size_in_regs(sizeof(regs.color_mask)),
+              ColorMask, ColorBlending);
+    FillBlock(tables[0], MAXWELL3D_REG_INDEX(blend_color), size_in_regs(sizeof(regs.blend_color)),
+              BlendState);
+    FillBlock(tables, MAXWELL3D_REG_INDEX(independent_blend_enable), 1, BlendState,
+              ColorBlending);
+    tables[2][MAXWELL3D_REG_INDEX(independent_blend_enable)] = ColorMask;
+    FillBlock(tables, MAXWELL3D_REG_INDEX(blend), size_in_regs(sizeof(regs.blend)), BlendState,
+              ColorBlending);
+    FillBlock(tables, MAXWELL3D_REG_INDEX(independent_blend),
+              size_in_regs(sizeof(regs.independent_blend)), BlendState, ColorBlending);
+
+    // Shaders, render targets and vertex buffers may be backed by memory the GPU wrote to
+    dirty.on_memory_write[Shaders] = true;
+    dirty.on_memory_write[RenderTargets] = true;
+    dirty.on_memory_write[ZetaBuffer] = true;
+    dirty.on_memory_write[VertexArrays] = true;
+    for (std::size_t rt = 0; rt < Regs::NumRenderTargets; ++rt) {
+        dirty.on_memory_write[ColorBuffer0 + rt] = true;
+    }
+    for (std::size_t index = 0; index < Regs::NumVertexArrays; ++index) {
+        dirty.on_memory_write[VertexArray0 + index] = true;
+    }
+
+    dirty.flags.set();
 }
 
 void Maxwell3D::CallMacroMethod(u32 method, std::size_t num_parameters, const u32* parameters) {
@@ -319,23 +300,7 @@ void Maxwell3D::CallMethod(const GPU::MethodCall& method_call) {
         debug_context->OnEvent(Tegra::DebugContext::Event::MaxwellCommandLoaded, nullptr);
     }
 
-    if (regs.reg_array[method] != method_call.argument) {
-        regs.reg_array[method] = method_call.argument;
-        const std::size_t dirty_reg = dirty_pointers[method];
-        if (dirty_reg) {
-            dirty.regs[dirty_reg] = true;
-            if (dirty_reg >= DIRTY_REGS_POS(vertex_array) &&
-                dirty_reg < DIRTY_REGS_POS(vertex_array_buffers)) {
-                dirty.vertex_array_buffers = true;
-            } else if (dirty_reg >= DIRTY_REGS_POS(vertex_instance) &&
-                       dirty_reg < DIRTY_REGS_POS(vertex_instances)) {
-                dirty.vertex_instances = true;
-            } else if (dirty_reg >= DIRTY_REGS_POS(render_target) &&
-                       dirty_reg < DIRTY_REGS_POS(render_settings)) {
-                dirty.render_settings = true;
-            }
-        }
-    }
+    WriteRegister(method, method_call.argument);
 
     switch (method) {
     case MAXWELL3D_REG_INDEX(macros.data): {
@@ -454,10 +419,22 @@ void Maxwell3D::StepInstance(const MMEDrawMode expected_mode, const u32 count) {
     StepInstance(expected_mode, count);
 }
 
+void Maxwell3D::WriteRegister(u32 method, u32 value) {
+    if (regs.reg_array[method] == value) {
+        ++dirty.statistics.redundant_writes;
+        return;
+    }
+    regs.reg_array[method] = value;
+    for (const auto& table : dirty.tables) {
+        dirty.flags[table[method]] = true;
+    }
+    ++dirty.statistics.state_changes;
+}
+
 void Maxwell3D::CallMethodFromMME(const GPU::MethodCall& method_call) {
     const u32 method = method_call.method;
     if (mme_inline[method]) {
-        regs.reg_array[method] = method_call.argument;
+        WriteRegister(method, method_call.argument);
         if (method == MAXWELL3D_REG_INDEX(vertex_buffer.count) ||
             method == MAXWELL3D_REG_INDEX(index_array.count)) {
             const MMEDrawMode expected_mode = method == MAXWELL3D_REG_INDEX(vertex_buffer.count)
@@ -498,6 +475,7 @@ void Maxwell3D::FlushMMEInlineDraw() {
     const bool is_indexed = mme_draw.current_mode == MMEDrawMode::Indexed;
     if (ShouldExecute()) {
         rasterizer.DrawMultiBatch(is_indexed);
+        ++dirty.statistics.draws;
     }
 
     if (debug_context) {
@@ -671,6 +649,7 @@ void Maxwell3D::DrawArrays() {
     const bool is_indexed{regs.index_array.count && !regs.vertex_buffer.count};
     if (ShouldExecute()) {
         rasterizer.DrawBatch(is_indexed);
+        ++dirty.statistics.draws;
     }
 
     if (debug_context) {
@@ -15,6 +15,7 @@
 #include "common/common_funcs.h"
 #include "common/common_types.h"
 #include "common/math_util.h"
+#include "video_core/dirty_flags.h"
 #include "video_core/engines/const_buffer_engine_interface.h"
 #include "video_core/engines/const_buffer_info.h"
 #include "video_core/engines/engine_upload.h"
@@ -1194,80 +1195,57 @@ public:
 
     State state{};
 
-    struct DirtyRegs {
-        static constexpr std::size_t NUM_REGS = 256;
-        static_assert(NUM_REGS - 1 <= std::numeric_limits<u8>::max());
-
-        union {
-            struct {
-                bool null_dirty;
-
-                // Vertex Attributes
-                bool vertex_attrib_format;
-
-                // Vertex Arrays
-                std::array<bool, 32> vertex_array;
-
-                bool vertex_array_buffers;
-
-                // Vertex Instances
-                std::array<bool, 32> vertex_instance;
-
-                bool vertex_instances;
-
-                // Render Targets
-                std::array<bool, 8> render_target;
-                bool depth_buffer;
-
-                bool render_settings;
-
-                // Shaders
-                bool shaders;
-
-                // Rasterizer State
-                bool viewport;
-                bool clip_coefficient;
-                bool cull_mode;
-                bool primitive_restart;
-                bool depth_test;
-                bool stencil_test;
-                bool blend_state;
-                bool scissor_test;
-                bool transform_feedback;
-                bool color_mask;
-                bool polygon_offset;
-                bool depth_bounds_values;
-
-                // Complementary
-                bool viewport_transform;
-                bool screen_y_control;
-
-                bool memory_general;
-            };
-            std::array<bool, NUM_REGS> regs;
+    struct DirtyState {
+        using Flags = std::bitset<VideoCommon::Dirty::NumFlags>;
+        using Table = std::array<u8, Regs::NUM_REGS>;
+        using Tables = std::array<Table, 3>;
+
+        /// Counters of how much state the guest changed and how much of it was synchronized.
+        struct Statistics {
+            u64 state_changes;    ///< Register writes that changed the value of the register
+            u64 redundant_writes; ///< Register writes that left the register value as it was
+            u64 synced_groups;    ///< Flagged state groups synchronized by the rasterizer
+            u64 draws;            ///< Draw calls
         };
 
-        void ResetVertexArrays() {
-            vertex_array.fill(true);
-            vertex_array_buffers = true;
+        /// Returns whether a flag is set and clears it, counting the group as synchronized.
+        bool Consume(u8 flag) {
+            if (!flags[flag]) {
+                return false;
+            }
+            flags[flag] = false;
+            ++statistics.synced_groups;
+            return true;
         }
 
-        void ResetRenderTargets() {
-            depth_buffer = true;
-            render_target.fill(true);
-            render_settings = true;
+        /// Flags every vertex array, e.g. after their host bindings were lost.
+        void ResetVertexArrays() {
+            flags[VideoCommon::Dirty::VertexArrays] = true;
+            for (std::size_t index = 0; index < Regs::NumVertexArrays; ++index) {
+                flags[VideoCommon::Dirty::VertexArray0 + index] = true;
+            }
         }
 
+        /// Flags the state that may be stale after the GPU wrote to memory.
         void OnMemoryWrite() {
-            shaders = true;
-            memory_general = true;
-            ResetRenderTargets();
-            ResetVertexArrays();
+            flags |= on_memory_write;
+        }
+
+        /// Finishes the counters of the current frame and starts the ones of the next frame.
+        void EndFrame() {
+            last_frame_statistics = statistics;
+            statistics = {};
         }
 
-    } dirty{};
+        Flags flags;
+        Flags on_memory_write;
 
-    std::array<u8, Regs::NUM_REGS> dirty_pointers{};
+        /// Flags set by writes to each register, every register maps to one flag per table.
+        Tables tables{};
+
+        Statistics statistics{};
+        Statistics last_frame_statistics{};
+    } dirty;
 
     /// Reads a register value located at the input method address
     u32 GetRegisterValue(u32 method) const;
@@ -1371,6 +1349,9 @@ private:
 
     void InitDirtySettings();
 
+    /// Writes a register, flagging the state it belongs to when its value changes.
+    void WriteRegister(u32 method, u32 value);
+
     /**
      * Pass a macro on this engine.
      * @param method Method to call
@@ -2,6 +2,11 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <utility>
+
 #include "common/assert.h"
 #include "common/logging/log.h"
 #include "core/core.h"
@@ -9,13 +14,50 @@
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/engines/maxwell_dma.h"
 #include "video_core/memory_manager.h"
+#include "video_core/rasterizer_interface.h"
 #include "video_core/renderer_base.h"
 #include "video_core/textures/decoders.h"
 
 namespace Tegra::Engines {
 
-MaxwellDMA::MaxwellDMA(Core::System& system, MemoryManager& memory_manager)
-    : system{system}, memory_manager{memory_manager} {}
+MaxwellDMA::MaxwellDMA(Core::System& system, VideoCore::RasterizerInterface& rasterizer,
+                       MemoryManager& memory_manager)
+    : system{system}, rasterizer{rasterizer}, memory_manager{memory_manager} {}
+
+u32 MaxwellDMA::Regs::SrcBytesPerElement() const {
+    if (exec.enable_swizzle) {
+        return swizzle_config.SrcBytePerPixel();
+    }
+    // Without the swizzle unit the element size isn't configured. Guess it from the pitch of the
+    // linear side, copies between two linear or two block linear buffers are done in bytes.
+    if (x_count == 0 || exec.is_src_linear == exec.is_dst_linear) {
+        return 1;
+    }
+    return std::max(1U, (exec.is_src_linear ? src_pitch : dst_pitch) / x_count);
+}
+
+u32 MaxwellDMA::Regs::DstBytesPerElement() const {
+    return exec.enable_swizzle ? swizzle_config.DstBytePerPixel() : SrcBytesPerElement();
+}
+
+bool MaxwellDMA::Regs::HasComponentRemap() const {
+    if (!exec.enable_swizzle) {
+        return false;
+    }
+    if (swizzle_config.SrcNumComponents() != swizzle_config.DstNumComponents()) {
+        return true;
+    }
+    const std::array components{swizzle_config.component0.Value(),
+                                swizzle_config.component1.Value(),
+                                swizzle_config.component2.Value(),
+                                swizzle_config.component3.Value()};
+    for (u32 i = 0; i < swizzle_config.DstNumComponents(); ++i) {
+        if (components[i] != static_cast<ComponentMode>(i)) {
+            return true;
+        }
+    }
+    return false;
+}
 
 void MaxwellDMA::CallMethod(const GPU::MethodCall& method_call) {
     ASSERT_MSG(method_call.method < Regs::NUM_REGS,
@@ -43,23 +85,16 @@ void MaxwellDMA::HandleCopy() {
     const GPUVAddr dest = regs.dst_address.Address();
 
     // TODO(Subv): Perform more research and implement all features of this engine.
-    ASSERT(regs.exec.enable_swizzle == 0);
     ASSERT(regs.exec.query_mode == Regs::QueryMode::None);
     ASSERT(regs.exec.query_intr == Regs::QueryIntr::None);
     ASSERT(regs.exec.copy_mode == Regs::CopyMode::Unk2);
-    ASSERT(regs.dst_params.pos_x == 0);
-    ASSERT(regs.dst_params.pos_y == 0);
-
-    if (!regs.exec.is_dst_linear && !regs.exec.is_src_linear) {
-        // If both the source and the destination are in block layout, assert.
-        UNREACHABLE_MSG("Tiled->Tiled DMA transfers are not yet implemented");
-        return;
-    }
 
     // All copies here update the main memory, so mark all rasterizer states as invalid.
     system.GPU().Maxwell3D().dirty.OnMemoryWrite();
 
-    if (regs.exec.is_dst_linear && regs.exec.is_src_linear) {
+    const bool is_src_linear = regs.exec.is_src_linear != 0;
+    const bool is_dst_linear = regs.exec.is_dst_linear != 0;
+    if (is_src_linear && is_dst_linear && !regs.exec.enable_swizzle) {
         // When the enable_2d bit is disabled, the copy is performed as if we were copying a 1D
         // buffer of length `x_count`, otherwise we copy a 2D image of dimensions (x_count,
         // y_count).
@@ -80,78 +115,179 @@ void MaxwellDMA::HandleCopy() {
         return;
     }
 
-    ASSERT(regs.exec.enable_2d == 1);
+    const bool has_component_remap = regs.HasComponentRemap();
 
-    if (regs.exec.is_dst_linear && !regs.exec.is_src_linear) {
-        ASSERT(regs.src_params.BlockDepth() == 0);
-        // If the input is tiled and the output is linear, deswizzle the input and copy it over.
-        const u32 bytes_per_pixel = regs.dst_pitch / regs.x_count;
-        const std::size_t src_size = Texture::CalculateSize(
-            true, bytes_per_pixel, regs.src_params.size_x, regs.src_params.size_y,
-            regs.src_params.size_z, regs.src_params.BlockHeight(), regs.src_params.BlockDepth());
-
-        const std::size_t src_layer_size = Texture::CalculateSize(
-            true, bytes_per_pixel, regs.src_params.size_x, regs.src_params.size_y, 1,
-            regs.src_params.BlockHeight(), regs.src_params.BlockDepth());
+    // Copies from or to block linear surfaces that are resident in the rasterizer caches are done
+    // on the host GPU. This avoids flushing the surfaces to guest memory to swizzle on the CPU.
+    if ((!is_src_linear || !is_dst_linear) && !has_component_remap &&
+        rasterizer.AccelerateDMA(regs)) {
+        return;
+    }
 
-        const std::size_t dst_size = regs.dst_pitch * regs.y_count;
+    ReadSourceElements();
+    if (has_component_remap) {
+        RemapComponents(regs, element_buffer, read_buffer);
+        std::swap(element_buffer, read_buffer);
+    }
+    WriteDestinationElements();
+}
 
-        if (read_buffer.size() < src_size) {
-            read_buffer.resize(src_size);
+void MaxwellDMA::ReadSourceElements() {
+    const GPUVAddr source = regs.src_address.Address();
+    const u32 bytes_per_element = regs.SrcBytesPerElement();
+    const u32 num_lines = regs.exec.enable_2d ? regs.y_count : 1;
+    const std::size_t line_size = static_cast<std::size_t>(regs.x_count) * bytes_per_element;
+    element_buffer.resize(line_size * num_lines);
+
+    if (regs.exec.is_src_linear) {
+        const auto read_block = [this](GPUVAddr address, u8* data, std::size_t size) {
+            if (Settings::values.use_accurate_gpu_emulation) {
+                memory_manager.ReadBlock(address, data, size);
+            } else {
+                memory_manager.ReadBlockUnsafe(address, data, size);
+            }
+        };
+        if (num_lines == 1 || regs.src_pitch == line_size) {
+            read_block(source, element_buffer.data(), element_buffer.size());
+            return;
         }
-
-        if (write_buffer.size() < dst_size) {
-            write_buffer.resize(dst_size);
+        for (u32 line = 0; line < num_lines; ++line) {
+            read_block(source + line * regs.src_pitch, element_buffer.data() + line * line_size,
+                       line_size);
         }
+        return;
+    }
 
-        memory_manager.ReadBlock(source, read_buffer.data(), src_size);
-        memory_manager.ReadBlock(dest, write_buffer.data(), dst_size);
+    ASSERT(regs.exec.enable_2d == 1);
 
-        Texture::UnswizzleSubrect(
-            regs.x_count, regs.y_count, regs.dst_pitch, regs.src_params.size_x, bytes_per_pixel,
-            read_buffer.data() + src_layer_size * regs.src_params.pos_z, write_buffer.data(),
-            regs.src_params.BlockHeight(), regs.src_params.pos_x, regs.src_params.pos_y);
+    const auto& params = regs.src_params;
+    ASSERT(params.BlockDepth() == 0);
 
-        memory_manager.WriteBlock(dest, write_buffer.data(), dst_size);
-    } else {
-        ASSERT(regs.dst_params.BlockDepth() == 0);
+    // If the input is tiled, deswizzle the requested rectangle out of it.
+    const std::size_t src_size =
+        Texture::CalculateSize(true, bytes_per_element, params.size_x, params.size_y,
+                               params.size_z, params.BlockHeight(), params.BlockDepth());
 
-        const u32 bytes_per_pixel = regs.src_pitch / regs.x_count;
+    if (read_buffer.size() < src_size) {
+        read_buffer.resize(src_size);
+    }
 
-        const std::size_t dst_size = Texture::CalculateSize(
-            true, bytes_per_pixel, regs.dst_params.size_x, regs.dst_params.size_y,
-            regs.dst_params.size_z, regs.dst_params.BlockHeight(), regs.dst_params.BlockDepth());
+    memory_manager.ReadBlock(source, read_buffer.data(), src_size);
 
-        const std::size_t dst_layer_size = Texture::CalculateSize(
-            true, bytes_per_pixel, regs.dst_params.size_x, regs.dst_params.size_y, 1,
-            regs.dst_params.BlockHeight(), regs.dst_params.BlockDepth());
+    ReadTiledElements(regs, params, bytes_per_element, read_buffer.data(), element_buffer.data());
+}
 
-        const std::size_t src_size = regs.src_pitch * regs.y_count;
+void MaxwellDMA::ReadTiledElements(const Regs& regs, const Regs::Parameters& params,
+                                   u32 bytes_per_element, u8* surface, u8* elements) {
+    const std::size_t layer_size =
+        Texture::CalculateSize(true, bytes_per_element, params.size_x, params.size_y, 1,
+                               params.BlockHeight(), params.BlockDepth());
+    Texture::UnswizzleSubrect(regs.x_count, regs.y_count, regs.x_count * bytes_per_element,
+                              params.size_x, bytes_per_element,
+                              surface + layer_size * params.pos_z, elements,
+                              params.BlockHeight(), params.pos_x, params.pos_y);
+}
 
-        if (read_buffer.size() < src_size) {
-            read_buffer.resize(src_size);
-        }
+void MaxwellDMA::WriteTiledElements(const Regs& regs, const Regs::Parameters& params,
+                                    u32 bytes_per_element, u8* surface, u8* elements) {
+    const std::size_t layer_size =
+        Texture::CalculateSize(true, bytes_per_element, params.size_x, params.size_y, 1,
+                               params.BlockHeight(), params.BlockDepth());
+    Texture::SwizzleSubrect(regs.x_count, regs.y_count, regs.x_count * bytes_per_element,
+                            params.size_x, bytes_per_element, surface + layer_size * params.pos_z,
+                            elements, params.BlockHeight(), params.pos_x, params.pos_y);
+}
 
-        if (write_buffer.size() < dst_size) {
-            write_buffer.resize(dst_size);
+void MaxwellDMA::RemapComponents(const Regs& regs, const std::vector<u8>& src_elements,
+                                 std::vector<u8>& dst_elements) {
+    const auto& config = regs.swizzle_config;
+    const u32 component_size = config.component_size + 1;
+    const u32 num_src_components = config.SrcNumComponents();
+    const u32 num_dst_components = config.DstNumComponents();
+    const u32 src_bytes_per_element = regs.SrcBytesPerElement();
+    const u32 dst_bytes_per_element = regs.DstBytesPerElement();
+    const std::array modes{config.component0.Value(), config.component1.Value(),
+                           config.component2.Value(), config.component3.Value()};
+
+    const std::size_t num_elements = src_elements.size() / src_bytes_per_element;
+    dst_elements.resize(num_elements * dst_bytes_per_element);
+
+    for (std::size_t element = 0; element < num_elements; ++element) {
+        const u8* const src = src_elements.data() + element * src_bytes_per_element;
+        u8* const dst = dst_elements.data() + element * dst_bytes_per_element;
+        for (u32 component = 0; component < num_dst_components; ++component) {
+            u8* const dst_component = dst + component * component_size;
+            switch (const auto mode = modes[component]) {
+            case Regs::ComponentMode::Src0:
+            case Regs::ComponentMode::Src1:
+            case Regs::ComponentMode::Src2:
+            case Regs::ComponentMode::Src3: {
+                const u32 src_component = static_cast<u32>(mode);
+                if (src_component < num_src_components) {
+                    std::memcpy(dst_component, src + src_component * component_size,
+                                component_size);
+                } else {
+                    std::memset(dst_component, 0, component_size);
+                }
+                break;
+            }
+            case Regs::ComponentMode::Const0:
+                std::memcpy(dst_component, &regs.const0, component_size);
+                break;
+            case Regs::ComponentMode::Const1:
+                std::memcpy(dst_component, &regs.const1, component_size);
+                break;
+            default:
+                std::memset(dst_component, 0, component_size);
+                break;
+            }
         }
+    }
+}
 
-        if (Settings::values.use_accurate_gpu_emulation) {
-            memory_manager.ReadBlock(source, read_buffer.data(), src_size);
-            memory_manager.ReadBlock(dest, write_buffer.data(), dst_size);
-        } else {
-            memory_manager.ReadBlockUnsafe(source, read_buffer.data(), src_size);
-            memory_manager.ReadBlockUnsafe(dest, write_buffer.data(), dst_size);
+void MaxwellDMA::WriteDestinationElements() {
+    const GPUVAddr dest = regs.dst_address.Address();
+    const u32 bytes_per_element = regs.DstBytesPerElement();
+    const u32 num_lines = regs.exec.enable_2d ? regs.y_count : 1;
+    const std::size_t line_size = static_cast<std::size_t>(regs.x_count) * bytes_per_element;
+    ASSERT(element_buffer.size() == line_size * num_lines);
+
+    if (regs.exec.is_dst_linear) {
+        if (num_lines == 1 || regs.dst_pitch == line_size) {
+            memory_manager.WriteBlock(dest, element_buffer.data(), element_buffer.size());
+            return;
         }
+        for (u32 line = 0; line < num_lines; ++line) {
+            memory_manager.WriteBlock(dest + line * regs.dst_pitch,
+                                      element_buffer.data() + line * line_size, line_size);
+        }
+        return;
+    }
+
+    ASSERT(regs.exec.enable_2d == 1);
+
+    const auto& params = regs.dst_params;
+    ASSERT(params.BlockDepth() == 0);
 
-        // If the input is linear and the output is tiled, swizzle the input and copy it over.
-        Texture::SwizzleSubrect(
-            regs.x_count, regs.y_count, regs.src_pitch, regs.dst_params.size_x, bytes_per_pixel,
-            write_buffer.data() + dst_layer_size * regs.dst_params.pos_z, read_buffer.data(),
-            regs.dst_params.BlockHeight(), regs.dst_params.pos_x, regs.dst_params.pos_y);
+    const std::size_t dst_size =
+        Texture::CalculateSize(true, bytes_per_element, params.size_x, params.size_y,
+                               params.size_z, params.BlockHeight(), params.BlockDepth());
 
-        memory_manager.WriteBlock(dest, write_buffer.data(), dst_size);
+    if (write_buffer.size() < dst_size) {
+        write_buffer.resize(dst_size);
     }
+
+    if (Settings::values.use_accurate_gpu_emulation) {
+        memory_manager.ReadBlock(dest, write_buffer.data(), dst_size);
+    } else {
+        memory_manager.ReadBlockUnsafe(dest, write_buffer.data(), dst_size);
+    }
+
+    // If the output is tiled, swizzle the rectangle into it and copy it over.
+    WriteTiledElements(regs, params, bytes_per_element, write_buffer.data(),
+                       element_buffer.data());
+
+    memory_manager.WriteBlock(dest, write_buffer.data(), dst_size);
 }
 
 } // namespace Tegra::Engines
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <vector>
@@ -20,6 +21,10 @@ namespace Tegra {
 class MemoryManager;
 }
 
+namespace VideoCore {
+class RasterizerInterface;
+}
+
 namespace Tegra::Engines {
 
 /**
@@ -29,7 +34,8 @@ namespace Tegra::Engines {
 
 class MaxwellDMA final {
 public:
-    explicit MaxwellDMA(Core::System& system, MemoryManager& memory_manager);
+    explicit MaxwellDMA(Core::System& system, VideoCore::RasterizerInterface& rasterizer,
+                        MemoryManager& memory_manager);
     ~MaxwellDMA() = default;
 
     /// Write the value to the register identified by method.
@@ -152,11 +158,19 @@ public:
                     BitField<20, 3, u32> src_num_components;
                     BitField<24, 3, u32> dst_num_components;
 
+                    // Sizes and counts are stored minus one. There are only four components,
+                    // larger counts are clamped.
+                    u32 SrcNumComponents() const {
+                        return std::min(src_num_components.Value(), 3U) + 1;
+                    }
+                    u32 DstNumComponents() const {
+                        return std::min(dst_num_components.Value(), 3U) + 1;
+                    }
                     u32 SrcBytePerPixel() const {
-                        return src_num_components.Value() * component_size.Value();
+                        return SrcNumComponents() * (component_size.Value() + 1);
                     }
                     u32 DstBytePerPixel() const {
-                        return dst_num_components.Value() * component_size.Value();
+                        return DstNumComponents() * (component_size.Value() + 1);
                     }
                 } swizzle_config;
 
@@ -170,19 +184,53 @@ public:
             };
             std::array<u32, NUM_REGS> reg_array;
         };
+
+        /// Returns the size in bytes of the elements read from the source. The copy rectangle and
+        /// the positions in block linear surfaces are given in elements.
+        u32 SrcBytesPerElement() const;
+
+        /// Returns the size in bytes of the elements written to the destination.
+        u32 DstBytesPerElement() const;
+
+        /// Returns true when the copy changes the components of the elements it copies.
+        bool HasComponentRemap() const;
     } regs{};
 
+    /// Deswizzles the copy rectangle out of the block linear surface described by params into
+    /// tightly packed elements.
+    static void ReadTiledElements(const Regs& regs, const Regs::Parameters& params,
+                                  u32 bytes_per_element, u8* surface, u8* elements);
+
+    /// Swizzles the tightly packed elements of the copy rectangle into the block linear surface
+    /// described by params.
+    static void WriteTiledElements(const Regs& regs, const Regs::Parameters& params,
+                                   u32 bytes_per_element, u8* surface, u8* elements);
+
+    /// Replaces the components of the tightly packed elements in src_elements as configured in
+    /// the registers, writing the resulting elements to dst_elements.
+    static void RemapComponents(const Regs& regs, const std::vector<u8>& src_elements,
+                                std::vector<u8>& dst_elements);
+
 private:
     Core::System& system;
 
+    VideoCore::RasterizerInterface& rasterizer;
+
     MemoryManager& memory_manager;
 
     std::vector<u8> read_buffer;
     std::vector<u8> write_buffer;
+    std::vector<u8> element_buffer;
 
     /// Performs the copy from the source buffer to the destination buffer as configured in the
     /// registers.
     void HandleCopy();
+
+    /// Reads the source rectangle into element_buffer, tightly packed.
+    void ReadSourceElements();
+
+    /// Writes the tightly packed rectangle in element_buffer to the destination.
+    void WriteDestinationElements();
 };
 
 #define ASSERT_REG_POSITION(field_name, position)                                                  \
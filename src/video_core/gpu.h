@@ -6,13 +6,12 @@
 
 #include <array>
 #include <atomic>
-#include <list>
 #include <memory>
-#include <mutex>
 #include "common/common_types.h"
 #include "core/hle/service/nvdrv/nvdata.h"
 #include "core/hle/service/nvflinger/buffer_queue.h"
 #include "video_core/dma_pusher.h"
+#include "video_core/syncpoint_manager.h"
 
 using CacheAddr = std::uintptr_t;
 inline CacheAddr ToCacheAddr(const void* host_ptr) {
@@ -187,12 +186,20 @@ public:
 
     u32 GetSyncpointValue(u32 syncpoint_id) const;
 
-    void RegisterSyncptInterrupt(u32 syncpoint_id, u32 value);
+    /// Requests a CPU interrupt once the syncpoint reaches the value. Returns false without
+    /// registering it when the syncpoint has already reached the value.
+    bool RegisterSyncptInterrupt(u32 syncpoint_id, u32 value);
 
     bool CancelSyncptInterrupt(u32 syncpoint_id, u32 value);
 
-    std::unique_lock<std::mutex> LockSync() {
-        return std::unique_lock{sync_mutex};
+    /// Returns a reference to the GPU syncpoint manager.
+    Tegra::SyncpointManager& SyncpointManager() {
+        return syncpoint_manager;
+    }
+
+    /// Returns a const reference to the GPU syncpoint manager.
+    const Tegra::SyncpointManager& SyncpointManager() const {
+        return syncpoint_manager;
     }
 
     bool IsAsync() const {
@@ -306,11 +313,8 @@ private:
     /// Inline memory engine
     std::unique_ptr<Engines::KeplerMemory> kepler_memory;
 
-    std::array<std::atomic<u32>, Service::Nvidia::MaxSyncPoints> syncpoints{};
-
-    std::array<std::list<u32>, Service::Nvidia::MaxSyncPoints> syncpt_interrupts;
-
-    std::mutex sync_mutex;
+    /// Syncpoint values and the waits on them
+    mutable Tegra::SyncpointManager syncpoint_manager;
 
     const bool is_async;
 };
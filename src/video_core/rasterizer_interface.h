@@ -8,6 +8,7 @@
 #include <functional>
 #include "common/common_types.h"
 #include "video_core/engines/fermi_2d.h"
+#include "video_core/engines/maxwell_dma.h"
 #include "video_core/gpu.h"
 
 namespace Tegra {
@@ -66,6 +67,11 @@ public:
         return false;
     }
 
+    /// Attempt to perform a DMA copy involving block linear surfaces on the host GPU
+    virtual bool AccelerateDMA(const Tegra::Engines::MaxwellDMA::Regs& regs) {
+        return false;
+    }
+
     /// Attempt to use a faster method to display the framebuffer to screen
     virtual bool AccelerateDisplay(const Tegra::FramebufferConfig& config, VAddr framebuffer_addr,
                                    u32 pixel_stride) {
@@ -39,6 +39,8 @@ using VideoCore::Surface::PixelFormat;
 using VideoCore::Surface::SurfaceTarget;
 using VideoCore::Surface::SurfaceType;
 
+namespace Dirty = VideoCommon::Dirty;
+
 MICROPROFILE_DEFINE(OpenGL_VAO, "OpenGL", "Vertex Format Setup", MP_RGB(128, 128, 192));
 MICROPROFILE_DEFINE(OpenGL_VB, "OpenGL", "Vertex Buffer Setup", MP_RGB(128, 128, 192));
 MICROPROFILE_DEFINE(OpenGL_Shader, "OpenGL", "Shader Setup", MP_RGB(128, 128, 192));
@@ -112,10 +114,9 @@ GLuint RasterizerOpenGL::SetupVertexFormat() {
     auto& gpu = system.GPU().Maxwell3D();
     const auto& regs = gpu.regs;
 
-    if (!gpu.dirty.vertex_attrib_format) {
+    if (!gpu.dirty.Consume(Dirty::VertexFormats)) {
         return state.draw.vertex_array;
     }
-    gpu.dirty.vertex_attrib_format = false;
 
     MICROPROFILE_SCOPE(OpenGL_VAO);
 
@@ -177,9 +178,9 @@ GLuint RasterizerOpenGL::SetupVertexFormat() {
 
 void RasterizerOpenGL::SetupVertexBuffer(GLuint vao) {
     auto& gpu = system.GPU().Maxwell3D();
-    if (!gpu.dirty.vertex_array_buffers)
+    if (!gpu.dirty.Consume(Dirty::VertexArrays))
         return;
-    gpu.dirty.vertex_array_buffers = false;
+    auto& flags = gpu.dirty.flags;
 
     const auto& regs = gpu.regs;
 
@@ -187,10 +188,10 @@ void RasterizerOpenGL::SetupVertexBuffer(GLuint vao) {
 
     // Upload all guest vertex arrays sequentially to our buffer
     for (u32 index = 0; index < Maxwell::NumVertexArrays; ++index) {
-        if (!gpu.dirty.vertex_array[index])
+        if (!flags[Dirty::VertexArray0 + index])
             continue;
-        gpu.dirty.vertex_array[index] = false;
-        gpu.dirty.vertex_instance[index] = false;
+        flags[Dirty::VertexArray0 + index] = false;
+        flags[Dirty::VertexInstance0 + index] = false;
 
         const auto& vertex_array = regs.vertex_array[index];
         if (!vertex_array.IsEnabled())
@@ -220,17 +221,17 @@ void RasterizerOpenGL::SetupVertexBuffer(GLuint vao) {
 void RasterizerOpenGL::SetupVertexInstances(GLuint vao) {
     auto& gpu = system.GPU().Maxwell3D();
 
-    if (!gpu.dirty.vertex_instances)
+    if (!gpu.dirty.Consume(Dirty::VertexInstances))
         return;
-    gpu.dirty.vertex_instances = false;
+    auto& flags = gpu.dirty.flags;
 
     const auto& regs = gpu.regs;
     // Upload all guest vertex arrays sequentially to our buffer
     for (u32 index = 0; index < Maxwell::NumVertexArrays; ++index) {
-        if (!gpu.dirty.vertex_instance[index])
+        if (!flags[Dirty::VertexInstance0 + index])
             continue;
 
-        gpu.dirty.vertex_instance[index] = false;
+        flags[Dirty::VertexInstance0 + index] = false;
 
         if (regs.instanced_arrays.IsInstancingEnabled(index) &&
             regs.vertex_array[index].divisor != 0) {
@@ -330,7 +331,7 @@ void RasterizerOpenGL::SetupShaders(GLenum primitive_mode) {
 
     SyncClipEnabled(clip_distances);
 
-    gpu.dirty.shaders = false;
+    gpu.dirty.flags[Dirty::Shaders] = false;
 }
 
 std::size_t RasterizerOpenGL::CalculateVertexArraysSize() const {
@@ -366,10 +367,9 @@ void RasterizerOpenGL::LoadDiskResources(const std::atomic_bool& stop_loading,
 void RasterizerOpenGL::ConfigureFramebuffers() {
     MICROPROFILE_SCOPE(OpenGL_Framebuffer);
     auto& gpu = system.GPU().Maxwell3D();
-    if (!gpu.dirty.render_settings) {
+    if (!gpu.dirty.Consume(Dirty::RenderTargets)) {
         return;
     }
-    gpu.dirty.render_settings = false;
 
     texture_cache.GuardRenderTargets(true);
 
@@ -405,7 +405,6 @@ void RasterizerOpenGL::ConfigureFramebuffers() {
     texture_cache.GuardRenderTargets(false);
 
     state.draw.draw_framebuffer = framebuffer_cache.GetFramebuffer(key);
-    SyncViewport(state);
 }
 
 void RasterizerOpenGL::ConfigureClearFramebuffer(OpenGLState& current_state, bool using_color_fb,
@@ -550,7 +549,14 @@ void RasterizerOpenGL::DrawPrelude() {
     SyncLogicOpState();
     SyncCullMode();
     SyncPrimitiveRestart();
-    SyncScissorTest(state);
+    if (gpu.dirty.Consume(Dirty::Viewports)) {
+        SyncViewport(state);
+        state.MarkDirtyViewportState();
+    }
+    if (gpu.dirty.Consume(Dirty::Scissors)) {
+        SyncScissorTest(state);
+        state.MarkDirtyViewportState();
+    }
     SyncTransformFeedback();
     SyncPointState();
     SyncPolygonOffset();
@@ -694,7 +700,6 @@ bool RasterizerOpenGL::DrawBatch(bool is_indexed) {
     }
     draw_call.DispatchDraw();
 
-    maxwell3d.dirty.memory_general = false;
     accelerate_draw = AccelDraw::Disabled;
     return true;
 }
@@ -726,7 +731,6 @@ bool RasterizerOpenGL::DrawMultiBatch(bool is_indexed) {
     }
     draw_call.DispatchDraw();
 
-    maxwell3d.dirty.memory_general = false;
     accelerate_draw = AccelDraw::Disabled;
     return true;
 }
@@ -806,6 +810,7 @@ void RasterizerOpenGL::FlushCommands() {
 }
 
 void RasterizerOpenGL::TickFrame() {
+    system.GPU().Maxwell3D().dirty.EndFrame();
     buffer_cache.TickFrame();
 }
 
@@ -813,8 +818,12 @@ bool RasterizerOpenGL::AccelerateSurfaceCopy(const Tegra::Engines::Fermi2D::Regs
                                              const Tegra::Engines::Fermi2D::Regs::Surface& dst,
                                              const Tegra::Engines::Fermi2D::Config& copy_config) {
     MICROPROFILE_SCOPE(OpenGL_Blits);
-    texture_cache.DoFermiCopy(src, dst, copy_config);
-    return true;
+    return texture_cache.DoFermiCopy(src, dst, copy_config);
+}
+
+bool RasterizerOpenGL::AccelerateDMA(const Tegra::Engines::MaxwellDMA::Regs& regs) {
+    MICROPROFILE_SCOPE(OpenGL_Blits);
+    return texture_cache.DoDMACopy(regs);
 }
 
 bool RasterizerOpenGL::AccelerateDisplay(const Tegra::FramebufferConfig& config,
@@ -1062,7 +1071,11 @@ void RasterizerOpenGL::SyncClipCoef() {
 }
 
 void RasterizerOpenGL::SyncCullMode() {
-    const auto& regs = system.GPU().Maxwell3D().regs;
+    auto& maxwell3d = system.GPU().Maxwell3D();
+    if (!maxwell3d.dirty.Consume(Dirty::CullMode)) {
+        return;
+    }
+    const auto& regs = maxwell3d.regs;
 
     state.cull.enabled = regs.cull.enabled != 0;
     if (state.cull.enabled) {
@@ -1073,14 +1086,22 @@ void RasterizerOpenGL::SyncCullMode() {
 }
 
 void RasterizerOpenGL::SyncPrimitiveRestart() {
-    const auto& regs = system.GPU().Maxwell3D().regs;
+    auto& maxwell3d = system.GPU().Maxwell3D();
+    if (!maxwell3d.dirty.Consume(Dirty::PrimitiveRestart)) {
+        return;
+    }
+    const auto& regs = maxwell3d.regs;
 
     state.primitive_restart.enabled = regs.primitive_restart.enabled;
     state.primitive_restart.index = regs.primitive_restart.index;
 }
 
 void RasterizerOpenGL::SyncDepthTestState() {
-    const auto& regs = system.GPU().Maxwell3D().regs;
+    auto& maxwell3d = system.GPU().Maxwell3D();
+    if (!maxwell3d.dirty.Consume(Dirty::DepthTest)) {
+        return;
+    }
+    const auto& regs = maxwell3d.regs;
 
     state.depth.test_enabled = regs.depth_test_enable != 0;
     state.depth.write_mask = regs.depth_write_enabled ? GL_TRUE : GL_FALSE;
@@ -1094,10 +1115,9 @@ void RasterizerOpenGL::SyncDepthTestState() {
 
 void RasterizerOpenGL::SyncStencilTestState() {
     auto& maxwell3d = system.GPU().Maxwell3D();
-    if (!maxwell3d.dirty.stencil_test) {
+    if (!maxwell3d.dirty.Consume(Dirty::StencilTest)) {
         return;
     }
-    maxwell3d.dirty.stencil_test = false;
 
     const auto& regs = maxwell3d.regs;
     state.stencil.test_enabled = regs.stencil_enable != 0;
@@ -1135,7 +1155,7 @@ void RasterizerOpenGL::SyncStencilTestState() {
 
 void RasterizerOpenGL::SyncColorMask() {
     auto& maxwell3d = system.GPU().Maxwell3D();
-    if (!maxwell3d.dirty.color_mask) {
+    if (!maxwell3d.dirty.Consume(Dirty::ColorMask)) {
         return;
     }
     const auto& regs = maxwell3d.regs;
@@ -1152,7 +1172,6 @@ void RasterizerOpenGL::SyncColorMask() {
     }
 
     state.MarkDirtyColorMask();
-    maxwell3d.dirty.color_mask = false;
 }
 
 void RasterizerOpenGL::SyncMultiSampleState() {
@@ -1168,7 +1187,7 @@ void RasterizerOpenGL::SyncFragmentColorClampState() {
 
 void RasterizerOpenGL::SyncBlendState() {
     auto& maxwell3d = system.GPU().Maxwell3D();
-    if (!maxwell3d.dirty.blend_state) {
+    if (!maxwell3d.dirty.Consume(Dirty::BlendState)) {
         return;
     }
     const auto& regs = maxwell3d.regs;
@@ -1194,7 +1213,6 @@ void RasterizerOpenGL::SyncBlendState() {
         for (std::size_t i = 1; i < Tegra::Engines::Maxwell3D::Regs::NumRenderTargets; i++) {
             state.blend[i].enabled = false;
         }
-        maxwell3d.dirty.blend_state = false;
         state.MarkDirtyBlendState();
         return;
     }
@@ -1214,7 +1232,6 @@ void RasterizerOpenGL::SyncBlendState() {
     }
 
     state.MarkDirtyBlendState();
-    maxwell3d.dirty.blend_state = false;
 }
 
 void RasterizerOpenGL::SyncLogicOpState() {
@@ -1267,7 +1284,7 @@ void RasterizerOpenGL::SyncPointState() {
 
 void RasterizerOpenGL::SyncPolygonOffset() {
     auto& maxwell3d = system.GPU().Maxwell3D();
-    if (!maxwell3d.dirty.polygon_offset) {
+    if (!maxwell3d.dirty.Consume(Dirty::PolygonOffset)) {
         return;
     }
     const auto& regs = maxwell3d.regs;
@@ -1282,7 +1299,6 @@ void RasterizerOpenGL::SyncPolygonOffset() {
     state.polygon_offset.clamp = regs.polygon_offset_clamp;
 
     state.MarkDirtyPolygonOffset();
-    maxwell3d.dirty.polygon_offset = false;
 }
 
 void RasterizerOpenGL::SyncAlphaTest() {
@@ -625,7 +625,7 @@ bool ShaderCacheOpenGL::GenerateUnspecializedShaders(
 }
 
 Shader ShaderCacheOpenGL::GetStageProgram(Maxwell::ShaderProgram program) {
-    if (!system.GPU().Maxwell3D().dirty.shaders) {
+    if (!system.GPU().Maxwell3D().dirty.flags[VideoCommon::Dirty::Shaders]) {
         return last_shaders[static_cast<std::size_t>(program)];
     }
 
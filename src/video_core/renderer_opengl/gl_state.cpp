@@ -260,6 +260,11 @@ void OpenGLState::ApplyStencilTest() {
 }
 
 void OpenGLState::ApplyViewport() {
+    if (!dirty.viewport_state) {
+        return;
+    }
+    dirty.viewport_state = false;
+
     for (GLuint i = 0; i < static_cast<GLuint>(Maxwell::NumViewports); ++i) {
         const auto& updated = viewports[i];
         auto& current = cur_state.viewports[i];
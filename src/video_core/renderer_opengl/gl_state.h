@@ -210,6 +210,10 @@ public:
         dirty.stencil_state = true;
     }
 
+    void MarkDirtyViewportState() {
+        dirty.viewport_state = true;
+    }
+
     void MarkDirtyPolygonOffset() {
         dirty.polygon_offset = true;
     }
@@ -221,6 +225,7 @@ public:
     void AllDirty() {
         dirty.blend_state = true;
         dirty.stencil_state = true;
+        dirty.viewport_state = true;
         dirty.polygon_offset = true;
         dirty.color_mask = true;
     }
@@ -2,6 +2,9 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <cstdint>
+#include <string>
+#include <fmt/format.h>
 #include "common/assert.h"
 #include "common/bit_util.h"
 #include "common/common_types.h"
@@ -35,6 +38,27 @@ MICROPROFILE_DEFINE(OpenGL_Texture_Buffer_Copy, "OpenGL", "Texture Buffer Copy",
 
 namespace {
 
+constexpr GLsizeiptr UPLOAD_HEAP_SIZE = 64 * 1024 * 1024;
+constexpr GLintptr UPLOAD_HEAP_ALIGNMENT = 256;
+
+/// Surfaces larger than this fraction of the upload heap are uploaded from the staging cache.
+constexpr GLsizeiptr MAX_UPLOAD_HEAP_FRACTION = 4;
+
+constexpr char BLIT_VERTEX_SHADER[] = R"(#version 430 core
+
+layout (location = 0) out vec2 tex_coord;
+
+void main() {
+    const vec2 position = vec2(gl_VertexID & 1, gl_VertexID >> 1);
+    tex_coord = position;
+    gl_Position = vec4(position * 2.0 - 1.0, 0.0, 1.0);
+}
+)";
+
+/// Numeric class of a surface, blits can't convert between some of them with glBlitFramebuffer.
+enum class BlitComponent { Float, Uint, Sint, Depth };
+constexpr std::size_t NumBlitComponents = 4;
+
 struct FormatTuple {
     GLint internal_format;
     GLenum format;
@@ -133,6 +157,96 @@ const FormatTuple& GetFormatTuple(PixelFormat pixel_format) {
     return format;
 }
 
+BlitComponent GetBlitComponent(const SurfaceParams& params) {
+    if (params.type == SurfaceType::Depth || params.type == SurfaceType::DepthStencil) {
+        return BlitComponent::Depth;
+    }
+    const FormatTuple& tuple{GetFormatTuple(params.pixel_format)};
+    switch (tuple.format) {
+    case GL_RED_INTEGER:
+    case GL_RG_INTEGER:
+    case GL_RGB_INTEGER:
+    case GL_RGBA_INTEGER:
+        switch (tuple.type) {
+        case GL_BYTE:
+        case GL_SHORT:
+        case GL_INT:
+            return BlitComponent::Sint;
+        default:
+            return BlitComponent::Uint;
+        }
+    default:
+        return BlitComponent::Float;
+    }
+}
+
+/// Returns true when glBlitFramebuffer can be used to blit between the surfaces.
+bool IsFramebufferBlitSupported(const SurfaceParams& src_params, const SurfaceParams& dst_params,
+                                bool is_linear) {
+    if (src_params.type != dst_params.type) {
+        return false;
+    }
+    const BlitComponent src_component = GetBlitComponent(src_params);
+    if (src_component != GetBlitComponent(dst_params)) {
+        return false;
+    }
+    switch (src_component) {
+    case BlitComponent::Float:
+        return true;
+    case BlitComponent::Uint:
+    case BlitComponent::Sint:
+        return !is_linear;
+    case BlitComponent::Depth:
+        // Depth and stencil blits require identical formats
+        return src_params.pixel_format == dst_params.pixel_format;
+    }
+    UNREACHABLE();
+    return false;
+}
+
+std::string MakeBlitFragmentShader(BlitComponent src_component, BlitComponent dst_component) {
+    static constexpr std::array<const char*, NumBlitComponents> sampler_prefixes{"", "u", "i",
+                                                                                 ""};
+    static constexpr std::array<const char*, NumBlitComponents> vector_types{"vec4", "uvec4",
+                                                                             "ivec4", "vec4"};
+    const char* const src_type = vector_types[static_cast<std::size_t>(src_component)];
+    const char* const dst_type = vector_types[static_cast<std::size_t>(dst_component)];
+
+    std::string fetch;
+    if (src_component == BlitComponent::Uint || src_component == BlitComponent::Sint) {
+        // Integer textures can't be filtered, fetch the texel directly
+        fetch = fmt::format("const {} texel = texelFetch(src_texture, "
+                            "ivec2(src_rect.xy + tex_coord * src_rect.zw), 0);",
+                            src_type);
+    } else {
+        fetch = "const vec4 texel = texture(src_texture, (src_rect.xy + tex_coord * src_rect.zw) / "
+                "vec2(textureSize(src_texture, 0)));";
+    }
+
+    const bool is_depth = dst_component == BlitComponent::Depth;
+    const std::string output =
+        is_depth ? "" : fmt::format("layout (location = 0) out {} color;\n", dst_type);
+    const std::string write = is_depth ? "gl_FragDepth = float(texel.r);"
+                                       : fmt::format("color = {}(texel);", dst_type);
+
+    return fmt::format(R"(#version 430 core
+
+layout (location = 0) in vec2 tex_coord;
+{}
+layout (binding = 0) uniform {}sampler2D src_texture;
+
+// Source rectangle, offset in xy and size in zw.
+layout (location = 0) uniform vec4 src_rect;
+
+void main() {{
+    {}
+    {}
+}}
+)",
+                       output, sampler_prefixes[static_cast<std::size_t>(src_component)], fetch,
+                       write);
+}
+
 GLenum GetTextureTarget(const SurfaceTarget& target) {
     switch (target) {
     case SurfaceTarget::TextureBuffer:
@@ -269,11 +383,27 @@ void CachedSurface::UploadTexture(const std::vector<u8>& staging_buffer) {
     MICROPROFILE_SCOPE(OpenGL_Texture_Upload);
     SCOPE_EXIT({ glPixelStorei(GL_UNPACK_ROW_LENGTH, 0); });
     for (u32 level = 0; level < params.emulated_levels; ++level) {
-        UploadTextureMipmap(level, staging_buffer);
+        UploadTextureMipmap(level, staging_buffer.data());
     }
 }
 
-void CachedSurface::UploadTextureMipmap(u32 level, const std::vector<u8>& staging_buffer) {
+void CachedSurface::UploadTexture(GLuint buffer, GLintptr offset) {
+    MICROPROFILE_SCOPE(OpenGL_Texture_Upload);
+    ASSERT(params.target != SurfaceTarget::TextureBuffer);
+    SCOPE_EXIT({
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    });
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer);
+
+    // With a pixel unpack buffer bound, the data pointer is interpreted as an offset into it.
+    const auto base = reinterpret_cast<const u8*>(static_cast<std::uintptr_t>(offset));
+    for (u32 level = 0; level < params.emulated_levels; ++level) {
+        UploadTextureMipmap(level, base);
+    }
+}
+
+void CachedSurface::UploadTextureMipmap(u32 level, const u8* staging_buffer) {
     glPixelStorei(GL_UNPACK_ALIGNMENT, std::min(8U, params.GetRowAlignment(level)));
     glPixelStorei(GL_UNPACK_ROW_LENGTH, static_cast<GLint>(params.GetMipWidth(level)));
 
@@ -282,7 +412,7 @@ void CachedSurface::UploadTextureMipmap(u32 level, const std::vector<u8>& stagin
     const std::size_t mip_offset = compression_type == SurfaceCompression::Converted
                                        ? params.GetConvertedMipmapOffset(level)
                                        : params.GetHostMipmapLevelOffset(level);
-    const u8* buffer{staging_buffer.data() + mip_offset};
+    const u8* buffer{staging_buffer + mip_offset};
     if (is_compressed) {
         const auto image_size{static_cast<GLsizei>(params.GetHostMipmapSize(level))};
         switch (params.target) {
@@ -354,6 +484,40 @@ void CachedSurface::UploadTextureMipmap(u32 level, const std::vector<u8>& stagin
     }
 }
 
+void CachedSurface::UploadRect(const VideoCommon::LinearCopyParams& copy, const u8* data) {
+    MICROPROFILE_SCOPE(OpenGL_Texture_Upload);
+    SCOPE_EXIT({ glPixelStorei(GL_UNPACK_ROW_LENGTH, 0); });
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, static_cast<GLint>(copy.row_length));
+
+    const auto x = static_cast<GLint>(copy.x);
+    const auto y = static_cast<GLint>(copy.y);
+    const auto width = static_cast<GLsizei>(copy.width);
+    const auto height = static_cast<GLsizei>(copy.height);
+    if (params.target == SurfaceTarget::Texture2D) {
+        glTextureSubImage2D(texture.handle, 0, x, y, width, height, format, type, data);
+    } else {
+        glTextureSubImage3D(texture.handle, 0, x, y, static_cast<GLint>(copy.layer), width, height,
+                            1, format, type, data);
+    }
+}
+
+void CachedSurface::DownloadRect(const VideoCommon::LinearCopyParams& copy, u8* data) {
+    MICROPROFILE_SCOPE(OpenGL_Texture_Download);
+    SCOPE_EXIT({ glPixelStorei(GL_PACK_ROW_LENGTH, 0); });
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glPixelStorei(GL_PACK_ROW_LENGTH, static_cast<GLint>(copy.row_length));
+
+    // The last row isn't padded up to the row length.
+    const std::size_t size = (static_cast<std::size_t>(copy.row_length) * (copy.height - 1) +
+                              copy.width) *
+                             params.GetBytesPerPixel();
+    glGetTextureSubImage(texture.handle, 0, static_cast<GLint>(copy.x),
+                         static_cast<GLint>(copy.y), static_cast<GLint>(copy.layer),
+                         static_cast<GLsizei>(copy.width), static_cast<GLsizei>(copy.height), 1,
+                         format, type, static_cast<GLsizei>(size), data);
+}
+
 void CachedSurface::DecorateSurfaceName() {
     LabelGLObject(GL_TEXTURE, texture.handle, GetGpuAddr(), params.TargetName());
 }
@@ -444,9 +608,20 @@ OGLTextureView CachedSurfaceView::CreateTextureView() const {
 TextureCacheOpenGL::TextureCacheOpenGL(Core::System& system,
                                        VideoCore::RasterizerInterface& rasterizer,
                                        const Device& device)
-    : TextureCacheBase{system, rasterizer} {
+    : TextureCacheBase{system, rasterizer}, upload_heap{UPLOAD_HEAP_SIZE} {
     src_framebuffer.Create();
     dst_framebuffer.Create();
+    blit_vertex_array.Create();
+
+    static constexpr std::array<GLint, 2> filters{GL_NEAREST, GL_LINEAR};
+    for (std::size_t i = 0; i < blit_samplers.size(); ++i) {
+        OGLSampler& sampler = blit_samplers[i];
+        sampler.Create();
+        glSamplerParameteri(sampler.handle, GL_TEXTURE_MIN_FILTER, filters[i]);
+        glSamplerParameteri(sampler.handle, GL_TEXTURE_MAG_FILTER, filters[i]);
+        glSamplerParameteri(sampler.handle, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glSamplerParameteri(sampler.handle, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    }
 }
 
 TextureCacheOpenGL::~TextureCacheOpenGL() = default;
@@ -474,10 +649,19 @@ void TextureCacheOpenGL::ImageCopy(Surface& src_surface, Surface& dst_surface,
                        copy_params.depth);
 }
 
-void TextureCacheOpenGL::ImageBlit(View& src_view, View& dst_view,
+bool TextureCacheOpenGL::ImageBlit(View& src_view, View& dst_view,
                                    const Tegra::Engines::Fermi2D::Config& copy_config) {
     const auto& src_params{src_view->GetSurfaceParams()};
     const auto& dst_params{dst_view->GetSurfaceParams()};
+    if (src_params.target == SurfaceTarget::Texture3D ||
+        dst_params.target == SurfaceTarget::Texture3D) {
+        return false;
+    }
+
+    const bool is_linear = copy_config.filter == Tegra::Engines::Fermi2D::Filter::Linear;
+    if (!IsFramebufferBlitSupported(src_params, dst_params, is_linear)) {
+        return ShaderBlit(src_view, dst_view, copy_config);
+    }
 
     OpenGLState prev_state{OpenGLState::GetCurState()};
     SCOPE_EXIT({
@@ -494,9 +678,6 @@ void TextureCacheOpenGL::ImageBlit(View& src_view, View& dst_view,
 
     u32 buffers{};
 
-    UNIMPLEMENTED_IF(src_params.target == SurfaceTarget::Texture3D);
-    UNIMPLEMENTED_IF(dst_params.target == SurfaceTarget::Texture3D);
-
     if (src_params.type == SurfaceType::ColorTexture) {
         src_view->Attach(GL_COLOR_ATTACHMENT0, GL_READ_FRAMEBUFFER);
         glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_TEXTURE_2D, 0,
@@ -529,11 +710,83 @@ void TextureCacheOpenGL::ImageBlit(View& src_view, View& dst_view,
 
     const Common::Rectangle<u32>& src_rect = copy_config.src_rect;
     const Common::Rectangle<u32>& dst_rect = copy_config.dst_rect;
-    const bool is_linear = copy_config.filter == Tegra::Engines::Fermi2D::Filter::Linear;
 
     glBlitFramebuffer(src_rect.left, src_rect.top, src_rect.right, src_rect.bottom, dst_rect.left,
                       dst_rect.top, dst_rect.right, dst_rect.bottom, buffers,
                       is_linear && (buffers == GL_COLOR_BUFFER_BIT) ? GL_LINEAR : GL_NEAREST);
+    return true;
+}
+
+bool TextureCacheOpenGL::ShaderBlit(View& src_view, View& dst_view,
+                                    const Tegra::Engines::Fermi2D::Config& copy_config) {
+    const auto& src_params{src_view->GetSurfaceParams()};
+    const auto& dst_params{dst_view->GetSurfaceParams()};
+    if (src_params.target != SurfaceTarget::Texture2D) {
+        return false;
+    }
+    const BlitComponent src_component = GetBlitComponent(src_params);
+    const BlitComponent dst_component = GetBlitComponent(dst_params);
+    const bool is_linear = copy_config.filter == Tegra::Engines::Fermi2D::Filter::Linear &&
+                           src_component == BlitComponent::Float;
+    const OGLProgram& program = GetBlitProgram(static_cast<std::size_t>(src_component),
+                                               static_cast<std::size_t>(dst_component));
+
+    OpenGLState prev_state{OpenGLState::GetCurState()};
+    SCOPE_EXIT({
+        prev_state.AllDirty();
+        prev_state.Apply();
+    });
+
+    const Common::Rectangle<u32>& src_rect = copy_config.src_rect;
+    const Common::Rectangle<u32>& dst_rect = copy_config.dst_rect;
+
+    OpenGLState state;
+    state.draw.draw_framebuffer = dst_framebuffer.handle;
+    state.draw.vertex_array = blit_vertex_array.handle;
+    state.draw.shader_program = program.handle;
+    state.textures[0] = src_view->GetTexture();
+    state.samplers[0] = blit_samplers[is_linear ? 1 : 0].handle;
+    state.framebuffer_srgb.enabled = dst_params.srgb_conversion;
+    if (dst_component == BlitComponent::Depth) {
+        state.depth.test_enabled = true;
+        state.depth.test_func = GL_ALWAYS;
+    }
+    auto& viewport = state.viewports[0];
+    viewport.x = static_cast<GLint>(dst_rect.left);
+    viewport.y = static_cast<GLint>(dst_rect.top);
+    viewport.width = static_cast<GLint>(dst_rect.GetWidth());
+    viewport.height = static_cast<GLint>(dst_rect.GetHeight());
+    state.AllDirty();
+    state.Apply();
+
+    if (dst_component == BlitComponent::Depth) {
+        glFramebufferTexture2D(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, 0, 0);
+        dst_view->Attach(dst_params.type == SurfaceType::DepthStencil ? GL_DEPTH_STENCIL_ATTACHMENT
+                                                                      : GL_DEPTH_ATTACHMENT,
+                         GL_DRAW_FRAMEBUFFER);
+    } else {
+        dst_view->Attach(GL_COLOR_ATTACHMENT0, GL_DRAW_FRAMEBUFFER);
+        glFramebufferTexture2D(GL_DRAW_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_TEXTURE_2D, 0,
+                               0);
+    }
+
+    glProgramUniform4f(program.handle, 0, static_cast<GLfloat>(src_rect.left),
+                       static_cast<GLfloat>(src_rect.top),
+                       static_cast<GLfloat>(src_rect.GetWidth()),
+                       static_cast<GLfloat>(src_rect.GetHeight()));
+    glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+    return true;
+}
+
+const OGLProgram& TextureCacheOpenGL::GetBlitProgram(std::size_t src_component,
+                                                     std::size_t dst_component) {
+    OGLProgram& program = blit_programs[src_component * NumBlitComponents + dst_component];
+    if (program.handle == 0) {
+        const std::string frag = MakeBlitFragmentShader(static_cast<BlitComponent>(src_component),
+                                                        static_cast<BlitComponent>(dst_component));
+        program.CreateFromSource(BLIT_VERTEX_SHADER, nullptr, frag.c_str());
+    }
+    return program;
 }
 
 void TextureCacheOpenGL::BufferCopy(Surface& src_surface, Surface& dst_surface) {
@@ -602,6 +855,29 @@ void TextureCacheOpenGL::BufferCopy(Surface& src_surface, Surface& dst_surface)
     glTextureBarrier();
 }
 
+u8* TextureCacheOpenGL::MapUploadBuffer(Surface& surface, std::size_t size) {
+    const auto& params = surface->GetSurfaceParams();
+    const auto compression_type = params.GetCompressionType();
+    if (compression_type != SurfaceCompression::None &&
+        compression_type != SurfaceCompression::Compressed) {
+        // Conversions read back the loaded data, keep them on cached memory.
+        return nullptr;
+    }
+    if (params.target == SurfaceTarget::TextureBuffer ||
+        size > static_cast<std::size_t>(upload_heap.GetSize() / MAX_UPLOAD_HEAP_FRACTION)) {
+        return nullptr;
+    }
+    const auto [pointer, offset] =
+        upload_heap.Map(static_cast<GLsizeiptr>(size), UPLOAD_HEAP_ALIGNMENT);
+    upload_offset = offset;
+    return pointer;
+}
+
+void TextureCacheOpenGL::UploadFromBuffer(Surface& surface, std::size_t size) {
+    upload_heap.Unmap(static_cast<GLsizeiptr>(size));
+    surface->UploadTexture(upload_heap.GetHandle(), upload_offset);
+}
+
 GLuint TextureCacheOpenGL::FetchPBO(std::size_t buffer_size) {
     ASSERT_OR_EXECUTE(buffer_size > 0, { return 0; });
     const u32 l2 = Common::Log2Ceil64(static_cast<u64>(buffer_size));
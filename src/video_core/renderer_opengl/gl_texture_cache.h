@@ -17,6 +17,7 @@
 #include "video_core/engines/shader_bytecode.h"
 #include "video_core/renderer_opengl/gl_device.h"
 #include "video_core/renderer_opengl/gl_resource_manager.h"
+#include "video_core/renderer_opengl/gl_upload_heap.h"
 #include "video_core/texture_cache/texture_cache.h"
 
 namespace OpenGL {
@@ -42,6 +43,12 @@ public:
     void UploadTexture(const std::vector<u8>& staging_buffer) override;
     void DownloadTexture(std::vector<u8>& staging_buffer) override;
 
+    /// Uploads the texture from a pixel unpack buffer holding its host data at the given offset.
+    void UploadTexture(GLuint buffer, GLintptr offset);
+
+    void UploadRect(const VideoCommon::LinearCopyParams& copy, const u8* data) override;
+    void DownloadRect(const VideoCommon::LinearCopyParams& copy, u8* data) override;
+
     GLenum GetTarget() const {
         return target;
     }
@@ -57,7 +64,7 @@ protected:
     View CreateViewInner(const ViewParams& view_key, bool is_proxy);
 
 private:
-    void UploadTextureMipmap(u32 level, const std::vector<u8>& staging_buffer);
+    void UploadTextureMipmap(u32 level, const u8* staging_buffer);
 
     GLenum internal_format{};
     GLenum format{};
@@ -131,17 +138,34 @@ protected:
     void ImageCopy(Surface& src_surface, Surface& dst_surface,
                    const VideoCommon::CopyParams& copy_params) override;
 
-    void ImageBlit(View& src_view, View& dst_view,
+    bool ImageBlit(View& src_view, View& dst_view,
                    const Tegra::Engines::Fermi2D::Config& copy_config) override;
 
     void BufferCopy(Surface& src_surface, Surface& dst_surface) override;
 
+    u8* MapUploadBuffer(Surface& surface, std::size_t size) override;
+
+    void UploadFromBuffer(Surface& surface, std::size_t size) override;
+
 private:
     GLuint FetchPBO(std::size_t buffer_size);
 
+    /// Blits drawing a quad, used when glBlitFramebuffer can't convert between the formats.
+    bool ShaderBlit(View& src_view, View& dst_view,
+                    const Tegra::Engines::Fermi2D::Config& copy_config);
+
+    /// Returns the blit program for a source and destination component type pair.
+    const OGLProgram& GetBlitProgram(std::size_t src_component, std::size_t dst_component);
+
     OGLFramebuffer src_framebuffer;
     OGLFramebuffer dst_framebuffer;
+    OGLVertexArray blit_vertex_array;
+    std::array<OGLSampler, 2> blit_samplers; ///< Nearest and linear samplers.
+    std::array<OGLProgram, 16> blit_programs;
     std::unordered_map<u32, OGLBuffer> copy_pbo_cache;
+
+    OGLUploadHeap upload_heap;
+    GLintptr upload_offset = 0;
 };
 
 } // namespace OpenGL
@@ -0,0 +1,86 @@
+// Copyright 2019 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include "common/alignment.h"
+#include "common/assert.h"
+#include "common/microprofile.h"
+#include "video_core/renderer_opengl/gl_upload_heap.h"
+
+MICROPROFILE_DEFINE(OpenGL_UploadHeapWait, "OpenGL", "Upload Heap Wait", MP_RGB(128, 128, 192));
+
+namespace OpenGL {
+
+OGLUploadHeap::OGLUploadHeap(GLsizeiptr size)
+    : buffer_size{size}, region_size{size / static_cast<GLsizeiptr>(NUM_REGIONS)} {
+    ASSERT(size % NUM_REGIONS == 0);
+    gl_buffer.Create();
+
+    const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT;
+    glNamedBufferStorage(gl_buffer.handle, buffer_size, nullptr, flags);
+    mapped_ptr = static_cast<u8*>(glMapNamedBufferRange(gl_buffer.handle, 0, buffer_size,
+                                                        flags | GL_MAP_FLUSH_EXPLICIT_BIT));
+}
+
+OGLUploadHeap::~OGLUploadHeap() {
+    glUnmapNamedBuffer(gl_buffer.handle);
+    gl_buffer.Release();
+}
+
+std::pair<u8*, GLintptr> OGLUploadHeap::Map(GLsizeiptr size, GLintptr alignment) {
+    ASSERT(size > 0 && size <= buffer_size);
+    mapped_size = size;
+
+    if (alignment > 0) {
+        iterator = Common::AlignUp<std::size_t>(iterator, alignment);
+    }
+    if (iterator + size > buffer_size) {
+        // The chunk doesn't fit at the end, fence what is left and start over.
+        FenceRegions(GetRegion(used_iterator), NUM_REGIONS);
+        iterator = 0;
+        used_iterator = 0;
+    }
+
+    // Commands reading from the chunks allocated so far have been issued, fence the regions the
+    // allocator has moved past.
+    const std::size_t begin_region = GetRegion(iterator);
+    FenceRegions(GetRegion(used_iterator), begin_region);
+    used_iterator = static_cast<GLintptr>(begin_region) * region_size;
+
+    WaitRegions(begin_region, GetRegion(iterator + size - 1) + 1);
+
+    return {mapped_ptr + iterator, iterator};
+}
+
+void OGLUploadHeap::Unmap(GLsizeiptr size) {
+    ASSERT(size <= mapped_size);
+    if (size > 0) {
+        glFlushMappedNamedBufferRange(gl_buffer.handle, iterator, size);
+    }
+    iterator += size;
+}
+
+void OGLUploadHeap::FenceRegions(std::size_t begin, std::size_t end) {
+    for (std::size_t region = begin; region < end; ++region) {
+        fences[region].Release();
+        fences[region].Create();
+    }
+}
+
+void OGLUploadHeap::WaitRegions(std::size_t begin, std::size_t end) {
+    for (std::size_t region = begin; region < end; ++region) {
+        OGLSync& fence = fences[region];
+        if (fence.handle == 0) {
+            continue;
+        }
+        MICROPROFILE_SCOPE(OpenGL_UploadHeapWait);
+        GLenum result;
+        do {
+            result = glClientWaitSync(fence.handle, GL_SYNC_FLUSH_COMMANDS_BIT, 1'000'000'000);
+        } while (result == GL_TIMEOUT_EXPIRED);
+        ASSERT(result != GL_WAIT_FAILED);
+        fence.Release();
+    }
+}
+
+} // namespace OpenGL
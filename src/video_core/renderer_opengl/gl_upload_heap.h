@@ -0,0 +1,70 @@
+// Copyright 2019 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <utility>
+#include <glad/glad.h>
+#include "common/common_types.h"
+#include "video_core/renderer_opengl/gl_resource_manager.h"
+
+namespace OpenGL {
+
+/**
+ * Persistently mapped pixel unpack buffer allocated as a ring. The buffer is split in regions that
+ * are fenced once the allocator moves past them, and allocations wait for the fence of the regions
+ * they reuse. This allows writing guest data directly into memory the driver can copy from.
+ */
+class OGLUploadHeap : private NonCopyable {
+public:
+    explicit OGLUploadHeap(GLsizeiptr size);
+    ~OGLUploadHeap();
+
+    GLuint GetHandle() const {
+        return gl_buffer.handle;
+    }
+
+    GLsizeiptr GetSize() const {
+        return buffer_size;
+    }
+
+    /*
+     * Allocates a linear chunk of memory in the heap with at least "size" bytes and the given
+     * alignment, waiting for the GPU to finish reading it if it was used in a previous cycle.
+     * The return values are the pointer to the chunk and its offset within the buffer.
+     * The actual used size must be specified on unmapping the chunk.
+     */
+    std::pair<u8*, GLintptr> Map(GLsizeiptr size, GLintptr alignment);
+
+    /// Makes the written chunk visible to the GPU. Commands reading it must be issued after this.
+    void Unmap(GLsizeiptr size);
+
+private:
+    static constexpr std::size_t NUM_REGIONS = 16;
+
+    /// Returns the region an offset belongs to.
+    std::size_t GetRegion(GLintptr offset) const {
+        return static_cast<std::size_t>(offset / region_size);
+    }
+
+    /// Fences regions in the [begin, end) range, they will be reused after the GPU signals them.
+    void FenceRegions(std::size_t begin, std::size_t end);
+
+    /// Waits for the fences of regions in the [begin, end) range.
+    void WaitRegions(std::size_t begin, std::size_t end);
+
+    OGLBuffer gl_buffer;
+    std::array<OGLSync, NUM_REGIONS> fences;
+
+    GLsizeiptr buffer_size = 0;
+    GLsizeiptr region_size = 0;
+    GLintptr iterator = 0;      ///< Offset where the next chunk will be allocated.
+    GLintptr used_iterator = 0; ///< Offset where the chunks pending to be fenced start.
+    GLsizeiptr mapped_size = 0;
+    u8* mapped_ptr = nullptr;
+};
+
+} // namespace OpenGL
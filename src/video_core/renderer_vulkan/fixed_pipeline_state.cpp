@@ -292,4 +292,24 @@ FixedPipelineState GetFixedPipelineState(const Maxwell& regs) {
     return fixed_state;
 }
 
+void UpdateFixedPipelineState(Tegra::Engines::Maxwell3D::DirtyState& dirty, const Maxwell& regs,
+                              FixedPipelineState& fixed_state) {
+    using namespace VideoCommon::Dirty;
+    if (dirty.Consume(InputAssembly)) {
+        fixed_state.input_assembly = GetInputAssemblyState(regs);
+    }
+    if (dirty.Consume(Tessellation)) {
+        fixed_state.tessellation = GetTessellationState(regs);
+    }
+    if (dirty.Consume(RasterizerState)) {
+        fixed_state.rasterizer = GetRasterizerState(regs);
+    }
+    if (dirty.Consume(DepthStencilState)) {
+        fixed_state.depth_stencil = GetDepthStencilState(regs);
+    }
+    if (dirty.Consume(ColorBlending)) {
+        fixed_state.color_blending = GetColorBlendingState(regs);
+    }
+}
+
 } // namespace Vulkan
@@ -217,6 +217,10 @@ static_assert(std::is_trivially_copyable_v<FixedPipelineState>);
 
 FixedPipelineState GetFixedPipelineState(const Maxwell& regs);
 
+/// Rebuilds the groups of a fixed pipeline state whose registers changed since the last update.
+void UpdateFixedPipelineState(Tegra::Engines::Maxwell3D::DirtyState& dirty, const Maxwell& regs,
+                              FixedPipelineState& fixed_state);
+
 } // namespace Vulkan
 
 namespace std {
@@ -167,6 +167,11 @@ public:
         return nv_device_diagnostic_checkpoints;
     }
 
+    /// Returns true if the device supports VK_KHR_timeline_semaphore.
+    bool IsKhrTimelineSemaphoreSupported() const {
+        return khr_timeline_semaphore;
+    }
+
     /// Returns the vendor name reported from Vulkan.
     std::string_view GetVendorName() const {
         return vendor_name;
@@ -227,6 +232,7 @@ private:
     bool ext_depth_range_unrestricted{};       ///< Support for VK_EXT_depth_range_unrestricted.
     bool ext_shader_viewport_index_layer{};    ///< Support for VK_EXT_shader_viewport_index_layer.
     bool nv_device_diagnostic_checkpoints{};   ///< Support for VK_NV_device_diagnostic_checkpoints.
+    bool khr_timeline_semaphore{};             ///< Support for VK_KHR_timeline_semaphore.
 
     // Telemetry parameters
     std::string vendor_name;                      ///< Device's driver name.
@@ -0,0 +1,120 @@
+// Copyright 2019 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include "common/assert.h"
+#include "video_core/renderer_vulkan/declarations.h"
+#include "video_core/renderer_vulkan/vk_device.h"
+#include "video_core/renderer_vulkan/vk_master_semaphore.h"
+
+namespace Vulkan {
+
+VKMasterSemaphore::VKMasterSemaphore(const VKDevice& device) : device{device} {
+    if (!device.IsKhrTimelineSemaphoreSupported()) {
+        return;
+    }
+    const vk::SemaphoreTypeCreateInfoKHR semaphore_type_ci(vk::SemaphoreTypeKHR::eTimeline, 0);
+    vk::SemaphoreCreateInfo semaphore_ci;
+    semaphore_ci.pNext = &semaphore_type_ci;
+    timeline = device.GetLogical().createSemaphoreUnique(semaphore_ci, nullptr,
+                                                         device.GetDispatchLoader());
+}
+
+VKMasterSemaphore::~VKMasterSemaphore() = default;
+
+void VKMasterSemaphore::Refresh() {
+    if (!timeline) {
+        RetireFences(0);
+        return;
+    }
+    const auto dev = device.GetLogical();
+    gpu_tick = dev.getSemaphoreCounterValueKHR(*timeline, device.GetDispatchLoader());
+}
+
+void VKMasterSemaphore::Wait(u64 tick) {
+    ASSERT_MSG(tick < current_tick, "Waiting for a tick that has not been submitted");
+    if (IsFree(tick)) {
+        return;
+    }
+    if (!timeline) {
+        RetireFences(tick);
+        return;
+    }
+    const auto dev = device.GetLogical();
+    const vk::SemaphoreWaitInfoKHR wait_info({}, 1, &*timeline, &tick);
+    switch (const auto result = dev.waitSemaphoresKHR(&wait_info, std::numeric_limits<u64>::max(),
+                                                      device.GetDispatchLoader())) {
+    case vk::Result::eSuccess:
+        gpu_tick = std::max(gpu_tick, tick);
+        return;
+    case vk::Result::eErrorDeviceLost:
+        device.ReportLoss();
+        [[fallthrough]];
+    default:
+        vk::throwResultException(result, "vk::waitSemaphoresKHR");
+    }
+}
+
+void VKMasterSemaphore::Submit(vk::Queue queue, vk::CommandBuffer cmdbuf,
+                               vk::Semaphore semaphore, vk::Fence fence) {
+    const auto& dld = device.GetDispatchLoader();
+    const u64 tick = current_tick++;
+    if (timeline) {
+        const std::array signal_semaphores{*timeline, semaphore};
+        const std::array<u64, 2> signal_values{tick, 0};
+        const u32 num_signal_semaphores = semaphore ? 2U : 1U;
+        const vk::TimelineSemaphoreSubmitInfoKHR timeline_si(0, nullptr, num_signal_semaphores,
+                                                             signal_values.data());
+        vk::SubmitInfo submit_info(0, nullptr, nullptr, 1, &cmdbuf, num_signal_semaphores,
+                                   signal_semaphores.data());
+        submit_info.pNext = &timeline_si;
+        queue.submit({submit_info}, fence, dld);
+        return;
+    }
+
+    const vk::SubmitInfo submit_info(0, nullptr, nullptr, 1, &cmdbuf, semaphore ? 1U : 0U,
+                                     &semaphore);
+    queue.submit({submit_info}, fence, dld);
+
+    // An empty submission signals its fence once all the work previously submitted to the queue
+    // has completed, emulating a timeline semaphore signal.
+    const vk::Fence tick_fence = CommitFence();
+    const vk::Result result = queue.submit(0, nullptr, tick_fence, dld);
+    ASSERT(result == vk::Result::eSuccess);
+    pending_fences.emplace_back(tick, tick_fence);
+}
+
+vk::Fence VKMasterSemaphore::CommitFence() {
+    if (!free_fences.empty()) {
+        const vk::Fence fence = free_fences.back();
+        free_fences.pop_back();
+        return fence;
+    }
+    const vk::FenceCreateInfo fence_ci;
+    const auto dev = device.GetLogical();
+    const auto& dld = device.GetDispatchLoader();
+    return *fences.emplace_back(dev.createFenceUnique(fence_ci, nullptr, dld));
+}
+
+void VKMasterSemaphore::RetireFences(u64 wait_tick) {
+    const auto dev = device.GetLogical();
+    const auto& dld = device.GetDispatchLoader();
+    while (!pending_fences.empty()) {
+        const auto [tick, fence] = pending_fences.front();
+        if (tick <= wait_tick) {
+            dev.waitForFences({fence}, true, std::numeric_limits<u64>::max(), dld);
+        } else if (dev.getFenceStatus(fence, dld) != vk::Result::eSuccess) {
+            // Fences are signaled in submission order, later fences can't be ready either.
+            break;
+        }
+        dev.resetFences({fence}, dld);
+        free_fences.push_back(fence);
+        pending_fences.pop_front();
+        gpu_tick = tick;
+    }
+}
+
+} // namespace Vulkan
@@ -0,0 +1,76 @@
+// Copyright 2019 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <deque>
+#include <utility>
+#include <vector>
+#include "common/common_types.h"
+#include "video_core/renderer_vulkan/declarations.h"
+
+namespace Vulkan {
+
+class VKDevice;
+
+/**
+ * Tracks GPU progress with a single monotonically increasing tick, advanced once per submission.
+ * Resources record the tick they were last used at and are free to be reused once the GPU has
+ * signaled that tick. When VK_KHR_timeline_semaphore is available the tick is the value of a
+ * timeline semaphore, otherwise it is emulated with a fence submitted after each command buffer.
+ */
+class VKMasterSemaphore final {
+public:
+    explicit VKMasterSemaphore(const VKDevice& device);
+    ~VKMasterSemaphore();
+
+    /// Returns the tick the next submission will signal.
+    u64 CurrentTick() const noexcept {
+        return current_tick;
+    }
+
+    /// Returns the last tick known to be signaled by the GPU.
+    u64 KnownGpuTick() const noexcept {
+        return gpu_tick;
+    }
+
+    /// Returns true when the GPU is known to have signaled the tick.
+    bool IsFree(u64 tick) const noexcept {
+        return gpu_tick >= tick;
+    }
+
+    /// Queries the GPU for the last signaled tick.
+    void Refresh();
+
+    /// Waits for the GPU to signal the tick. The tick has to be already submitted.
+    void Wait(u64 tick);
+
+    /**
+     * Submits a command buffer that signals the current tick and advances it.
+     * @param queue Queue to submit to.
+     * @param cmdbuf Command buffer to execute.
+     * @param semaphore Optional binary semaphore to signal.
+     * @param fence Fence to signal.
+     */
+    void Submit(vk::Queue queue, vk::CommandBuffer cmdbuf, vk::Semaphore semaphore,
+                vk::Fence fence);
+
+private:
+    /// Returns a fence ready to be submitted, used when timeline semaphores are not available.
+    vk::Fence CommitFence();
+
+    /// Releases fences in submission order until one is not signaled or wait_tick is reached.
+    void RetireFences(u64 wait_tick);
+
+    const VKDevice& device;   ///< Device handler.
+    UniqueSemaphore timeline; ///< Timeline semaphore, null when it is not supported.
+    u64 gpu_tick = 0;         ///< Last tick known to be signaled by the GPU.
+    u64 current_tick = 1;     ///< Tick the next submission will signal.
+
+    std::deque<std::pair<u64, vk::Fence>> pending_fences; ///< Submitted fences and their ticks.
+    std::vector<vk::Fence> free_fences;                   ///< Fences ready to be reused.
+    std::vector<UniqueFence> fences;                      ///< Fences owned by this object.
+};
+
+} // namespace Vulkan
@@ -171,12 +171,10 @@ VKPipelineCache::VKPipelineCache(Core::System& system, RasterizerVulkan& rasteri
 VKPipelineCache::~VKPipelineCache() = default;
 
 std::array<Shader, Maxwell::MaxShaderProgram> VKPipelineCache::GetShaders() {
-    const auto& gpu = system.GPU().Maxwell3D();
-    auto& dirty = system.GPU().Maxwell3D().dirty.shaders;
-    if (!dirty) {
+    auto& gpu = system.GPU().Maxwell3D();
+    if (!gpu.dirty.Consume(VideoCommon::Dirty::Shaders)) {
         return last_shaders;
     }
-    dirty = false;
 
     std::array<Shader, Maxwell::MaxShaderProgram> shaders;
     for (std::size_t index = 0; index < Maxwell::MaxShaderProgram; ++index) {
@@ -251,7 +251,7 @@ RasterizerVulkan::RasterizerVulkan(Core::System& system, Core::Frontend::EmuWind
       quad_array_pass(device, scheduler, descriptor_pool, staging_pool, update_descriptor_queue),
       uint8_pass(device, scheduler, descriptor_pool, staging_pool, update_descriptor_queue),
       texture_cache(system, *this, device, resource_manager, memory_manager, scheduler,
-                    staging_pool),
+                    staging_pool, descriptor_pool, update_descriptor_queue),
       pipeline_cache(system, *this, device, scheduler, descriptor_pool, update_descriptor_queue),
       buffer_cache(*this, system, device, memory_manager, scheduler, staging_pool),
       sampler_cache(device) {}
@@ -273,8 +273,9 @@ void RasterizerVulkan::Draw(bool is_indexed, bool is_instanced) {
 
     FlushWork();
 
-    const auto& gpu = system.GPU().Maxwell3D();
-    GraphicsPipelineCacheKey key{GetFixedPipelineState(gpu.regs)};
+    auto& gpu = system.GPU().Maxwell3D();
+    UpdateFixedPipelineState(gpu.dirty, gpu.regs, fixed_state);
+    GraphicsPipelineCacheKey key{fixed_state};
 
     buffer_cache.Map(CalculateGraphicsStreamBufferSize(is_indexed));
 
@@ -460,6 +461,7 @@ void RasterizerVulkan::FlushCommands() {
 }
 
 void RasterizerVulkan::TickFrame() {
+    system.GPU().Maxwell3D().dirty.EndFrame();
     draw_counter = 0;
     update_descriptor_queue.TickFrame();
     buffer_cache.TickFrame();
@@ -469,8 +471,11 @@ void RasterizerVulkan::TickFrame() {
 bool RasterizerVulkan::AccelerateSurfaceCopy(const Tegra::Engines::Fermi2D::Regs::Surface& src,
                                              const Tegra::Engines::Fermi2D::Regs::Surface& dst,
                                              const Tegra::Engines::Fermi2D::Config& copy_config) {
-    texture_cache.DoFermiCopy(src, dst, copy_config);
-    return true;
+    return texture_cache.DoFermiCopy(src, dst, copy_config);
+}
+
+bool RasterizerVulkan::AccelerateDMA(const Tegra::Engines::MaxwellDMA::Regs& regs) {
+    return texture_cache.DoDMACopy(regs);
 }
 
 bool RasterizerVulkan::AccelerateDisplay(const Tegra::FramebufferConfig& config,
@@ -517,8 +522,7 @@ void RasterizerVulkan::FlushWork() {
 RasterizerVulkan::Texceptions RasterizerVulkan::UpdateAttachments() {
     MICROPROFILE_SCOPE(Vulkan_RenderTargets);
     auto& dirty = system.GPU().Maxwell3D().dirty;
-    const bool update_rendertargets = dirty.render_settings;
-    dirty.render_settings = false;
+    const bool update_rendertargets = dirty.Consume(VideoCommon::Dirty::RenderTargets);
 
     texture_cache.GuardRenderTargets(true);
 
@@ -922,10 +926,9 @@ void RasterizerVulkan::SetupImage(const Tegra::Texture::TICEntry& tic, const Ima
 }
 
 void RasterizerVulkan::UpdateViewportsState(Tegra::Engines::Maxwell3D& gpu) {
-    if (!gpu.dirty.viewport_transform && scheduler.TouchViewports()) {
+    if (!gpu.dirty.Consume(VideoCommon::Dirty::Viewports) && scheduler.TouchViewports()) {
         return;
     }
-    gpu.dirty.viewport_transform = false;
     const auto& regs = gpu.regs;
     const std::array viewports{
         GetViewportState(device, regs, 0),  GetViewportState(device, regs, 1),
@@ -942,10 +945,9 @@ void RasterizerVulkan::UpdateViewportsState(Tegra::Engines::Maxwell3D& gpu) {
 }
 
 void RasterizerVulkan::UpdateScissorsState(Tegra::Engines::Maxwell3D& gpu) {
-    if (!gpu.dirty.scissor_test && scheduler.TouchScissors()) {
+    if (!gpu.dirty.Consume(VideoCommon::Dirty::Scissors) && scheduler.TouchScissors()) {
         return;
     }
-    gpu.dirty.scissor_test = false;
     const auto& regs = gpu.regs;
     const std::array scissors = {
         GetScissorState(regs, 0),  GetScissorState(regs, 1),  GetScissorState(regs, 2),
@@ -960,10 +962,9 @@ void RasterizerVulkan::UpdateScissorsState(Tegra::Engines::Maxwell3D& gpu) {
 }
 
 void RasterizerVulkan::UpdateDepthBias(Tegra::Engines::Maxwell3D& gpu) {
-    if (!gpu.dirty.polygon_offset && scheduler.TouchDepthBias()) {
+    if (!gpu.dirty.Consume(VideoCommon::Dirty::PolygonOffset) && scheduler.TouchDepthBias()) {
         return;
     }
-    gpu.dirty.polygon_offset = false;
     const auto& regs = gpu.regs;
     scheduler.Record([constant = regs.polygon_offset_units, clamp = regs.polygon_offset_clamp,
                       factor = regs.polygon_offset_factor](auto cmdbuf, auto& dld) {
@@ -972,10 +973,9 @@ void RasterizerVulkan::UpdateDepthBias(Tegra::Engines::Maxwell3D& gpu) {
 }
 
 void RasterizerVulkan::UpdateBlendConstants(Tegra::Engines::Maxwell3D& gpu) {
-    if (!gpu.dirty.blend_state && scheduler.TouchBlendConstants()) {
+    if (!gpu.dirty.Consume(VideoCommon::Dirty::BlendState) && scheduler.TouchBlendConstants()) {
         return;
     }
-    gpu.dirty.blend_state = false;
     const std::array blend_color = {gpu.regs.blend_color.r, gpu.regs.blend_color.g,
                                     gpu.regs.blend_color.b, gpu.regs.blend_color.a};
     scheduler.Record([blend_color](auto cmdbuf, auto& dld) {
@@ -984,20 +984,19 @@ void RasterizerVulkan::UpdateBlendConstants(Tegra::Engines::Maxwell3D& gpu) {
 }
 
 void RasterizerVulkan::UpdateDepthBounds(Tegra::Engines::Maxwell3D& gpu) {
-    if (!gpu.dirty.depth_bounds_values && scheduler.TouchDepthBounds()) {
+    if (!gpu.dirty.Consume(VideoCommon::Dirty::DepthBoundsValues) &&
+        scheduler.TouchDepthBounds()) {
         return;
     }
-    gpu.dirty.depth_bounds_values = false;
     const auto& regs = gpu.regs;
     scheduler.Record([min = regs.depth_bounds[0], max = regs.depth_bounds[1]](
                          auto cmdbuf, auto& dld) { cmdbuf.setDepthBounds(min, max, dld); });
 }
 
 void RasterizerVulkan::UpdateStencilFaces(Tegra::Engines::Maxwell3D& gpu) {
-    if (!gpu.dirty.stencil_test && scheduler.TouchStencilValues()) {
+    if (!gpu.dirty.Consume(VideoCommon::Dirty::StencilTest) && scheduler.TouchStencilValues()) {
         return;
     }
-    gpu.dirty.stencil_test = false;
     const auto& regs = gpu.regs;
     if (regs.stencil_two_side_enable) {
         // Separate values per face
@@ -115,6 +115,7 @@ public:
     bool AccelerateSurfaceCopy(const Tegra::Engines::Fermi2D::Regs::Surface& src,
                                const Tegra::Engines::Fermi2D::Regs::Surface& dst,
                                const Tegra::Engines::Fermi2D::Config& copy_config) override;
+    bool AccelerateDMA(const Tegra::Engines::MaxwellDMA::Regs& regs) override;
     bool AccelerateDisplay(const Tegra::FramebufferConfig& config, VAddr framebuffer_addr,
                            u32 pixel_stride) override;
 
@@ -246,6 +247,9 @@ private:
     VKBufferCache buffer_cache;
     VKSamplerCache sampler_cache;
 
+    /// Fixed function state of the last draw, only the groups that changed are rebuilt.
+    FixedPipelineState fixed_state;
+
     std::array<View, Maxwell::NumRenderTargets> color_attachments;
     View zeta_attachment;
 
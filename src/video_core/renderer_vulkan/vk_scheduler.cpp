@@ -29,8 +29,8 @@ void VKScheduler::CommandChunk::ExecuteAll(vk::CommandBuffer cmdbuf,
 }
 
 VKScheduler::VKScheduler(const VKDevice& device, VKResourceManager& resource_manager)
-    : device{device}, resource_manager{resource_manager}, next_fence{
-                                                              &resource_manager.CommitFence()} {
+    : device{device}, resource_manager{resource_manager}, master_semaphore{device},
+      next_fence{&resource_manager.CommitFence()} {
     AcquireNewChunk();
     AllocateNewContext();
     worker_thread = std::thread(&VKScheduler::WorkerThread, this);
@@ -59,6 +59,14 @@ void VKScheduler::Finish(bool release_fence, vk::Semaphore semaphore) {
     AllocateNewContext();
 }
 
+void VKScheduler::Wait(u64 tick) {
+    if (tick >= master_semaphore.CurrentTick()) {
+        // Make sure the tick is submitted before waiting for it.
+        Flush();
+    }
+    master_semaphore.Wait(tick);
+}
+
 void VKScheduler::WaitWorker() {
     MICROPROFILE_SCOPE(Vulkan_WaitForWorker);
     DispatchWork();
@@ -129,13 +137,9 @@ void VKScheduler::SubmitExecution(vk::Semaphore semaphore) {
 
     std::unique_lock lock{mutex};
 
-    const auto queue = device.GetGraphicsQueue();
-    const auto& dld = device.GetDispatchLoader();
-    current_cmdbuf.end(dld);
-
-    const vk::SubmitInfo submit_info(0, nullptr, nullptr, 1, &current_cmdbuf, semaphore ? 1U : 0U,
-                                     &semaphore);
-    queue.submit({submit_info}, static_cast<vk::Fence>(*current_fence), dld);
+    current_cmdbuf.end(device.GetDispatchLoader());
+    master_semaphore.Submit(device.GetGraphicsQueue(), current_cmdbuf, semaphore,
+                            static_cast<vk::Fence>(*current_fence));
 }
 
 void VKScheduler::AllocateNewContext() {
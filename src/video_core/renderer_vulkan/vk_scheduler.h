@@ -13,6 +13,7 @@
 #include "common/common_types.h"
 #include "common/threadsafe_queue.h"
 #include "video_core/renderer_vulkan/declarations.h"
+#include "video_core/renderer_vulkan/vk_master_semaphore.h"
 
 namespace Vulkan {
 
@@ -67,6 +68,10 @@ public:
     /// Binds a pipeline to the current execution context.
     void BindGraphicsPipeline(vk::Pipeline pipeline);
 
+    /// Forgets the tracked pipeline and dynamic states, forcing them to be set again. Used after
+    /// recording commands that change them behind the scheduler's back.
+    void InvalidateState();
+
     /// Returns true when viewports have been set in the current command buffer.
     bool TouchViewports() {
         return std::exchange(state.viewports, true);
@@ -112,6 +117,24 @@ public:
         return current_fence;
     }
 
+    /// Returns the tick signaled by the current command buffer once it's executed.
+    u64 CurrentTick() const noexcept {
+        return master_semaphore.CurrentTick();
+    }
+
+    /// Returns true when the GPU is known to have finished executing a tick.
+    bool IsFree(u64 tick) const noexcept {
+        return master_semaphore.IsFree(tick);
+    }
+
+    /// Queries the GPU for the last tick it has finished executing.
+    void Refresh() {
+        master_semaphore.Refresh();
+    }
+
+    /// Waits for a tick to be executed by the GPU, submitting the current work if needed.
+    void Wait(u64 tick);
+
 private:
     class Command {
     public:
@@ -195,8 +218,6 @@ private:
 
     void AllocateNewContext();
 
-    void InvalidateState();
-
     void EndPendingOperations();
 
     void EndRenderPass();
@@ -205,6 +226,7 @@ private:
 
     const VKDevice& device;
     VKResourceManager& resource_manager;
+    VKMasterSemaphore master_semaphore;
     vk::CommandBuffer current_cmdbuf;
     VKFence* current_fence = nullptr;
     VKFence* next_fence = nullptr;
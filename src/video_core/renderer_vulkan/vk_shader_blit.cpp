@@ -0,0 +1,452 @@
+// Copyright 2019 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <array>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <sirit/sirit.h>
+
+#include "common/assert.h"
+#include "common/common_types.h"
+#include "common/math_util.h"
+#include "video_core/renderer_vulkan/declarations.h"
+#include "video_core/renderer_vulkan/vk_descriptor_pool.h"
+#include "video_core/renderer_vulkan/vk_device.h"
+#include "video_core/renderer_vulkan/vk_renderpass_cache.h"
+#include "video_core/renderer_vulkan/vk_scheduler.h"
+#include "video_core/renderer_vulkan/vk_shader_blit.h"
+#include "video_core/renderer_vulkan/vk_texture_cache.h"
+#include "video_core/renderer_vulkan/vk_update_descriptor.h"
+
+namespace Vulkan {
+
+namespace {
+
+using Sirit::Id;
+
+/// Size of the push constants, the source rectangle as a vec4.
+constexpr u32 PUSH_CONSTANTS_SIZE = 4 * sizeof(f32);
+
+/// Types and helpers shared by the blit shaders.
+class BlitShaderModule : public Sirit::Module {
+protected:
+    BlitShaderModule() : Module(0x00010300) {
+        AddCapability(spv::Capability::Shader);
+    }
+
+    Id DeclareVariable(Id type, spv::StorageClass storage, std::string name) {
+        const Id id = OpVariable(TypePointer(storage, type), storage);
+        AddGlobalVariable(Name(id, std::move(name)));
+        return id;
+    }
+
+    const Id t_void = Name(TypeVoid(), "void");
+
+    const Id t_int = Name(TypeInt(32, true), "int");
+    const Id t_int2 = Name(TypeVector(t_int, 2), "int2");
+    const Id t_int4 = Name(TypeVector(t_int, 4), "int4");
+
+    const Id t_uint = Name(TypeInt(32, false), "uint");
+    const Id t_uint4 = Name(TypeVector(t_uint, 4), "uint4");
+
+    const Id t_float = Name(TypeFloat(32), "float");
+    const Id t_float2 = Name(TypeVector(t_float, 2), "float2");
+    const Id t_float4 = Name(TypeVector(t_float, 4), "float4");
+};
+
+/// Draws a triangle strip of four vertices covering the viewport, with texture coordinates going
+/// from zero to one.
+class BlitVertexShader final : public BlitShaderModule {
+public:
+    BlitVertexShader() {
+        const Id vertex_index = DeclareVariable(t_int, spv::StorageClass::Input, "vertex_index");
+        Decorate(vertex_index, spv::Decoration::BuiltIn,
+                 static_cast<u32>(spv::BuiltIn::VertexIndex));
+        const Id position = DeclareVariable(t_float4, spv::StorageClass::Output, "position");
+        Decorate(position, spv::Decoration::BuiltIn, static_cast<u32>(spv::BuiltIn::Position));
+        const Id tex_coord = DeclareVariable(t_float2, spv::StorageClass::Output, "tex_coord");
+        Decorate(tex_coord, spv::Decoration::Location, 0U);
+
+        const Id main = OpFunction(t_void, {}, TypeFunction(t_void));
+        AddLabel();
+
+        // position = vec2(gl_VertexIndex & 1, gl_VertexIndex >> 1)
+        const Id index = OpLoad(t_int, vertex_index);
+        const Id x = OpConvertSToF(t_float, OpBitwiseAnd(t_int, index, Constant(t_int, 1)));
+        const Id y =
+            OpConvertSToF(t_float, OpShiftRightArithmetic(t_int, index, Constant(t_int, 1)));
+        OpStore(tex_coord, OpCompositeConstruct(t_float2, x, y));
+
+        // gl_Position = vec4(position * 2.0 - 1.0, 0.0, 1.0)
+        const Id two = Constant(t_float, 2.0f);
+        const Id minus_one = Constant(t_float, -1.0f);
+        const Id ndc_x = OpFAdd(t_float, OpFMul(t_float, x, two), minus_one);
+        const Id ndc_y = OpFAdd(t_float, OpFMul(t_float, y, two), minus_one);
+        OpStore(position, OpCompositeConstruct(t_float4, ndc_x, ndc_y, Constant(t_float, 0.0f),
+                                               Constant(t_float, 1.0f)));
+
+        OpReturn();
+        OpFunctionEnd();
+
+        AddEntryPoint(spv::ExecutionModel::Vertex, main, "main",
+                      std::vector<Id>{vertex_index, position, tex_coord});
+    }
+};
+
+/// Reads the source texel of each fragment and writes it converted to the destination component.
+class BlitFragmentShader final : public BlitShaderModule {
+public:
+    BlitFragmentShader(BlitComponent src_component, BlitComponent dst_component) {
+        AddCapability(spv::Capability::ImageQuery);
+
+        const Id src_type = GetScalarType(src_component);
+        const Id src_vector = GetVectorType(src_component);
+        const Id image_type =
+            TypeImage(src_type, spv::Dim::Dim2D, 0, 0, false, 1, spv::ImageFormat::Unknown);
+        const Id sampled_image_type = TypeSampledImage(image_type);
+        const Id src_texture =
+            DeclareVariable(sampled_image_type, spv::StorageClass::UniformConstant, "src_texture");
+        Decorate(src_texture, spv::Decoration::Binding, 0U);
+        Decorate(src_texture, spv::Decoration::DescriptorSet, 0U);
+
+        // Source rectangle, offset in xy and size in zw.
+        const Id push_block = MemberDecorate(Decorate(TypeStruct(t_float4), spv::Decoration::Block),
+                                             0, spv::Decoration::Offset, 0);
+        const Id push_constants =
+            DeclareVariable(push_block, spv::StorageClass::PushConstant, "push_constants");
+
+        const Id tex_coord = DeclareVariable(t_float2, spv::StorageClass::Input, "tex_coord");
+        Decorate(tex_coord, spv::Decoration::Location, 0U);
+
+        const bool is_depth = dst_component == BlitComponent::Depth;
+        Id output;
+        if (is_depth) {
+            output = DeclareVariable(t_float, spv::StorageClass::Output, "frag_depth");
+            Decorate(output, spv::Decoration::BuiltIn, static_cast<u32>(spv::BuiltIn::FragDepth));
+        } else {
+            output = DeclareVariable(GetVectorType(dst_component), spv::StorageClass::Output,
+                                     "color");
+            Decorate(output, spv::Decoration::Location, 0U);
+        }
+
+        const Id main = OpFunction(t_void, {}, TypeFunction(t_void));
+        AddLabel();
+
+        // src_rect.xy + tex_coord * src_rect.zw
+        const Id src_rect = OpLoad(
+            t_float4, OpAccessChain(TypePointer(spv::StorageClass::PushConstant, t_float4),
+                                    push_constants, Constant(t_uint, 0U)));
+        const Id coord = OpLoad(t_float2, tex_coord);
+        const auto Extract = [this](Id composite, u32 element) {
+            return OpCompositeExtract(t_float, composite, element);
+        };
+        const Id x = OpFAdd(t_float, Extract(src_rect, 0),
+                            OpFMul(t_float, Extract(coord, 0), Extract(src_rect, 2)));
+        const Id y = OpFAdd(t_float, Extract(src_rect, 1),
+                            OpFMul(t_float, Extract(coord, 1), Extract(src_rect, 3)));
+
+        const Id sampled_image = OpLoad(sampled_image_type, src_texture);
+        Id texel;
+        if (src_component == BlitComponent::Uint || src_component == BlitComponent::Sint) {
+            // Integer textures can't be filtered, fetch the texel directly
+            const Id coords = OpCompositeConstruct(t_int2, OpConvertFToS(t_int, x),
+                                                   OpConvertFToS(t_int, y));
+            texel = OpImageFetch(src_vector, OpImage(image_type, sampled_image), coords,
+                                 spv::ImageOperandsMask::Lod, Constant(t_int, 0));
+        } else {
+            const Id size = OpImageQuerySizeLod(t_int2, OpImage(image_type, sampled_image),
+                                                Constant(t_int, 0));
+            const Id coords = OpFDiv(t_float2, OpCompositeConstruct(t_float2, x, y),
+                                     OpConvertSToF(t_float2, size));
+            const std::vector<Id> operands{Constant(t_float, 0.0f)};
+            texel = OpImageSampleExplicitLod(t_float4, sampled_image, coords,
+                                             spv::ImageOperandsMask::Lod, operands);
+        }
+        OpStore(output, ConvertTexel(texel, src_component, dst_component));
+
+        OpReturn();
+        OpFunctionEnd();
+
+        AddEntryPoint(spv::ExecutionModel::Fragment, main, "main",
+                      std::vector<Id>{tex_coord, output});
+        AddExecutionMode(main, spv::ExecutionMode::OriginUpperLeft);
+        if (is_depth) {
+            AddExecutionMode(main, spv::ExecutionMode::DepthReplacing);
+        }
+    }
+
+private:
+    Id GetScalarType(BlitComponent component) const {
+        switch (component) {
+        case BlitComponent::Uint:
+            return t_uint;
+        case BlitComponent::Sint:
+            return t_int;
+        default:
+            return t_float;
+        }
+    }
+
+    Id GetVectorType(BlitComponent component) const {
+        switch (component) {
+        case BlitComponent::Uint:
+            return t_uint4;
+        case BlitComponent::Sint:
+            return t_int4;
+        default:
+            return t_float4;
+        }
+    }
+
+    /// Converts a texel by value, like the vector constructors of GLSL do.
+    Id ConvertTexel(Id texel, BlitComponent src_component, BlitComponent dst_component) {
+        const bool is_src_float =
+            src_component == BlitComponent::Float || src_component == BlitComponent::Depth;
+        switch (dst_component) {
+        case BlitComponent::Depth: {
+            const Id value = OpCompositeExtract(GetScalarType(src_component), texel, 0);
+            if (src_component == BlitComponent::Uint) {
+                return OpConvertUToF(t_float, value);
+            }
+            if (src_component == BlitComponent::Sint) {
+                return OpConvertSToF(t_float, value);
+            }
+            return value;
+        }
+        case BlitComponent::Float:
+            if (src_component == BlitComponent::Uint) {
+                return OpConvertUToF(t_float4, texel);
+            }
+            if (src_component == BlitComponent::Sint) {
+                return OpConvertSToF(t_float4, texel);
+            }
+            return texel;
+        case BlitComponent::Uint:
+            if (src_component == BlitComponent::Uint) {
+                return texel;
+            }
+            return is_src_float ? OpConvertFToU(t_uint4, texel) : OpBitcast(t_uint4, texel);
+        case BlitComponent::Sint:
+            if (src_component == BlitComponent::Sint) {
+                return texel;
+            }
+            return is_src_float ? OpConvertFToS(t_int4, texel) : OpBitcast(t_int4, texel);
+        }
+        UNREACHABLE();
+        return texel;
+    }
+};
+
+UniqueShaderModule CreateShaderModule(const VKDevice& device, const std::vector<u32>& code) {
+    const vk::ShaderModuleCreateInfo module_ci({}, code.size() * sizeof(u32), code.data());
+    return device.GetLogical().createShaderModuleUnique(module_ci, nullptr,
+                                                        device.GetDispatchLoader());
+}
+
+} // Anonymous namespace
+
+VKShaderBlit::VKShaderBlit(const VKDevice& device, VKScheduler& scheduler,
+                           VKDescriptorPool& descriptor_pool,
+                           VKUpdateDescriptorQueue& update_descriptor_queue)
+    : device{device}, scheduler{scheduler}, update_descriptor_queue{update_descriptor_queue},
+      renderpass_cache(device) {
+    const auto dev = device.GetLogical();
+    const auto& dld = device.GetDispatchLoader();
+
+    const vk::DescriptorSetLayoutBinding binding(0, vk::DescriptorType::eCombinedImageSampler, 1,
+                                                 vk::ShaderStageFlagBits::eFragment, nullptr);
+    const vk::DescriptorSetLayoutCreateInfo descriptor_layout_ci({}, 1, &binding);
+    descriptor_set_layout = dev.createDescriptorSetLayoutUnique(descriptor_layout_ci, nullptr, dld);
+
+    const vk::PushConstantRange push_constants(vk::ShaderStageFlagBits::eFragment, 0,
+                                               PUSH_CONSTANTS_SIZE);
+    const vk::PipelineLayoutCreateInfo pipeline_layout_ci({}, 1, &*descriptor_set_layout, 1,
+                                                          &push_constants);
+    layout = dev.createPipelineLayoutUnique(pipeline_layout_ci, nullptr, dld);
+
+    const vk::DescriptorUpdateTemplateEntry template_entry(
+        0, 0, 1, vk::DescriptorType::eCombinedImageSampler, 0, sizeof(DescriptorUpdateEntry));
+    const vk::DescriptorUpdateTemplateCreateInfo template_ci(
+        {}, 1, &template_entry, vk::DescriptorUpdateTemplateType::eDescriptorSet,
+        *descriptor_set_layout, vk::PipelineBindPoint::eGraphics, *layout, 0);
+    descriptor_template = dev.createDescriptorUpdateTemplateUnique(template_ci, nullptr, dld);
+    descriptor_allocator.emplace(descriptor_pool, *descriptor_set_layout);
+
+    for (std::size_t i = 0; i < samplers.size(); ++i) {
+        const vk::Filter filter = i == 0 ? vk::Filter::eNearest : vk::Filter::eLinear;
+        const vk::SamplerCreateInfo sampler_ci(
+            {}, filter, filter, vk::SamplerMipmapMode::eNearest,
+            vk::SamplerAddressMode::eClampToEdge, vk::SamplerAddressMode::eClampToEdge,
+            vk::SamplerAddressMode::eClampToEdge, 0.0f, false, 0.0f, false, vk::CompareOp::eNever,
+            0.0f, 0.0f, vk::BorderColor::eFloatTransparentBlack, false);
+        samplers[i] = dev.createSamplerUnique(sampler_ci, nullptr, dld);
+    }
+
+    vertex_shader = CreateShaderModule(device, BlitVertexShader().Assemble());
+}
+
+VKShaderBlit::~VKShaderBlit() = default;
+
+void VKShaderBlit::Blit(CachedSurfaceView& src_view, BlitComponent src_component,
+                        CachedSurfaceView& dst_view, BlitComponent dst_component,
+                        const Common::Rectangle<u32>& src_rect,
+                        const Common::Rectangle<u32>& dst_rect, bool is_linear) {
+    const bool is_depth = dst_component == BlitComponent::Depth;
+    RenderPassParams renderpass_params;
+    if (is_depth) {
+        renderpass_params.zeta_pixel_format = dst_view.GetSurfaceParams().pixel_format;
+        renderpass_params.has_zeta = true;
+    } else {
+        RenderPassParams::ColorAttachment attachment;
+        attachment.index = 0;
+        attachment.pixel_format = dst_view.GetSurfaceParams().pixel_format;
+        renderpass_params.color_attachments.push_back(attachment);
+    }
+    const vk::RenderPass renderpass = renderpass_cache.GetRenderPass(renderpass_params);
+    const vk::Pipeline pipeline = GetPipeline({renderpass, src_component, dst_component});
+    const vk::Extent2D extent(dst_view.GetWidth(), dst_view.GetHeight());
+    const vk::Framebuffer framebuffer =
+        GetFramebuffer({renderpass, dst_view.GetHandle(), extent.width, extent.height});
+
+    update_descriptor_queue.Acquire();
+    update_descriptor_queue.AddSampledImage(*samplers[is_linear ? 1 : 0], src_view.GetHandle());
+    *update_descriptor_queue.GetLastImageLayout() = vk::ImageLayout::eShaderReadOnlyOptimal;
+    const vk::DescriptorSet set = descriptor_allocator->Commit(scheduler.GetFence());
+    update_descriptor_queue.Send(*descriptor_template, set);
+
+    // Layout transitions can't be recorded inside a renderpass
+    scheduler.RequestOutsideRenderPassOperationContext();
+    src_view.Transition(vk::ImageLayout::eShaderReadOnlyOptimal,
+                        vk::PipelineStageFlagBits::eFragmentShader,
+                        vk::AccessFlagBits::eShaderRead);
+    if (is_depth) {
+        dst_view.Transition(vk::ImageLayout::eDepthStencilAttachmentOptimal,
+                            vk::PipelineStageFlagBits::eLateFragmentTests,
+                            vk::AccessFlagBits::eDepthStencilAttachmentRead |
+                                vk::AccessFlagBits::eDepthStencilAttachmentWrite);
+    } else {
+        dst_view.Transition(vk::ImageLayout::eColorAttachmentOptimal,
+                            vk::PipelineStageFlagBits::eColorAttachmentOutput,
+                            vk::AccessFlagBits::eColorAttachmentRead |
+                                vk::AccessFlagBits::eColorAttachmentWrite);
+    }
+
+    const vk::RenderPassBeginInfo renderpass_bi(renderpass, framebuffer, {{0, 0}, extent}, 0,
+                                                nullptr);
+    scheduler.RequestRenderpass(renderpass_bi);
+    scheduler.BindGraphicsPipeline(pipeline);
+
+    const std::array<f32, 4> src_rect_data{
+        static_cast<f32>(src_rect.left), static_cast<f32>(src_rect.top),
+        static_cast<f32>(src_rect.GetWidth()), static_cast<f32>(src_rect.GetHeight())};
+    const vk::Viewport viewport(static_cast<f32>(dst_rect.left), static_cast<f32>(dst_rect.top),
+                                static_cast<f32>(dst_rect.GetWidth()),
+                                static_cast<f32>(dst_rect.GetHeight()), 0.0f, 1.0f);
+    const vk::Rect2D scissor({0, 0}, extent);
+    scheduler.Record([layout = *layout, set, src_rect_data, viewport, scissor](auto cmdbuf,
+                                                                               auto& dld) {
+        cmdbuf.setViewport(0, {viewport}, dld);
+        cmdbuf.setScissor(0, {scissor}, dld);
+        cmdbuf.bindDescriptorSets(vk::PipelineBindPoint::eGraphics, layout, 0, {set}, {}, dld);
+        cmdbuf.pushConstants(layout, vk::ShaderStageFlagBits::eFragment, 0,
+                             static_cast<u32>(sizeof(src_rect_data)), src_rect_data.data(), dld);
+        cmdbuf.draw(4, 1, 0, 0, dld);
+    });
+
+    // The blit replaced the viewport and scissor set for the guest's draws
+    scheduler.InvalidateState();
+}
+
+vk::ShaderModule VKShaderBlit::GetFragmentShader(BlitComponent src_component,
+                                                 BlitComponent dst_component) {
+    const std::size_t index = static_cast<std::size_t>(src_component) * NumBlitComponents +
+                              static_cast<std::size_t>(dst_component);
+    auto& shader = fragment_shaders[index];
+    if (!shader) {
+        shader = CreateShaderModule(device,
+                                    BlitFragmentShader(src_component, dst_component).Assemble());
+    }
+    return *shader;
+}
+
+vk::Pipeline VKShaderBlit::GetPipeline(const ShaderBlitPipelineKey& key) {
+    const auto [entry, is_cache_miss] = pipelines.try_emplace(key);
+    auto& pipeline = entry->second;
+    if (!is_cache_miss) {
+        return *pipeline;
+    }
+
+    const std::array shader_stages = {
+        vk::PipelineShaderStageCreateInfo({}, vk::ShaderStageFlagBits::eVertex, *vertex_shader,
+                                          "main", nullptr),
+        vk::PipelineShaderStageCreateInfo({}, vk::ShaderStageFlagBits::eFragment,
+                                          GetFragmentShader(key.src_component, key.dst_component),
+                                          "main", nullptr)};
+
+    const vk::PipelineVertexInputStateCreateInfo vertex_input({}, 0, nullptr, 0, nullptr);
+
+    const vk::PipelineInputAssemblyStateCreateInfo input_assembly(
+        {}, vk::PrimitiveTopology::eTriangleStrip, false);
+
+    // Set a dummy viewport, it's going to be replaced by dynamic states.
+    const vk::Viewport viewport(0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f);
+    const vk::Rect2D scissor({0, 0}, {1, 1});
+
+    const vk::PipelineViewportStateCreateInfo viewport_state({}, 1, &viewport, 1, &scissor);
+
+    const vk::PipelineRasterizationStateCreateInfo rasterizer(
+        {}, false, false, vk::PolygonMode::eFill, vk::CullModeFlagBits::eNone,
+        vk::FrontFace::eClockwise, false, 0.0f, 0.0f, 0.0f, 1.0f);
+
+    const vk::PipelineMultisampleStateCreateInfo multisampling({}, vk::SampleCountFlagBits::e1,
+                                                               false, 0.0f, nullptr, false, false);
+
+    // Depth is only written when the test passes, make it always pass.
+    const bool is_depth = key.dst_component == BlitComponent::Depth;
+    const vk::PipelineDepthStencilStateCreateInfo depth_stencil(
+        {}, is_depth, is_depth, vk::CompareOp::eAlways, false, false, {}, {}, 0.0f, 0.0f);
+
+    const vk::PipelineColorBlendAttachmentState color_blend_attachment(
+        false, vk::BlendFactor::eZero, vk::BlendFactor::eZero, vk::BlendOp::eAdd,
+        vk::BlendFactor::eZero, vk::BlendFactor::eZero, vk::BlendOp::eAdd,
+        vk::ColorComponentFlagBits::eR | vk::ColorComponentFlagBits::eG |
+            vk::ColorComponentFlagBits::eB | vk::ColorComponentFlagBits::eA);
+
+    const vk::PipelineColorBlendStateCreateInfo color_blending(
+        {}, false, vk::LogicOp::eCopy, is_depth ? 0 : 1, &color_blend_attachment,
+        {0.0f, 0.0f, 0.0f, 0.0f});
+
+    const std::array<vk::DynamicState, 2> dynamic_states = {vk::DynamicState::eViewport,
+                                                            vk::DynamicState::eScissor};
+
+    const vk::PipelineDynamicStateCreateInfo dynamic_state(
+        {}, static_cast<u32>(dynamic_states.size()), dynamic_states.data());
+
+    const vk::GraphicsPipelineCreateInfo pipeline_ci(
+        {}, static_cast<u32>(shader_stages.size()), shader_stages.data(), &vertex_input,
+        &input_assembly, nullptr, &viewport_state, &rasterizer, &multisampling, &depth_stencil,
+        &color_blending, &dynamic_state, *layout, key.renderpass, 0, nullptr, 0);
+
+    const auto dev = device.GetLogical();
+    const auto& dld = device.GetDispatchLoader();
+    pipeline = dev.createGraphicsPipelineUnique({}, pipeline_ci, nullptr, dld);
+    return *pipeline;
+}
+
+vk::Framebuffer VKShaderBlit::GetFramebuffer(const ShaderBlitFramebufferKey& key) {
+    const auto [entry, is_cache_miss] = framebuffers.try_emplace(key);
+    auto& framebuffer = entry->second;
+    if (is_cache_miss) {
+        const vk::FramebufferCreateInfo framebuffer_ci({}, key.renderpass, 1, &key.view,
+                                                       key.width, key.height, 1);
+        const auto dev = device.GetLogical();
+        const auto& dld = device.GetDispatchLoader();
+        framebuffer = dev.createFramebufferUnique(framebuffer_ci, nullptr, dld);
+    }
+    return *framebuffer;
+}
+
+} // namespace Vulkan
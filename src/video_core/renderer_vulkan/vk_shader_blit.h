@@ -0,0 +1,136 @@
+// Copyright 2019 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <tuple>
+#include <unordered_map>
+
+#include <boost/functional/hash.hpp>
+
+#include "common/common_types.h"
+#include "common/math_util.h"
+#include "video_core/renderer_vulkan/declarations.h"
+#include "video_core/renderer_vulkan/vk_descriptor_pool.h"
+#include "video_core/renderer_vulkan/vk_renderpass_cache.h"
+
+namespace Vulkan {
+
+class CachedSurfaceView;
+class VKDevice;
+class VKScheduler;
+class VKUpdateDescriptorQueue;
+
+/// Numeric class of a surface, vkCmdBlitImage can't convert between some of them.
+enum class BlitComponent { Float, Uint, Sint, Depth };
+constexpr std::size_t NumBlitComponents = 4;
+
+struct ShaderBlitPipelineKey {
+    vk::RenderPass renderpass;
+    BlitComponent src_component;
+    BlitComponent dst_component;
+
+    std::size_t Hash() const {
+        std::size_t hash = 0;
+        boost::hash_combine(hash, static_cast<VkRenderPass>(renderpass));
+        boost::hash_combine(hash, static_cast<std::size_t>(src_component));
+        boost::hash_combine(hash, static_cast<std::size_t>(dst_component));
+        return hash;
+    }
+
+    bool operator==(const ShaderBlitPipelineKey& rhs) const {
+        return std::tie(renderpass, src_component, dst_component) ==
+               std::tie(rhs.renderpass, rhs.src_component, rhs.dst_component);
+    }
+};
+
+struct ShaderBlitFramebufferKey {
+    vk::RenderPass renderpass;
+    vk::ImageView view;
+    u32 width;
+    u32 height;
+
+    std::size_t Hash() const {
+        std::size_t hash = 0;
+        boost::hash_combine(hash, static_cast<VkRenderPass>(renderpass));
+        boost::hash_combine(hash, static_cast<VkImageView>(view));
+        boost::hash_combine(hash, width);
+        boost::hash_combine(hash, height);
+        return hash;
+    }
+
+    bool operator==(const ShaderBlitFramebufferKey& rhs) const {
+        return std::tie(renderpass, view, width, height) ==
+               std::tie(rhs.renderpass, rhs.view, rhs.width, rhs.height);
+    }
+};
+
+} // namespace Vulkan
+
+namespace std {
+
+template <>
+struct hash<Vulkan::ShaderBlitPipelineKey> {
+    std::size_t operator()(const Vulkan::ShaderBlitPipelineKey& k) const {
+        return k.Hash();
+    }
+};
+
+template <>
+struct hash<Vulkan::ShaderBlitFramebufferKey> {
+    std::size_t operator()(const Vulkan::ShaderBlitFramebufferKey& k) const {
+        return k.Hash();
+    }
+};
+
+} // namespace std
+
+namespace Vulkan {
+
+/// Blits between views drawing a rectangle, converting texels between any pair of blit components.
+class VKShaderBlit final {
+public:
+    explicit VKShaderBlit(const VKDevice& device, VKScheduler& scheduler,
+                          VKDescriptorPool& descriptor_pool,
+                          VKUpdateDescriptorQueue& update_descriptor_queue);
+    ~VKShaderBlit();
+
+    /// Draws the source rectangle of a 2D view into the destination rectangle of an attachable
+    /// view. Linear filtering is only valid for float sources.
+    void Blit(CachedSurfaceView& src_view, BlitComponent src_component,
+              CachedSurfaceView& dst_view, BlitComponent dst_component,
+              const Common::Rectangle<u32>& src_rect, const Common::Rectangle<u32>& dst_rect,
+              bool is_linear);
+
+private:
+    vk::ShaderModule GetFragmentShader(BlitComponent src_component, BlitComponent dst_component);
+
+    vk::Pipeline GetPipeline(const ShaderBlitPipelineKey& key);
+
+    vk::Framebuffer GetFramebuffer(const ShaderBlitFramebufferKey& key);
+
+    const VKDevice& device;
+    VKScheduler& scheduler;
+    VKUpdateDescriptorQueue& update_descriptor_queue;
+    VKRenderPassCache renderpass_cache;
+
+    UniqueDescriptorSetLayout descriptor_set_layout;
+    UniquePipelineLayout layout;
+    UniqueDescriptorUpdateTemplate descriptor_template;
+    std::optional<DescriptorAllocator> descriptor_allocator;
+
+    /// Nearest and linear samplers.
+    std::array<UniqueSampler, 2> samplers;
+
+    UniqueShaderModule vertex_shader;
+    std::array<UniqueShaderModule, NumBlitComponents * NumBlitComponents> fragment_shaders;
+
+    std::unordered_map<ShaderBlitPipelineKey, UniquePipeline> pipelines;
+    std::unordered_map<ShaderBlitFramebufferKey, UniqueFramebuffer> framebuffers;
+};
+
+} // namespace Vulkan
@@ -11,7 +11,6 @@
 #include "common/assert.h"
 #include "video_core/renderer_vulkan/declarations.h"
 #include "video_core/renderer_vulkan/vk_device.h"
-#include "video_core/renderer_vulkan/vk_resource_manager.h"
 #include "video_core/renderer_vulkan/vk_scheduler.h"
 #include "video_core/renderer_vulkan/vk_stream_buffer.h"
 
@@ -92,13 +91,22 @@ void VKStreamBuffer::Unmap(u64 size) {
 
     offset += size;
 
+    const u64 tick = scheduler.CurrentTick();
+    if (current_watch_cursor > 0) {
+        // Regions used within the same submission are released together, extend the last watch.
+        auto& last_watch = current_watches[current_watch_cursor - 1];
+        if (last_watch.tick == tick) {
+            last_watch.upper_bound = offset;
+            return;
+        }
+    }
     if (current_watch_cursor + 1 >= current_watches.size()) {
         // Ensure that there are enough watches.
         ReserveWatches(current_watches, WATCHES_RESERVE_CHUNK);
     }
     auto& watch = current_watches[current_watch_cursor++];
     watch.upper_bound = offset;
-    watch.fence.Watch(scheduler.GetFence());
+    watch.tick = tick;
 }
 
 void VKStreamBuffer::CreateBuffers(vk::BufferUsageFlags usage) {
@@ -138,7 +146,7 @@ void VKStreamBuffer::WaitPendingOperations(u64 requested_upper_bound) {
     while (requested_upper_bound < wait_bound && wait_cursor < *invalidation_mark) {
         auto& watch = previous_watches[wait_cursor];
         wait_bound = watch.upper_bound;
-        watch.fence.Wait();
+        scheduler.Wait(watch.tick);
         ++wait_cursor;
     }
 }
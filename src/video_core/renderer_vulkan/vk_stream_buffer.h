@@ -14,8 +14,6 @@
 namespace Vulkan {
 
 class VKDevice;
-class VKFence;
-class VKFenceWatch;
 class VKScheduler;
 
 class VKStreamBuffer final {
@@ -41,8 +39,8 @@ public:
 
 private:
     struct Watch final {
-        VKFenceWatch fence;
-        u64 upper_bound{};
+        u64 tick{};        ///< Scheduler tick that has to be signaled before reusing the region.
+        u64 upper_bound{}; ///< Highest offset used by the tick.
     };
 
     /// Creates Vulkan buffer handles committing the required the required memory.
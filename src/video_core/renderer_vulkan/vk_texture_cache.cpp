@@ -17,6 +17,7 @@
 #include "video_core/renderer_vulkan/vk_device.h"
 #include "video_core/renderer_vulkan/vk_memory_manager.h"
 #include "video_core/renderer_vulkan/vk_rasterizer.h"
+#include "video_core/renderer_vulkan/vk_shader_blit.h"
 #include "video_core/renderer_vulkan/vk_staging_buffer_pool.h"
 #include "video_core/renderer_vulkan/vk_texture_cache.h"
 #include "video_core/surface.h"
@@ -31,6 +32,7 @@ using Tegra::Texture::SwizzleSource;
 using VideoCore::Surface::PixelFormat;
 using VideoCore::Surface::SurfaceCompression;
 using VideoCore::Surface::SurfaceTarget;
+using VideoCore::Surface::SurfaceType;
 
 namespace {
 
@@ -154,6 +156,69 @@ vk::ImageCreateInfo GenerateImageCreateInfo(const VKDevice& device, const Surfac
                                nullptr, vk::ImageLayout::eUndefined);
 }
 
+/// Returns the numeric class of a view, derived from its host format.
+BlitComponent GetBlitComponent(const CachedSurfaceView& view) {
+    const auto& params = view.GetSurfaceParams();
+    if (params.type == SurfaceType::Depth || params.type == SurfaceType::DepthStencil) {
+        return BlitComponent::Depth;
+    }
+    switch (view.GetFormat()) {
+    case vk::Format::eR8Uint:
+    case vk::Format::eR8G8Uint:
+    case vk::Format::eR8G8B8A8Uint:
+    case vk::Format::eA8B8G8R8UintPack32:
+    case vk::Format::eA2B10G10R10UintPack32:
+    case vk::Format::eR16Uint:
+    case vk::Format::eR16G16Uint:
+    case vk::Format::eR16G16B16A16Uint:
+    case vk::Format::eR32Uint:
+    case vk::Format::eR32G32Uint:
+    case vk::Format::eR32G32B32A32Uint:
+        return BlitComponent::Uint;
+    case vk::Format::eR8Sint:
+    case vk::Format::eR8G8Sint:
+    case vk::Format::eR8G8B8A8Sint:
+    case vk::Format::eA8B8G8R8SintPack32:
+    case vk::Format::eA2B10G10R10SintPack32:
+    case vk::Format::eR16Sint:
+    case vk::Format::eR16G16Sint:
+    case vk::Format::eR16G16B16A16Sint:
+    case vk::Format::eR32Sint:
+    case vk::Format::eR32G32Sint:
+    case vk::Format::eR32G32B32A32Sint:
+        return BlitComponent::Sint;
+    default:
+        return BlitComponent::Float;
+    }
+}
+
+/// Returns true when vkCmdBlitImage can be used between the two views with the given filter.
+bool IsBlitSupported(const VKDevice& device, const CachedSurfaceView& src_view,
+                     const CachedSurfaceView& dst_view, bool is_linear) {
+    const auto& src_params = src_view.GetSurfaceParams();
+    const auto& dst_params = dst_view.GetSurfaceParams();
+    const BlitComponent src_component = GetBlitComponent(src_view);
+    if (src_component != GetBlitComponent(dst_view)) {
+        return false;
+    }
+    if (src_component == BlitComponent::Depth &&
+        src_params.pixel_format != dst_params.pixel_format) {
+        return false;
+    }
+
+    const auto physical = device.GetPhysical();
+    const auto& dld = device.GetDispatchLoader();
+    const auto src_features =
+        physical.getFormatProperties(src_view.GetFormat(), dld).optimalTilingFeatures;
+    const auto dst_features =
+        physical.getFormatProperties(dst_view.GetFormat(), dld).optimalTilingFeatures;
+    if (!(src_features & vk::FormatFeatureFlagBits::eBlitSrc) ||
+        !(dst_features & vk::FormatFeatureFlagBits::eBlitDst)) {
+        return false;
+    }
+    return !is_linear || (src_features & vk::FormatFeatureFlagBits::eSampledImageFilterLinear);
+}
+
 } // Anonymous namespace
 
 CachedSurface::CachedSurface(Core::System& system, const VKDevice& device,
@@ -227,6 +292,43 @@ void CachedSurface::DownloadTexture(std::vector<u8>& staging_buffer) {
     std::memcpy(staging_buffer.data(), buffer.commit->Map(host_memory_size), host_memory_size);
 }
 
+void CachedSurface::UploadRect(const VideoCommon::LinearCopyParams& copy, const u8* data) {
+    scheduler.RequestOutsideRenderPassOperationContext();
+
+    const std::size_t size = GetLinearCopySize(copy);
+    const auto& src_buffer = staging_pool.GetUnusedBuffer(size, true);
+    std::memcpy(src_buffer.commit->Map(size), data, size);
+
+    const auto [region, layer] = GetBufferImageCopy(copy);
+    Transition(layer, 1, 0, 1, vk::PipelineStageFlagBits::eTransfer,
+               vk::AccessFlagBits::eTransferWrite, vk::ImageLayout::eTransferDstOptimal);
+    scheduler.Record([buffer = *src_buffer.handle, image = image->GetHandle(),
+                      region = region](auto cmdbuf, auto& dld) {
+        cmdbuf.copyBufferToImage(buffer, image, vk::ImageLayout::eTransferDstOptimal, {region},
+                                 dld);
+    });
+}
+
+void CachedSurface::DownloadRect(const VideoCommon::LinearCopyParams& copy, u8* data) {
+    scheduler.RequestOutsideRenderPassOperationContext();
+
+    const auto [region, layer] = GetBufferImageCopy(copy);
+    Transition(layer, 1, 0, 1, vk::PipelineStageFlagBits::eTransfer,
+               vk::AccessFlagBits::eTransferRead, vk::ImageLayout::eTransferSrcOptimal);
+
+    const std::size_t size = GetLinearCopySize(copy);
+    const auto& buffer = staging_pool.GetUnusedBuffer(size, true);
+    scheduler.Record([image = image->GetHandle(), buffer = *buffer.handle,
+                      region = region](auto cmdbuf, auto& dld) {
+        cmdbuf.copyImageToBuffer(image, vk::ImageLayout::eTransferSrcOptimal, buffer, {region},
+                                 dld);
+    });
+    // Only wait for the submission holding the copy to be signaled.
+    scheduler.Wait(scheduler.CurrentTick());
+
+    std::memcpy(data, buffer.commit->Map(size), size);
+}
+
 void CachedSurface::DecorateSurfaceName() {
     // Stubbed.
 }
@@ -306,6 +408,23 @@ vk::BufferImageCopy CachedSurface::GetBufferImageCopy(u32 level) const {
         {params.GetMipWidth(level), params.GetMipHeight(level), vk_depth});
 }
 
+std::pair<vk::BufferImageCopy, u32> CachedSurface::GetBufferImageCopy(
+    const VideoCommon::LinearCopyParams& copy) const {
+    // Slices of 3D images are addressed by their offset, they aren't layers of their own.
+    const bool is_3d = params.target == SurfaceTarget::Texture3D;
+    const u32 layer = is_3d ? 0 : copy.layer;
+    const s32 z = is_3d ? static_cast<s32>(copy.layer) : 0;
+    const vk::BufferImageCopy region(
+        0, copy.row_length, 0, {image->GetAspectMask(), 0, layer, 1},
+        {static_cast<s32>(copy.x), static_cast<s32>(copy.y), z}, {copy.width, copy.height, 1});
+    return {region, layer};
+}
+
+std::size_t CachedSurface::GetLinearCopySize(const VideoCommon::LinearCopyParams& copy) const {
+    return (static_cast<std::size_t>(copy.row_length) * (copy.height - 1) + copy.width) *
+           params.GetBytesPerPixel();
+}
+
 vk::ImageSubresourceRange CachedSurface::GetImageSubresourceRange() const {
     return {image->GetAspectMask(), 0, params.num_levels, 0,
             static_cast<u32>(params.GetNumLayers())};
@@ -391,9 +510,12 @@ bool CachedSurfaceView::IsOverlapping(const View& rhs) const {
 VKTextureCache::VKTextureCache(Core::System& system, VideoCore::RasterizerInterface& rasterizer,
                                const VKDevice& device, VKResourceManager& resource_manager,
                                VKMemoryManager& memory_manager, VKScheduler& scheduler,
-                               VKStagingBufferPool& staging_pool)
+                               VKStagingBufferPool& staging_pool,
+                               VKDescriptorPool& descriptor_pool,
+                               VKUpdateDescriptorQueue& update_descriptor_queue)
     : TextureCache(system, rasterizer), device{device}, resource_manager{resource_manager},
-      memory_manager{memory_manager}, scheduler{scheduler}, staging_pool{staging_pool} {}
+      memory_manager{memory_manager}, scheduler{scheduler}, staging_pool{staging_pool},
+      shader_blit(device, scheduler, descriptor_pool, update_descriptor_queue) {}
 
 VKTextureCache::~VKTextureCache() = default;
 
@@ -441,8 +563,32 @@ void VKTextureCache::ImageCopy(Surface& src_surface, Surface& dst_surface,
     });
 }
 
-void VKTextureCache::ImageBlit(View& src_view, View& dst_view,
+bool VKTextureCache::ImageBlit(View& src_view, View& dst_view,
                                const Tegra::Engines::Fermi2D::Config& copy_config) {
+    const auto& src_params = src_view->GetSurfaceParams();
+    const auto& dst_params = dst_view->GetSurfaceParams();
+    if (src_params.target == SurfaceTarget::Texture3D ||
+        dst_params.target == SurfaceTarget::Texture3D) {
+        return false;
+    }
+
+    const auto& cfg = copy_config;
+    const BlitComponent src_component = GetBlitComponent(*src_view);
+    const BlitComponent dst_component = GetBlitComponent(*dst_view);
+    const bool is_linear = cfg.filter == Tegra::Engines::Fermi2D::Filter::Linear &&
+                           src_component == BlitComponent::Float;
+    if (!IsBlitSupported(device, *src_view, *dst_view, is_linear)) {
+        // Draw the blit when the formats can't be blitted or have to be converted
+        if (src_params.target != SurfaceTarget::Texture2D ||
+            !MaxwellToVK::SurfaceFormat(device, FormatType::Optimal, dst_params.pixel_format)
+                 .attachable) {
+            return false;
+        }
+        shader_blit.Blit(*src_view, src_component, *dst_view, dst_component, cfg.src_rect,
+                         cfg.dst_rect, is_linear);
+        return true;
+    }
+
     // We can't blit inside a renderpass
     scheduler.RequestOutsideRenderPassOperationContext();
 
@@ -451,22 +597,20 @@ void VKTextureCache::ImageBlit(View& src_view, View& dst_view,
     dst_view->Transition(vk::ImageLayout::eTransferDstOptimal, vk::PipelineStageFlagBits::eTransfer,
                          vk::AccessFlagBits::eTransferWrite);
 
-    const auto& cfg = copy_config;
     const auto src_top_left = vk::Offset3D(cfg.src_rect.left, cfg.src_rect.top, 0);
     const auto src_bot_right = vk::Offset3D(cfg.src_rect.right, cfg.src_rect.bottom, 1);
     const auto dst_top_left = vk::Offset3D(cfg.dst_rect.left, cfg.dst_rect.top, 0);
     const auto dst_bot_right = vk::Offset3D(cfg.dst_rect.right, cfg.dst_rect.bottom, 1);
     const vk::ImageBlit blit(src_view->GetImageSubresourceLayers(), {src_top_left, src_bot_right},
                              dst_view->GetImageSubresourceLayers(), {dst_top_left, dst_bot_right});
-    const bool is_linear = copy_config.filter == Tegra::Engines::Fermi2D::Filter::Linear;
 
-    const auto& dld{device.GetDispatchLoader()};
     scheduler.Record([src_image = src_view->GetImage(), dst_image = dst_view->GetImage(), blit,
                       is_linear](auto cmdbuf, auto& dld) {
         cmdbuf.blitImage(src_image, vk::ImageLayout::eTransferSrcOptimal, dst_image,
                          vk::ImageLayout::eTransferDstOptimal, {blit},
                          is_linear ? vk::Filter::eLinear : vk::Filter::eNearest, dld);
     });
+    return true;
 }
 
 void VKTextureCache::BufferCopy(Surface& src_surface, Surface& dst_surface) {
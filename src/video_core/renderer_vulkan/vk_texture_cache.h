@@ -7,6 +7,7 @@
 #include <memory>
 #include <tuple>
 #include <unordered_map>
+#include <utility>
 
 #include <boost/functional/hash.hpp>
 #include <boost/icl/interval_map.hpp>
@@ -22,6 +23,7 @@
 #include "video_core/renderer_vulkan/vk_image.h"
 #include "video_core/renderer_vulkan/vk_memory_manager.h"
 #include "video_core/renderer_vulkan/vk_scheduler.h"
+#include "video_core/renderer_vulkan/vk_shader_blit.h"
 #include "video_core/surface.h"
 #include "video_core/texture_cache/surface_base.h"
 #include "video_core/texture_cache/texture_cache.h"
@@ -39,10 +41,12 @@ class RasterizerInterface;
 namespace Vulkan {
 
 class RasterizerVulkan;
+class VKDescriptorPool;
 class VKDevice;
 class VKResourceManager;
 class VKScheduler;
 class VKStagingBufferPool;
+class VKUpdateDescriptorQueue;
 
 class CachedSurfaceView;
 class CachedSurface;
@@ -67,6 +71,9 @@ public:
     void UploadTexture(const std::vector<u8>& staging_buffer) override;
     void DownloadTexture(std::vector<u8>& staging_buffer) override;
 
+    void UploadRect(const VideoCommon::LinearCopyParams& copy, const u8* data) override;
+    void DownloadRect(const VideoCommon::LinearCopyParams& copy, u8* data) override;
+
     void FullTransition(vk::PipelineStageFlags new_stage_mask, vk::AccessFlags new_access,
                         vk::ImageLayout new_layout) {
         image->Transition(0, static_cast<u32>(params.GetNumLayers()), 0, params.num_levels,
@@ -96,6 +103,10 @@ public:
         return image->GetAspectMask();
     }
 
+    vk::Format GetFormat() const {
+        return format;
+    }
+
     vk::BufferView GetBufferViewHandle() const {
         return *buffer_view;
     }
@@ -113,6 +124,13 @@ private:
 
     vk::BufferImageCopy GetBufferImageCopy(u32 level) const;
 
+    /// Returns the copy region of a linear rectangle, along with the layer it has to transition.
+    std::pair<vk::BufferImageCopy, u32> GetBufferImageCopy(
+        const VideoCommon::LinearCopyParams& copy) const;
+
+    /// Returns the size of the linear memory a rectangle copy reads or writes.
+    std::size_t GetLinearCopySize(const VideoCommon::LinearCopyParams& copy) const;
+
     vk::ImageSubresourceRange GetImageSubresourceRange() const;
 
     Core::System& system;
@@ -143,6 +161,14 @@ public:
 
     bool IsOverlapping(const View& rhs) const;
 
+    const SurfaceParams& GetSurfaceParams() const {
+        return params;
+    }
+
+    vk::Format GetFormat() const {
+        return surface.GetFormat();
+    }
+
     vk::ImageView GetHandle() {
         return GetHandle(Tegra::Texture::SwizzleSource::R, Tegra::Texture::SwizzleSource::G,
                          Tegra::Texture::SwizzleSource::B, Tegra::Texture::SwizzleSource::A);
@@ -220,7 +246,8 @@ public:
     explicit VKTextureCache(Core::System& system, VideoCore::RasterizerInterface& rasterizer,
                             const VKDevice& device, VKResourceManager& resource_manager,
                             VKMemoryManager& memory_manager, VKScheduler& scheduler,
-                            VKStagingBufferPool& staging_pool);
+                            VKStagingBufferPool& staging_pool, VKDescriptorPool& descriptor_pool,
+                            VKUpdateDescriptorQueue& update_descriptor_queue);
     ~VKTextureCache();
 
 private:
@@ -229,7 +256,7 @@ private:
     void ImageCopy(Surface& src_surface, Surface& dst_surface,
                    const VideoCommon::CopyParams& copy_params) override;
 
-    void ImageBlit(View& src_view, View& dst_view,
+    bool ImageBlit(View& src_view, View& dst_view,
                    const Tegra::Engines::Fermi2D::Config& copy_config) override;
 
     void BufferCopy(Surface& src_surface, Surface& dst_surface) override;
@@ -239,6 +266,7 @@ private:
     VKMemoryManager& memory_manager;
     VKScheduler& scheduler;
     VKStagingBufferPool& staging_pool;
+    VKShaderBlit shader_blit;
 };
 
 } // namespace Vulkan
@@ -0,0 +1,151 @@
+// Copyright 2019 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include "common/assert.h"
+#include "video_core/syncpoint_manager.h"
+
+namespace Tegra {
+
+namespace {
+u64 ToNanoseconds(std::chrono::steady_clock::duration duration) {
+    return static_cast<u64>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+}
+} // Anonymous namespace
+
+SyncpointManager::SyncpointManager() = default;
+
+SyncpointManager::~SyncpointManager() = default;
+
+void SyncpointManager::Increment(u32 syncpoint_id) {
+    ASSERT(syncpoint_id < Service::Nvidia::MaxSyncPoints);
+
+    // Both this and the pending wait counters are sequentially consistent, so either this sees a
+    // wait being registered or the registration sees the new value.
+    const u32 value = values[syncpoint_id].fetch_add(1) + 1;
+
+    if (num_host_waiters.load() != 0) {
+        std::lock_guard lock{host_wait_mutex};
+        host_wait_cv.notify_all();
+    }
+
+    if (num_pending_waits[syncpoint_id].load() == 0) {
+        return;
+    }
+
+    std::vector<Wait> satisfied;
+    {
+        std::lock_guard lock{wait_mutex};
+        auto& waits = pending_waits[syncpoint_id];
+        const auto it = std::partition(waits.begin(), waits.end(), [value](const Wait& wait) {
+            return static_cast<s32>(value - wait.threshold) < 0;
+        });
+        satisfied.assign(std::make_move_iterator(it), std::make_move_iterator(waits.end()));
+        waits.erase(it, waits.end());
+        num_pending_waits[syncpoint_id].store(static_cast<u32>(waits.size()));
+    }
+
+    // Callbacks run unlocked, they are free to register new waits or take other locks.
+    const auto now = Clock::now();
+    for (auto& wait : satisfied) {
+        RecordWaitTime(now - wait.start_time);
+        wait.callback();
+    }
+}
+
+bool SyncpointManager::RegisterWait(u32 syncpoint_id, u32 threshold, WaitCallback callback) {
+    ASSERT(syncpoint_id < Service::Nvidia::MaxSyncPoints);
+
+    std::lock_guard lock{wait_mutex};
+    auto& waits = pending_waits[syncpoint_id];
+    const bool exists = std::any_of(waits.begin(), waits.end(), [threshold](const Wait& wait) {
+        return wait.threshold == threshold;
+    });
+    if (exists) {
+        return true;
+    }
+
+    num_pending_waits[syncpoint_id].fetch_add(1);
+    if (IsReached(syncpoint_id, threshold)) {
+        num_pending_waits[syncpoint_id].fetch_sub(1);
+        num_immediate_waits.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    waits.push_back({threshold, std::move(callback), Clock::now()});
+    return true;
+}
+
+bool SyncpointManager::CancelWait(u32 syncpoint_id, u32 threshold) {
+    ASSERT(syncpoint_id < Service::Nvidia::MaxSyncPoints);
+
+    std::lock_guard lock{wait_mutex};
+    auto& waits = pending_waits[syncpoint_id];
+    const auto it = std::find_if(waits.begin(), waits.end(), [threshold](const Wait& wait) {
+        return wait.threshold == threshold;
+    });
+    if (it == waits.end()) {
+        return false;
+    }
+
+    waits.erase(it);
+    num_pending_waits[syncpoint_id].fetch_sub(1);
+    num_cancelled_waits.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void SyncpointManager::WaitHost(u32 syncpoint_id, u32 threshold) {
+    ASSERT(syncpoint_id < Service::Nvidia::MaxSyncPoints);
+
+    if (IsReached(syncpoint_id, threshold)) {
+        return;
+    }
+
+    const auto start_time = Clock::now();
+    num_host_waiters.fetch_add(1);
+    {
+        std::unique_lock lock{host_wait_mutex};
+        host_wait_cv.wait(lock, [&] { return IsReached(syncpoint_id, threshold); });
+    }
+    num_host_waiters.fetch_sub(1);
+
+    num_host_waits.fetch_add(1, std::memory_order_relaxed);
+    total_host_ns.fetch_add(ToNanoseconds(Clock::now() - start_time), std::memory_order_relaxed);
+}
+
+SyncpointStatistics SyncpointManager::GetStatistics() const {
+    const auto load = [](const std::atomic<u64>& counter) {
+        return counter.load(std::memory_order_relaxed);
+    };
+    return {
+        load(num_waits),
+        load(num_immediate_waits),
+        load(num_cancelled_waits),
+        std::chrono::nanoseconds{load(total_wait_ns)},
+        std::chrono::nanoseconds{load(max_wait_ns)},
+        load(num_host_waits),
+        std::chrono::nanoseconds{load(total_host_ns)},
+    };
+}
+
+void SyncpointManager::ResetStatistics() {
+    for (auto* counter : {&num_waits, &num_immediate_waits, &num_cancelled_waits, &total_wait_ns,
+                          &max_wait_ns, &num_host_waits, &total_host_ns}) {
+        counter->store(0, std::memory_order_relaxed);
+    }
+}
+
+void SyncpointManager::RecordWaitTime(Clock::duration wait_time) {
+    const u64 wait_ns = ToNanoseconds(wait_time);
+    num_waits.fetch_add(1, std::memory_order_relaxed);
+    total_wait_ns.fetch_add(wait_ns, std::memory_order_relaxed);
+
+    u64 max_ns = max_wait_ns.load(std::memory_order_relaxed);
+    while (wait_ns > max_ns &&
+           !max_wait_ns.compare_exchange_weak(max_ns, wait_ns, std::memory_order_relaxed)) {
+    }
+}
+
+} // namespace Tegra
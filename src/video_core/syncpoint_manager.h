@@ -0,0 +1,106 @@
+// Copyright 2019 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <vector>
+#include "common/common_types.h"
+#include "core/hle/service/nvdrv/nvdata.h"
+
+namespace Tegra {
+
+/// Counters describing how long waits on syncpoints took to be satisfied.
+struct SyncpointStatistics {
+    u64 num_waits;                            ///< Waits satisfied after being registered
+    u64 num_immediate_waits;                  ///< Waits already satisfied when registered
+    u64 num_cancelled_waits;                  ///< Waits cancelled before being satisfied
+    std::chrono::nanoseconds total_wait_time; ///< Time from registration to being satisfied
+    std::chrono::nanoseconds max_wait_time;   ///< Longest time a wait took to be satisfied
+    u64 num_host_waits;                       ///< Host threads blocked in WaitHost
+    std::chrono::nanoseconds total_host_time; ///< Time host threads spent blocked in WaitHost
+};
+
+/**
+ * Holds the values of the GPU syncpoints and the waits on them. Increments don't take a lock
+ * unless something waits on the incremented syncpoint, and the waits they satisfy are resolved
+ * right away on the incrementing thread instead of being polled for.
+ */
+class SyncpointManager final {
+public:
+    using WaitCallback = std::function<void()>;
+
+    SyncpointManager();
+    ~SyncpointManager();
+
+    /// Returns the current value of a syncpoint.
+    u32 GetValue(u32 syncpoint_id) const {
+        return values[syncpoint_id].load();
+    }
+
+    /// Returns whether a syncpoint has reached the given threshold, accounting for wrap around.
+    bool IsReached(u32 syncpoint_id, u32 threshold) const {
+        return static_cast<s32>(GetValue(syncpoint_id) - threshold) >= 0;
+    }
+
+    /// Increments a syncpoint and runs the callbacks of the waits it satisfies.
+    void Increment(u32 syncpoint_id);
+
+    /**
+     * Registers a callback to run once a syncpoint reaches a threshold. The callback runs on the
+     * thread incrementing the syncpoint, without any lock of the manager held. Waits are
+     * identified by their syncpoint and threshold, registering an existing wait again is a no-op.
+     * @returns false without registering anything if the threshold was already reached.
+     */
+    bool RegisterWait(u32 syncpoint_id, u32 threshold, WaitCallback callback);
+
+    /// Cancels a pending wait. Returns false if there was none, e.g. because it was satisfied.
+    bool CancelWait(u32 syncpoint_id, u32 threshold);
+
+    /// Blocks the calling host thread until a syncpoint reaches a threshold.
+    void WaitHost(u32 syncpoint_id, u32 threshold);
+
+    /// Returns the wait counters accumulated since creation or the last reset.
+    SyncpointStatistics GetStatistics() const;
+
+    /// Clears the wait counters.
+    void ResetStatistics();
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Wait {
+        u32 threshold;
+        WaitCallback callback;
+        Clock::time_point start_time;
+    };
+
+    void RecordWaitTime(Clock::duration wait_time);
+
+    std::array<std::atomic<u32>, Service::Nvidia::MaxSyncPoints> values{};
+
+    /// Number of pending waits per syncpoint, lets increments skip the lock when it's zero.
+    std::array<std::atomic<u32>, Service::Nvidia::MaxSyncPoints> num_pending_waits{};
+    std::array<std::vector<Wait>, Service::Nvidia::MaxSyncPoints> pending_waits;
+    std::mutex wait_mutex;
+
+    std::atomic<u32> num_host_waiters{};
+    std::mutex host_wait_mutex;
+    std::condition_variable host_wait_cv;
+
+    std::atomic<u64> num_waits{};
+    std::atomic<u64> num_immediate_waits{};
+    std::atomic<u64> num_cancelled_waits{};
+    std::atomic<u64> total_wait_ns{};
+    std::atomic<u64> max_wait_ns{};
+    std::atomic<u64> num_host_waits{};
+    std::atomic<u64> total_host_ns{};
+};
+
+} // namespace Tegra
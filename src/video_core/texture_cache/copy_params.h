@@ -33,4 +33,14 @@ struct CopyParams {
     u32 depth;
 };
 
+/// Rectangle of a single layer of a surface's base level, copied to or from linear memory.
+struct LinearCopyParams {
+    u32 x;
+    u32 y;
+    u32 layer;
+    u32 width;
+    u32 height;
+    u32 row_length; ///< Distance in pixels between the rows in linear memory
+};
+
 } // namespace VideoCommon
@@ -60,7 +60,8 @@ private:
 
 class SurfaceBaseImpl {
 public:
-    void LoadBuffer(Tegra::MemoryManager& memory_manager, StagingCache& staging_cache);
+    void LoadBuffer(Tegra::MemoryManager& memory_manager, StagingCache& staging_cache,
+                    u8* staging_buffer);
 
     void FlushBuffer(Tegra::MemoryManager& memory_manager, StagingCache& staging_cache);
 
@@ -194,6 +195,12 @@ public:
 
     virtual void DownloadTexture(std::vector<u8>& staging_buffer) = 0;
 
+    /// Uploads a rectangle of linear data to the surface.
+    virtual void UploadRect(const LinearCopyParams& copy, const u8* data) = 0;
+
+    /// Downloads a rectangle of the surface to linear memory.
+    virtual void DownloadRect(const LinearCopyParams& copy, u8* data) = 0;
+
     void MarkAsModified(bool is_modified_, u64 tick) {
         is_modified = is_modified_ || is_target;
         modification_tick = tick;
@@ -8,6 +8,7 @@
 #include <array>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <set>
 #include <tuple>
 #include <unordered_map>
@@ -24,6 +25,7 @@
 #include "core/settings.h"
 #include "video_core/engines/fermi_2d.h"
 #include "video_core/engines/maxwell_3d.h"
+#include "video_core/engines/maxwell_dma.h"
 #include "video_core/gpu.h"
 #include "video_core/memory_manager.h"
 #include "video_core/rasterizer_interface.h"
@@ -143,10 +145,11 @@ public:
         std::lock_guard lock{mutex};
         auto& maxwell3d = system.GPU().Maxwell3D();
 
-        if (!maxwell3d.dirty.depth_buffer) {
+        auto& flags = maxwell3d.dirty.flags;
+        if (!flags[VideoCommon::Dirty::ZetaBuffer]) {
             return depth_buffer.view;
         }
-        maxwell3d.dirty.depth_buffer = false;
+        flags[VideoCommon::Dirty::ZetaBuffer] = false;
 
         const auto& regs{maxwell3d.regs};
         const auto gpu_addr{regs.zeta.Address()};
@@ -178,10 +181,11 @@ public:
         std::lock_guard lock{mutex};
         ASSERT(index < Tegra::Engines::Maxwell3D::Regs::NumRenderTargets);
         auto& maxwell3d = system.GPU().Maxwell3D();
-        if (!maxwell3d.dirty.render_target[index]) {
+        auto& flags = maxwell3d.dirty.flags;
+        if (!flags[VideoCommon::Dirty::ColorBuffer0 + index]) {
             return render_targets[index].view;
         }
-        maxwell3d.dirty.render_target[index] = false;
+        flags[VideoCommon::Dirty::ColorBuffer0 + index] = false;
 
         const auto& regs{maxwell3d.regs};
         if (index >= regs.rt_control.count || regs.rt[index].Address() == 0 ||
@@ -246,7 +250,11 @@ public:
         render_targets[index].view = nullptr;
     }
 
-    void DoFermiCopy(const Tegra::Engines::Fermi2D::Regs::Surface& src_config,
+    /**
+     * Performs a Fermi2D surface copy on the host GPU.
+     * @returns false when the backend can't execute the blit and it has to be done on the CPU.
+     */
+    bool DoFermiCopy(const Tegra::Engines::Fermi2D::Regs::Surface& src_config,
                      const Tegra::Engines::Fermi2D::Regs::Surface& dst_config,
                      const Tegra::Engines::Fermi2D::Config& copy_config) {
         std::lock_guard lock{mutex};
@@ -263,8 +271,82 @@ public:
             GetSurface(dst_gpu_addr, dst_cache_addr, dst_params, true, false);
         std::pair<TSurface, TView> src_surface =
             GetSurface(src_gpu_addr, src_cache_addr, src_params, true, false);
-        ImageBlit(src_surface.second, dst_surface.second, copy_config);
+        if (!ImageBlit(src_surface.second, dst_surface.second, copy_config)) {
+            return false;
+        }
         dst_surface.first->MarkAsModified(true, Tick());
+        return true;
+    }
+
+    /**
+     * Performs a DMA copy on the host GPU when the block linear surfaces it involves are resident
+     * in the cache, the linear side is accessed directly in guest memory.
+     * @returns false when the copy has to be done on the CPU instead.
+     */
+    bool DoDMACopy(const Tegra::Engines::MaxwellDMA::Regs& regs) {
+        std::lock_guard lock{mutex};
+        const bool is_src_linear = regs.exec.is_src_linear != 0;
+        const bool is_dst_linear = regs.exec.is_dst_linear != 0;
+        const GPUVAddr src_gpu_addr = regs.src_address.Address();
+        const GPUVAddr dst_gpu_addr = regs.dst_address.Address();
+        const u32 bytes_per_element = regs.SrcBytesPerElement();
+
+        if (is_src_linear) {
+            const auto dst = FindDMASurface(dst_gpu_addr, regs.dst_params, bytes_per_element,
+                                            regs.x_count, regs.y_count);
+            if (!dst) {
+                return false;
+            }
+            const auto copy = MakeLinearCopyParams(*dst, regs.src_pitch);
+            const auto src_ptr = GetLinearDMAPointer(src_gpu_addr, *dst, regs.src_pitch);
+            if (!copy || !src_ptr) {
+                return false;
+            }
+            rasterizer.FlushRegion(ToCacheAddr(src_ptr), GetLinearDMASize(*dst, regs.src_pitch));
+            dst->surface->UploadRect(*copy, src_ptr);
+            dst->surface->MarkAsModified(true, Tick());
+            return true;
+        }
+
+        const auto src = FindDMASurface(src_gpu_addr, regs.src_params, bytes_per_element,
+                                        regs.x_count, regs.y_count);
+        if (!src) {
+            return false;
+        }
+
+        if (is_dst_linear) {
+            // When guest memory holds the surface contents, swizzling on the CPU costs no flush.
+            if (!src->surface->IsModified()) {
+                return false;
+            }
+            const auto copy = MakeLinearCopyParams(*src, regs.dst_pitch);
+            u8* const dst_ptr = GetLinearDMAPointer(dst_gpu_addr, *src, regs.dst_pitch);
+            if (!copy || !dst_ptr) {
+                return false;
+            }
+            const CacheAddr dst_cache_addr = ToCacheAddr(dst_ptr);
+            const std::size_t dst_size = GetLinearDMASize(*src, regs.dst_pitch);
+            if (src->surface->Overlaps(dst_cache_addr, dst_cache_addr + dst_size)) {
+                return false;
+            }
+            rasterizer.InvalidateRegion(dst_cache_addr, dst_size);
+            src->surface->DownloadRect(*copy, dst_ptr);
+            return true;
+        }
+
+        const auto dst = FindDMASurface(dst_gpu_addr, regs.dst_params, bytes_per_element,
+                                        regs.x_count, regs.y_count);
+        if (!dst || src->surface == dst->surface || src->bytes_per_pixel != dst->bytes_per_pixel ||
+            src->surface->GetSurfaceParams().target == SurfaceTarget::Texture3D) {
+            return false;
+        }
+        TSurface src_surface = src->surface;
+        TSurface dst_surface = dst->surface;
+        ImageCopy(src_surface, dst_surface,
+                  CopyParams(src->x, src->y, src->layer, dst->x, dst->y, dst->layer, 0, 0,
+                             src->width, src->height, 1));
+        dst_surface->MarkAsModified(true, Tick());
+        return true;
     }
 
     TSurface TryFindFramebufferSurface(const u8* host_ptr) {
@@ -315,22 +397,38 @@ protected:
     virtual void ImageCopy(TSurface& src_surface, TSurface& dst_surface,
                            const CopyParams& copy_params) = 0;
 
-    virtual void ImageBlit(TView& src_view, TView& dst_view,
+    /// Blits between two views, returns false when the backend can't execute the blit.
+    virtual bool ImageBlit(TView& src_view, TView& dst_view,
                            const Tegra::Engines::Fermi2D::Config& copy_config) = 0;
 
     // Depending on the backend, a buffer copy can be slow as it means deoptimizing the texture
     // and reading it from a separate buffer.
     virtual void BufferCopy(TSurface& src_surface, TSurface& dst_surface) = 0;
 
+    /**
+     * Maps host memory the backend can upload a surface from without an extra copy.
+     * @returns Pointer where the surface's host data has to be written to, or nullptr when the
+     * surface has to be uploaded from the staging cache.
+     */
+    virtual u8* MapUploadBuffer(TSurface& surface, std::size_t size) {
+        return nullptr;
+    }
+
+    /// Uploads a surface from the memory returned by the last call to MapUploadBuffer.
+    virtual void UploadFromBuffer(TSurface& surface, std::size_t size) {
+        UNREACHABLE();
+    }
+
     void ManageRenderTargetUnregister(TSurface& surface) {
         auto& maxwell3d = system.GPU().Maxwell3D();
         const u32 index = surface->GetRenderTarget();
+        auto& flags = maxwell3d.dirty.flags;
         if (index == DEPTH_RT) {
-            maxwell3d.dirty.depth_buffer = true;
+            flags[VideoCommon::Dirty::ZetaBuffer] = true;
         } else {
-            maxwell3d.dirty.render_target[index] = true;
+            flags[VideoCommon::Dirty::ColorBuffer0 + index] = true;
         }
-        maxwell3d.dirty.render_settings = true;
+        flags[VideoCommon::Dirty::RenderTargets] = true;
     }
 
     void Register(TSurface surface) {
@@ -940,7 +1038,7 @@ private:
     void DeduceBestBlit(SurfaceParams& src_params, SurfaceParams& dst_params,
                         const GPUVAddr src_gpu_addr, const GPUVAddr dst_gpu_addr) {
         auto deduced_src = DeduceSurface(src_gpu_addr, src_params);
-        auto deduced_dst = DeduceSurface(src_gpu_addr, src_params);
+        auto deduced_dst = DeduceSurface(dst_gpu_addr, dst_params);
         if (deduced_src.Failed() || deduced_dst.Failed()) {
             return;
         }
@@ -996,10 +1094,113 @@ private:
         return {new_surface, new_surface->GetMainView()};
     }
 
-    void LoadSurface(const TSurface& surface) {
-        staging_cache.GetBuffer(0).resize(surface->GetHostSizeInBytes());
-        surface->LoadBuffer(system.GPU().MemoryManager(), staging_cache);
-        surface->UploadTexture(staging_cache.GetBuffer(0));
+    /// Rectangle of a surface targeted by a DMA copy, in pixels of the surface.
+    struct DMASurfaceRect {
+        TSurface surface;
+        u32 bytes_per_pixel;
+        u32 x;
+        u32 y;
+        u32 layer;
+        u32 width;
+        u32 height;
+    };
+
+    /// Finds the surface a DMA copy reads or writes, if it's resident with the same layout.
+    std::optional<DMASurfaceRect> FindDMASurface(
+        GPUVAddr gpu_addr, const Tegra::Engines::MaxwellDMA::Regs::Parameters& dma_params,
+        u32 bytes_per_element, u32 x_count, u32 y_count) {
+        const auto host_ptr{system.GPU().MemoryManager().GetPointer(gpu_addr)};
+        const auto iter = l1_cache.find(ToCacheAddr(host_ptr));
+        if (!host_ptr || iter == l1_cache.end()) {
+            return std::nullopt;
+        }
+        const TSurface& surface = iter->second;
+        const SurfaceParams& params = surface->GetSurfaceParams();
+        if (!params.is_tiled || params.type != VideoCore::Surface::SurfaceType::ColorTexture ||
+            params.GetCompressionType() != SurfaceCompression::None) {
+            return std::nullopt;
+        }
+        if (params.block_width != dma_params.block_width.Value() ||
+            params.block_height != dma_params.BlockHeight() ||
+            params.block_depth != dma_params.BlockDepth()) {
+            return std::nullopt;
+        }
+
+        // The DMA engine counts in elements that don't have to match the surface's pixels.
+        const u32 bytes_per_pixel = params.GetBytesPerPixel();
+        const u32 x_bytes = dma_params.pos_x * bytes_per_element;
+        const u32 width_bytes = x_count * bytes_per_element;
+        if (x_bytes % bytes_per_pixel != 0 || width_bytes % bytes_per_pixel != 0 ||
+            params.width * bytes_per_pixel != dma_params.size_x * bytes_per_element ||
+            params.height != dma_params.size_y) {
+            return std::nullopt;
+        }
+        const u32 x = x_bytes / bytes_per_pixel;
+        const u32 width = width_bytes / bytes_per_pixel;
+        const u32 y = dma_params.pos_y;
+        if (width == 0 || y_count == 0 || x + width > params.width || y + y_count > params.height) {
+            return std::nullopt;
+        }
+
+        const u32 layer = dma_params.pos_z;
+        switch (params.target) {
+        case SurfaceTarget::Texture2D:
+            if (layer != 0) {
+                return std::nullopt;
+            }
+            break;
+        case SurfaceTarget::Texture2DArray:
+        case SurfaceTarget::Texture3D:
+        case SurfaceTarget::TextureCubemap:
+        case SurfaceTarget::TextureCubeArray:
+            if (layer >= params.depth) {
+                return std::nullopt;
+            }
+            break;
+        default:
+            return std::nullopt;
+        }
+        return DMASurfaceRect{surface, bytes_per_pixel, x, y, layer, width, y_count};
+    }
+
+    /// Returns the parameters to copy a surface rectangle from or to linear memory with a pitch.
+    static std::optional<LinearCopyParams> MakeLinearCopyParams(const DMASurfaceRect& rect,
+                                                                u32 pitch) {
+        if (pitch % rect.bytes_per_pixel != 0 || pitch / rect.bytes_per_pixel < rect.width) {
+            return std::nullopt;
+        }
+        return LinearCopyParams{rect.x,     rect.y,      rect.layer,
+                                rect.width, rect.height, pitch / rect.bytes_per_pixel};
+    }
+
+    /// Returns the size of the linear side of a DMA copy.
+    static std::size_t GetLinearDMASize(const DMASurfaceRect& rect, u32 pitch) {
+        return static_cast<std::size_t>(pitch) * (rect.height - 1) +
+               static_cast<std::size_t>(rect.width) * rect.bytes_per_pixel;
+    }
+
+    /// Returns a host pointer to the linear side of a DMA copy, if it's contiguous in host memory.
+    u8* GetLinearDMAPointer(GPUVAddr gpu_addr, const DMASurfaceRect& rect, u32 pitch) {
+        auto& memory_manager = system.GPU().MemoryManager();
+        const std::size_t size = GetLinearDMASize(rect, pitch);
+        if (!memory_manager.IsBlockContinuous(gpu_addr, size)) {
+            return nullptr;
+        }
+        return memory_manager.GetPointer(gpu_addr);
+    }
+
+    void LoadSurface(TSurface& surface) {
+        auto& memory_manager = system.GPU().MemoryManager();
+        const std::size_t host_size = surface->GetHostSizeInBytes();
+        if (u8* const upload_buffer = MapUploadBuffer(surface, host_size)) {
+            surface->LoadBuffer(memory_manager, staging_cache, upload_buffer);
+            UploadFromBuffer(surface, host_size);
+        } else {
+            auto& staging_buffer = staging_cache.GetBuffer(0);
+            staging_buffer.resize(host_size);
+            surface->LoadBuffer(memory_manager, staging_cache, staging_buffer.data());
+            surface->UploadTexture(staging_buffer);
+        }
         surface->MarkAsModified(false, Tick());
     }
 
@@ -437,6 +437,10 @@ void Config::ReadCoreValues() {
     qt_config->beginGroup(QStringLiteral("Core"));
 
     Settings::values.use_multi_core = ReadSetting(QStringLiteral("use_multi_core"), false).toBool();
+    Settings::values.cpu_timeslice =
+        ReadSetting(QStringLiteral("cpu_timeslice"), 10000).toUInt();
+    Settings::values.use_host_routines =
+        ReadSetting(QStringLiteral("use_host_routines"), true).toBool();
 
     qt_config->endGroup();
 }
@@ -502,6 +506,8 @@ void Config::ReadDataStorageValues() {
         ReadSetting(QStringLiteral("sdmc_size"),
                     QVariant::fromValue<u64>(static_cast<u64>(Settings::SDMCSize::S16GB)))
             .toULongLong());
+    Settings::values.decrypted_sector_cache_size =
+        ReadSetting(QStringLiteral("decrypted_sector_cache_size"), 64).toUInt();
 
     qt_config->endGroup();
 }
@@ -923,6 +929,8 @@ void Config::SaveCoreValues() {
     qt_config->beginGroup(QStringLiteral("Core"));
 
     WriteSetting(QStringLiteral("use_multi_core"), Settings::values.use_multi_core, false);
+    WriteSetting(QStringLiteral("cpu_timeslice"), Settings::values.cpu_timeslice, 10000);
+    WriteSetting(QStringLiteral("use_host_routines"), Settings::values.use_host_routines, true);
 
     qt_config->endGroup();
 }
@@ -963,6 +971,8 @@ void Config::SaveDataStorageValues() {
     WriteSetting(QStringLiteral("sdmc_size"),
                  QVariant::fromValue<u64>(static_cast<u64>(Settings::values.sdmc_size)),
                  QVariant::fromValue<u64>(static_cast<u64>(Settings::SDMCSize::S16GB)));
+    WriteSetting(QStringLiteral("decrypted_sector_cache_size"),
+                 Settings::values.decrypted_sector_cache_size, 64);
     qt_config->endGroup();
 }
 
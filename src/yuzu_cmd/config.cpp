@@ -339,6 +339,8 @@ void Config::ReadValues() {
                                 static_cast<long>(Settings::NANDSystemSize::S2_5GB)));
     Settings::values.sdmc_size = static_cast<Settings::SDMCSize>(sdl2_config->GetInteger(
         "Data Storage", "sdmc_size", static_cast<long>(Settings::SDMCSize::S16GB)));
+    Settings::values.decrypted_sector_cache_size = static_cast<u32>(
+        sdl2_config->GetInteger("Data Storage", "decrypted_sector_cache_size", 64));
 
     // System
     Settings::values.use_docked_mode = sdl2_config->GetBoolean("System", "use_docked_mode", false);
@@ -364,6 +366,10 @@ void Config::ReadValues() {
 
     // Core
     Settings::values.use_multi_core = sdl2_config->GetBoolean("Core", "use_multi_core", false);
+    Settings::values.cpu_timeslice =
+        static_cast<u32>(sdl2_config->GetInteger("Core", "cpu_timeslice", 10000));
+    Settings::values.use_host_routines =
+        sdl2_config->GetBoolean("Core", "use_host_routines", true);
 
     // Renderer
     const int renderer_backend = sdl2_config->GetInteger(
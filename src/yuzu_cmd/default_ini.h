@@ -80,6 +80,15 @@ touch_device=
 # 0 (default): Disabled, 1: Enabled
 use_multi_core =
 
+# Number of ticks each CPU core runs before switching to the next one, between 1000 and 1000000.
+# Longer slices reduce the overhead of leaving the JIT, cores still stop early when an event is due.
+# 10000 (default)
+cpu_timeslice =
+
+# Whether to run hot guest routines like memcpy and strlen on the host
+# 0: Disabled, 1 (default): Enabled
+use_host_routines =
+
 [Renderer]
 # Which backend API to use.
 # 0 (default): OpenGL, 1: Vulkan
@@ -198,6 +207,10 @@ gamecard_current_game =
 # If 'gamecard_current_game' is 1 this setting is irrelevant
 gamecard_path =
 
+# Amount of memory in MiB used to cache decrypted game data, speeding up small repeated reads
+# 0: Disabled, 64 (default)
+decrypted_sector_cache_size =
+
 [System]
 # Whether the system is docked
 # 1: Yes, 0 (default): No
@@ -90,6 +90,8 @@ void Config::ReadValues() {
     FileUtil::GetUserPath(FileUtil::UserPath::SDMCDir,
                           sdl2_config->Get("Data Storage", "sdmc_directory",
                                            FileUtil::GetUserPath(FileUtil::UserPath::SDMCDir)));
+    Settings::values.decrypted_sector_cache_size = static_cast<u32>(
+        sdl2_config->GetInteger("Data Storage", "decrypted_sector_cache_size", 64));
 
     // System
     Settings::values.use_docked_mode = sdl2_config->GetBoolean("System", "use_docked_mode", false);
@@ -114,6 +116,10 @@ void Config::ReadValues() {
 
     // Core
     Settings::values.use_multi_core = sdl2_config->GetBoolean("Core", "use_multi_core", false);
+    Settings::values.cpu_timeslice =
+        static_cast<u32>(sdl2_config->GetInteger("Core", "cpu_timeslice", 10000));
+    Settings::values.use_host_routines =
+        sdl2_config->GetBoolean("Core", "use_host_routines", true);
 
     // Renderer
     Settings::values.resolution_factor =
@@ -12,6 +12,14 @@ const char* sdl2_config_file = R"(
 # 0 (default): Disabled, 1: Enabled
 use_multi_core=
 
+# Number of ticks each CPU core runs before switching to the next one, between 1000 and 1000000.
+# 10000 (default)
+cpu_timeslice=
+
+# Whether to run hot guest routines like memcpy and strlen on the host
+# 0: Disabled, 1 (default): Enabled
+use_host_routines=
+
 [Renderer]
 # Whether to use software or hardware rendering.
 # 0: Software, 1 (default): Hardware
@@ -78,6 +86,10 @@ swap_screen =
 # 1 (default): Yes, 0: No
 use_virtual_sd =
 
+# Amount of memory in MiB used to cache decrypted game data, speeding up small repeated reads
+# 0: Disabled, 64 (default)
+decrypted_sector_cache_size =
+
 [System]
 # Whether the system is docked
 # 1: Yes, 0 (default): No